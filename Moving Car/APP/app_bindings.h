@@ -0,0 +1,42 @@
+/*
+ * app_bindings.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains the Application (APP) handlers bound to the interrupt vectors at compile time.
+ *               It is included only by MCAL/exi/exi_program.c and MCAL/timer/timer_program.c, and only when their
+ *               static binding is enabled ( EXI_U8_STATIC_BINDING, TIMER_U8_STATIC_BINDING ), so the MCAL configs
+ *               never include the upper layers.
+ */
+
+#ifndef APP_BINDINGS_H_
+#define APP_BINDINGS_H_
+
+/* ***********************************************************************************************/
+/* APP Bindings Includes */
+
+#include "app_interface.h"
+
+/* ***********************************************************************************************/
+/* EXI Bindings ( MCAL/exi/exi_config.h ) */
+
+/* INT0: STOP button, a direct call ( the callback pushes to the event queue, too much to inline ) */
+#define EXI_INT0_HANDLER()				APP_stopCar()
+
+/* INT1: not bound, runtime callback */
+
+/* INT2: wheel encoder tick, inlined */
+#define EXI_INT2_HANDLER()				ENC_COUNT_TICK_FROM_ISR()
+
+/* ***********************************************************************************************/
+/* TIMER Bindings ( MCAL/timer/timer_config.h ) */
+
+/* Timer2 delay ended: raise the DCM stop flag, inlined */
+#define TIMER_TIMER_2_OVF_HANDLER()            DCM_UPDATE_STOP_FLAG_FROM_ISR()
+
+/* Timer0 compare match: show the next LEDs brightness slice, and return its length, inlined */
+#define TIMER_TIMER_0_COMP_HANDLER()           LED_BCM_NEXT_SLICE_FROM_ISR()
+
+/* ***********************************************************************************************/
+
+#endif /* APP_BINDINGS_H_ */
@@ -12,15 +12,23 @@
 /* ***********************************************************************************************/
 /* APP Configurations */
 
-/* BTNs Config */
-#define APP_STOP_BTN			2
-#define APP_START_BTN			3
+/* BTNs Config: compile-time pin descriptors ( MCAL/dio/dio_interface.h ), and their runtime pin numbers and port */
+#define APP_STOP_BTN_PIN		DIO_PIN( D, 2 )
+#define APP_START_BTN_PIN		DIO_PIN( D, 3 )
+#define APP_STOP_BTN			DIO_PIN_NUMBER( APP_STOP_BTN_PIN )
+#define APP_START_BTN			DIO_PIN_NUMBER( APP_START_BTN_PIN )
+#define APP_BTN_PORT			DIO_PIN_PORT( APP_START_BTN_PIN )
 
 /* LEDs Config */
 #define APP_MOVE_FWD_LD_LED		0
 #define APP_MOVE_FWD_SD_LED		1
 #define APP_ROTATE_LED			2
 #define APP_STOP_LED			3
+/* LEDs brightness while the car is not stopped ( LED_U8_LEVEL_OFF to LED_U8_LEVEL_FULL ): the route LEDs are dimmed
+ * to cut their power draw, the red LED stays bright. The brightness control is off in the "CAR_STOP" mode, so the
+ * parked car sleeps between its ticks: the red LED, and the blinks, are then at full brightness */
+#define APP_ROUTE_LEDS_LEVEL	64
+#define APP_STOP_LED_LEVEL		LED_U8_LEVEL_FULL
 
 /* Delays/Timing Config */
 #define APP_STARTING_DELAY      1000
@@ -31,9 +39,84 @@
 #define APP_FWD_SD_DURATION     2000
 #define APP_FWD_SD_DUTY         30
 
-/* APP_BREAK_FLAG */
-#define APP_BREAK_FLAG_UP       1
-#define APP_BREAK_FLAG_DOWN     0
+/* Calibration Config */
+/* Entry sequence: hold the START button while powering up, then press the STOP button within the entry window */
+#define APP_CAL_ENTRY_WINDOW    3000
+#define APP_CAL_ENTRY_POLL      10
+/* Duration of each measured test move */
+#define APP_CAL_PROBE_DURATION  1000
+/* Calibration targets in encoder ticks ( 20-slot disc, 65 mm wheel -> ~10.2 mm/tick, 130 mm track width ) */
+#define APP_CAL_ROT_90_TICKS    10		// pivot turn arc = PI * 130 mm / 4
+#define APP_CAL_FWD_LD_TICKS    59		// 600 mm long side
+#define APP_CAL_FWD_SD_TICKS    29		// 300 mm short side
+/* Lowest duty the calibration may select, below it the motors stall */
+#define APP_CAL_MIN_DUTY        10
+/* Calibration record location/identification in EEPROM */
+#define APP_CAL_EEPROM_ADDRESS  0x0000
+#define APP_CAL_MAGIC           0xCA
+#define APP_CAL_VERSION         1
+
+/* Startup Menu Config */
+/* Hold the START button while powering up then release it: each click shows the next program, a long press runs it.
+ * Clicks and long presses are GST gestures ( SERVICE/gst/gst_config.h ), sampled every poll: keep the poll at 10 msec.,
+ * the GST ticks. Times in msec.: the menu starts the patrol when left without a button edge for the timeout */
+#define APP_MENU_POLL           10
+#define APP_MENU_TIMEOUT        10000
+/* Diagnostics: LEDs walk step, motors test speed, and results shown time */
+#define APP_DIAG_STEP           250
+#define APP_DIAG_DUTY           50
+#define APP_DIAG_SHOW           3000
+/* Teleoperation: forward speed, and forward burst while the START button is held */
+#define APP_TELEOP_DUTY         50
+#define APP_TELEOP_STEP         100
+
+/* Route Selection Config */
+/* Hold the STOP button while powering up, the selected route advances every step until the button is released */
+#define APP_ROUTE_SELECT_STEP   1000
+#define APP_ROUTE_SELECT_POLL   10
+/* Route used until one is selected */
+#define APP_ROUTE_DEFAULT       APP_ROUTE_RECTANGLE
+/* Selected route location in EEPROM, after the calibration record */
+#define APP_ROUTE_EEPROM_ADDRESS 0x0010
+
+/* Mission Config */
+/* Mission location in EEPROM, up to the end of the EEPROM */
+#define APP_MSN_EEPROM_ADDRESS  0x0040
+
+/* Scheduler Tasks Config: index in the tasks table, period and first release offset in msec. */
+#define APP_PWM_TASK_ID         0
+#define APP_CAR_TASK_ID         1
+#define APP_MSN_TASK_ID         2
+#define APP_SUP_TASK_ID         3
+#define APP_PWM_TASK_PERIOD     1
+#define APP_PWM_TASK_OFFSET     0
+#define APP_CAR_TASK_PERIOD     10
+#define APP_CAR_TASK_OFFSET     5
+#define APP_MSN_TASK_PERIOD     1
+#define APP_MSN_TASK_OFFSET     0
+#define APP_SUP_TASK_PERIOD     50
+#define APP_SUP_TASK_OFFSET     3
+
+/* Supervisor Config: longest time between two check-ins of each task in msec., a few periods late is a hang */
+#define APP_PWM_TASK_DEADLINE   20
+#define APP_CAR_TASK_DEADLINE   100
+#define APP_MSN_TASK_DEADLINE   20
+/* Watchdog resets log location in EEPROM, between the selected route and the mission */
+#define APP_RESET_LOG_EEPROM_ADDRESS 0x0020
+/* Watchdog reset report at power-up: all LEDs blink, then the LED of the task to blame is shown */
+#define APP_RESET_REPORT_BLINKS 3
+#define APP_RESET_REPORT_STEP   250
+#define APP_RESET_REPORT_SHOW   2000
+/* Button events drained from the events queue per batch */
+#define APP_EVENTS_BATCH_SIZE   4
+/* LED patterns, run by the car task: a pattern tick is APP_CAR_TASK_PERIOD msec.
+ * Forgotten run: route LEDs blink on/off ticks, a number of times */
+#define APP_FORGET_BLINK_ON     10
+#define APP_FORGET_BLINK_OFF    10
+#define APP_FORGET_BLINKS       3
+
+/* Deferred Works Config: index in the works table ( priority ) of the ISR bottom halves */
+#define APP_STOP_WORK_ID        0
 
 /* End of Configurations */
 
@@ -14,31 +14,124 @@
 /* LIB */
 #include "../LIB/std.h"
 #include "../LIB/bit_math.h"
+#include "../LIB/pgm.h"
 
 /* MCAL */
 #include "../MCAL/dio/dio_interface.h"
 #include "../MCAL/gli/gli_interface.h"
 #include "../MCAL/exi/exi_interface.h"
 #include "../MCAL/timer/timer_interface.h"
+#include "../MCAL/eep/eep_interface.h"
 
 /* HAL */
 #include "../HAL/btn/btn_interface.h"
 #include "../HAL/led/led_interface.h"
 #include "../HAL/dcm/dcm_interface.h"
+#include "../HAL/enc/enc_interface.h"
+
+/* SERVICE */
+#include "../SERVICE/sch/sch_interface.h"
+#include "../SERVICE/fsm/fsm_interface.h"
+#include "../SERVICE/evq/evq_interface.h"
+#include "../SERVICE/gst/gst_interface.h"
+#include "../SERVICE/dfr/dfr_interface.h"
+#include "../SERVICE/msn/msn_interface.h"
+#include "../SERVICE/sup/sup_interface.h"
+#include "../SERVICE/evg/evg_interface.h"
 
 /* ***********************************************************************************************/
 /* APP Macros */
 
-/* APP Modes */
+/* APP Modes ( car state machine states ) */
 #define APP_CAR_STOP			0
 #define APP_CAR_START			1
-#define APP_CAR_MOVE_FWD_LD		2
-#define APP_CAR_ROT_90_DEG		3
-#define APP_CAR_MOVE_FWD_SD		4
+/* Segments of the selected route run one after the other */
+#define APP_CAR_RUN_ROUTE		2
+/* START button drives forward, STOP button turns right, entered from the startup menu and never left */
+#define APP_CAR_TELEOP			3
+#define APP_CAR_MODES_NUMBER	4
+
+/* APP Events ( car state machine events ) */
+#define APP_EV_STOP_BTN			0
+#define APP_EV_START_BTN		1
+#define APP_EV_TIMEOUT			2
+#define APP_EV_MOVE_DONE		3
+#define APP_EV_ROUTE_DONE		4
+/* STOP button held for a long press ( SERVICE/gst ) */
+#define APP_EV_STOP_LONG		5
+#define APP_EVENTS_NUMBER		6
+
+/* APP Route Segment Types */
+#define APP_SEG_FWD_LD			0	// Forward, calibrated long side speed and duration
+#define APP_SEG_FWD_SD			1	// Forward, calibrated short side speed and duration
+#define APP_SEG_FORWARD			2	// Forward, segment speed and duration
+#define APP_SEG_ROTATE			3	// 90 degrees right turn, calibrated duration
+#define APP_SEG_WAIT			4	// Stand still for the segment duration
+
+/* APP Route Segment LED: keep the LEDs of the previous segment */
+#define APP_SEG_LED_KEEP		0xFF
+
+/* APP Route Repeat */
+#define APP_ROUTE_ONCE			0	// Car stops after the last segment
+#define APP_ROUTE_LOOP			1	// Route restarts from its first segment
+
+/* APP Built-in Routes, route N is shown on LED N while selecting it */
+#define APP_ROUTE_RECTANGLE		0
+#define APP_ROUTE_SQUARE		1
+#define APP_ROUTE_SHUTTLE		2
+#define APP_ROUTE_ONE_LAP		3
+#define APP_ROUTES_NUMBER		4
+/* Mission loaded in EEPROM, shown on all LEDs while selecting it */
+#define APP_ROUTE_MISSION		4
+
+/* APP Startup Programs, program N is shown on LED N in the startup menu */
+#define APP_PRG_PATROL			0	// Car modes running the selected route ( normal start )
+#define APP_PRG_CALIBRATION		1	// Calibration mode, then normal start
+#define APP_PRG_DIAGNOSTICS		2	// LEDs, motors and encoder self-test, then normal start
+#define APP_PRG_TELEOP			3	// START button drives forward, STOP button turns right, until power off
+#define APP_PROGRAMS_NUMBER		4
 
-/* Diagonals Values */
-#define APP_SHORT_DGNL			0
-#define APP_LONG_DGNL			1
+/* APP Mission Sensors ( BR instruction ) */
+#define APP_MSN_SENSOR_START_BTN	0	// START button is held
+#define APP_MSN_SENSOR_BLOCKED		1	// Wheels did not turn during the last move or turn
+
+/* Route segment, stored in flash */
+typedef struct {
+	u8  u8_type;			/* APP_SEG_xxx */
+	u8  u8_duty;			/* Speed in %, APP_SEG_FORWARD only */
+	u16 u16_duration;		/* msec., APP_SEG_FORWARD and APP_SEG_WAIT only */
+	u8  u8_led;				/* LED turned on alone during the segment, or APP_SEG_LED_KEEP */
+}ST_APP_routeSegment_t;
+
+/* Route, stored in flash */
+typedef struct {
+	const ST_APP_routeSegment_t *pst_segments;	/* Segments array, in flash */
+	u8 u8_segmentsNumber;
+	u8 u8_repeat;			/* APP_ROUTE_ONCE or APP_ROUTE_LOOP */
+}ST_APP_route_t;
+
+/* Calibrated motion values, loaded from EEPROM at initialization */
+typedef struct {
+	u16 u16_rotationDuration;
+	u16 u16_fwdLdDuration;
+	u8  u8_fwdLdDuty;
+	u16 u16_fwdSdDuration;
+	u8  u8_fwdSdDuty;
+}ST_APP_calibration_t;
+
+/* Calibration record as stored in EEPROM */
+typedef struct {
+	u8 u8_magic;
+	u8 u8_version;
+	ST_APP_calibration_t st_calibration;
+	u8 u8_checksum;
+}ST_APP_calibrationRecord_t;
+
+/* Watchdog resets log as stored in EEPROM, updated after each watchdog reset */
+typedef struct {
+	u8 u8_watchdogResets;	/* Watchdog resets since the log was erased, up to 0xFE ( blank EEPROM reads 0xFF ) */
+	u8 u8_lastTaskId;		/* Task to blame for the last one, SUP_U8_NO_TASK if unknown */
+}ST_APP_resetLog_t;
 
 /* ***********************************************************************************************/
 /* APP Functions' Prototypes */
@@ -47,25 +140,25 @@
  * @brief Initializes the application by initializing MCAL and HAL.
  * This function initializes the General Interrupt Enable (GIE), sets up callback functions
  * for interrupt service routines, initializes the timers and buttons, initializes an LED array,
- * initializes the DC motor, and sets the application mode to "Car Stop".
+ * initializes the DC motor and the wheel encoder, loads the calibrated motion values from EEPROM,
+ * runs the startup menu if the START button is held ( calibration, diagnostics, teleoperation ), loads the selected route
+ * ( or runs the route selection if the STOP button is held ), and sets the application mode to "Car Stop"
+ * ( or "Car Teleop" if selected in the startup menu ).
  * @return None
  */
 void APP_initialization( void );
 
 /**
  * @brief This function starts the car program and keeps it running indefinitely.
- * The function uses a while loop to continuously check for the required app mode.
- * The app mode is checked using a switch statement, which contains various cases
- * that correspond to the different modes of operation for the car program. Each
- * case contains a series of steps to be executed to perform the desired action
- * for that mode.
+ * The function starts the scheduler, which runs the application tasks forever:
+ * the motors software PWM every 1 msec., and the car task every 10 msec.
+ * The car task feeds the car modes state machine with events: buttons presses,
+ * end of a delay, and end of a move. The entry action of each mode starts the
+ * desired action for that mode without blocking.
  * @return void
  * */
 void APP_startProgram  ( void );
 
-/* ISR Callback function for starting the car */
-void APP_startCar	   ( void );
-
 /* ISR Callback function for stopping the car immediately */
 void APP_stopCar	   ( void );
 
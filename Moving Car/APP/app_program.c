@@ -14,12 +14,218 @@
 
 /* Declaration and Initialization */
 
-/* Global variable to store appMode */
-static u8 u8_gs_appMode = APP_CAR_STOP;
-static u8 u8_gs_diagonalFlag = APP_LONG_DGNL;
+/* Car modes state machine, and its first mode: "CAR_STOP", or "CAR_TELEOP" selected in the startup menu */
+static ST_FSM_t st_gs_appCarFsm;
+static u8 u8_gs_appFirstMode = APP_CAR_STOP;
 
-u8 u8_g_suddenBreakFlag = APP_BREAK_FLAG_DOWN;
-u8 *u8Ptr_g_suddenBreakPtr = &u8_g_suddenBreakFlag;
+/* Button events pushed by the ISR callbacks, drained by the car task */
+static ST_EVQ_queue_t st_gs_appEventQueue;
+
+/* Car task event sources: a delay or a move is in progress, end of the current delay, and end of a route run once */
+static u8  u8_gs_appDelayArmed = STD_NOK;
+static u8  u8_gs_appMoveArmed = STD_NOK;
+static u32 u32_gs_appDeadline = 0;
+static u8  u8_gs_appRouteDone = STD_NOK;
+
+/* Selected route, and its running segment */
+static u8  u8_gs_appRouteId = APP_ROUTE_DEFAULT;
+static u8  u8_gs_appSegmentId = 0;
+
+/* Checkpoint of a run cut by the STOP button: the segment ( u8_gs_appSegmentId ) or the paused mission, the time left
+ * of a cut delay ( a cut move is kept by the DCM ), and the route LEDs */
+static u8  u8_gs_appCheckpoint = STD_NOK;
+static u16 u16_gs_appCheckpointDelay = 0;
+static u8  u8_gs_appLedMask = 0;
+
+/* Mission loaded from EEPROM, run by the mission task */
+static ST_MSN_t st_gs_appMission;
+
+/* Startup menu gestures ( APP_onMenuGesture ): shown program, the current press is the second of a double click,
+ * and the long press chose the shown program */
+static u8  u8_gs_appMenuProgramId = APP_PRG_PATROL;
+static u8  u8_gs_appMenuSecondPress = STD_NOK;
+static u8  u8_gs_appMenuChosen = STD_NOK;
+
+/* Car task private functions */
+static void APP_pwmTask        ( void );
+static void APP_carTask        ( void );
+static void APP_onGesture      ( u8 u8_a_btnPin, u8 u8_a_gesture );
+static void APP_startDelay     ( u16 u16_a_delay );
+static u8   APP_isDelayElapsed ( void );
+
+/* Car state machine actions */
+static void APP_enterStop      ( void );
+static void APP_enterStart     ( void );
+static void APP_enterRunRoute  ( void );
+static void APP_nextSegment    ( void );
+static void APP_exitRunRoute   ( void );
+static void APP_exitRunning    ( void );
+static void APP_forgetRun      ( void );
+static void APP_enterTeleop    ( void );
+static void APP_teleopDrive    ( void );
+static void APP_teleopTurn     ( void );
+
+/* Route executor private functions */
+static void APP_startSegment   ( void );
+static void APP_resumeRun      ( void );
+static void APP_setLeds        ( u8 u8_a_mask );
+
+/* Car state machine: ( mode, event ) -> ( action, next mode ), in flash */
+#define APP_IGNORE			{ FSM_U8_NO_TRANSITION, NULL }
+#define APP_GO( MODE )		{ MODE, NULL }
+#define APP_DO( ACTION )	{ FSM_U8_INTERNAL, ACTION }
+
+static const ST_FSM_transition_t st_gs_appCarTransitions[APP_CAR_MODES_NUMBER][APP_EVENTS_NUMBER] PGM_MEM =
+{
+	/*                      STOP_BTN                    START_BTN                    TIMEOUT                       MOVE_DONE                    ROUTE_DONE               STOP_LONG                  */
+	/* APP_CAR_STOP      */ { APP_IGNORE,                 APP_GO( APP_CAR_START ),     APP_IGNORE,                   APP_IGNORE,                  APP_IGNORE,              APP_DO( &APP_forgetRun )  },
+	/* APP_CAR_START     */ { APP_GO( APP_CAR_STOP ),     APP_IGNORE,                  APP_GO( APP_CAR_RUN_ROUTE ),  APP_IGNORE,                  APP_IGNORE,              APP_IGNORE                },
+	/* APP_CAR_RUN_ROUTE */ { APP_GO( APP_CAR_STOP ),     APP_IGNORE,                  APP_DO( &APP_nextSegment ),   APP_DO( &APP_nextSegment ),  APP_GO( APP_CAR_STOP ),  APP_IGNORE                },
+	/* APP_CAR_TELEOP    */ { APP_DO( &APP_teleopTurn ),  APP_DO( &APP_teleopDrive ),  APP_IGNORE,                   APP_DO( &APP_teleopDrive ),  APP_IGNORE,              APP_IGNORE                }
+};
+
+static void ( * const pf_gs_appCarEntryActions[APP_CAR_MODES_NUMBER] ) ( void ) PGM_MEM =
+{
+	&APP_enterStop, &APP_enterStart, &APP_enterRunRoute, &APP_enterTeleop
+};
+
+static void ( * const pf_gs_appCarExitActions[APP_CAR_MODES_NUMBER] ) ( void ) PGM_MEM =
+{
+	NULL, &APP_exitRunning, &APP_exitRunRoute, NULL
+};
+
+static const ST_FSM_machine_t st_gs_appCarMachine =
+{
+	&st_gs_appCarTransitions[0][0], pf_gs_appCarEntryActions, pf_gs_appCarExitActions, APP_CAR_MODES_NUMBER, APP_EVENTS_NUMBER
+};
+
+/* Mission task, and the operations a mission acts through */
+static void APP_missionTask   ( void );
+static void APP_msnMove       ( u8 u8_a_speed, u16 u16_a_time );
+static void APP_msnTurn       ( u8 u8_a_quarters );
+static u8   APP_msnIsBusy     ( void );
+static u8   APP_msnReadSensor ( u8 u8_a_sensor );
+
+static const ST_MSN_ops_t st_gs_appMissionOps =
+{
+	&APP_msnMove, &APP_msnTurn, &APP_setLeds, &APP_msnIsBusy, &APP_msnReadSensor
+};
+
+/* ISR bottom halves, index is priority */
+static void APP_stopCarWork   ( void );
+
+static void ( * const pf_gs_appWorks[] ) ( void ) =
+{
+	&APP_stopCarWork	/* APP_STOP_WORK_ID */
+};
+
+/* LED patterns, in flash */
+static const u8 u8_gs_appForgetSteps[] PGM_MEM =
+{
+	LED_STEPS_BLINK( APP_FORGET_BLINK_ON, APP_FORGET_BLINK_OFF )
+};
+
+static const ST_LED_pattern_t st_gs_appForgetPattern PGM_MEM =
+{
+	u8_gs_appForgetSteps, sizeof( u8_gs_appForgetSteps ), APP_FORGET_BLINKS
+};
+
+/* Application tasks, index is priority: motors PWM first, then the car modes, then the mission, then the supervisor */
+static const ST_SCH_task_t st_gs_appTasks[] =
+{
+	{ &APP_pwmTask,     APP_PWM_TASK_PERIOD, APP_PWM_TASK_OFFSET },	/* APP_PWM_TASK_ID */
+	{ &APP_carTask,     APP_CAR_TASK_PERIOD, APP_CAR_TASK_OFFSET },	/* APP_CAR_TASK_ID */
+	{ &APP_missionTask, APP_MSN_TASK_PERIOD, APP_MSN_TASK_OFFSET },	/* APP_MSN_TASK_ID */
+	{ &SUP_task,        APP_SUP_TASK_PERIOD, APP_SUP_TASK_OFFSET }	/* APP_SUP_TASK_ID */
+};
+
+/* Built-in routes segments, in flash: ( type, speed, duration, LED ) */
+#define APP_SEG( TYPE, DUTY, DURATION, LED )	{ TYPE, DUTY, DURATION, LED }
+#define APP_SEG_TURN_RIGHT																			\
+	APP_SEG( APP_SEG_WAIT,   0, APP_ROTATION_DELAY, APP_ROTATE_LED ),								\
+	APP_SEG( APP_SEG_ROTATE, 0, 0,                  APP_SEG_LED_KEEP ),								\
+	APP_SEG( APP_SEG_WAIT,   0, APP_ROTATION_DELAY, APP_SEG_LED_KEEP )
+
+/* Rectangle lap: long side, turn, short side, turn, twice */
+static const ST_APP_routeSegment_t st_gs_appRectangleLap[] PGM_MEM =
+{
+	APP_SEG( APP_SEG_FWD_LD, 0, 0, APP_MOVE_FWD_LD_LED ), APP_SEG_TURN_RIGHT,
+	APP_SEG( APP_SEG_FWD_SD, 0, 0, APP_MOVE_FWD_SD_LED ), APP_SEG_TURN_RIGHT,
+	APP_SEG( APP_SEG_FWD_LD, 0, 0, APP_MOVE_FWD_LD_LED ), APP_SEG_TURN_RIGHT,
+	APP_SEG( APP_SEG_FWD_SD, 0, 0, APP_MOVE_FWD_SD_LED ), APP_SEG_TURN_RIGHT
+};
+
+/* Square side: long side, turn */
+static const ST_APP_routeSegment_t st_gs_appSquareSide[] PGM_MEM =
+{
+	APP_SEG( APP_SEG_FWD_LD, 0, 0, APP_MOVE_FWD_LD_LED ), APP_SEG_TURN_RIGHT
+};
+
+/* Shuttle leg: long side, then turn around */
+static const ST_APP_routeSegment_t st_gs_appShuttleLeg[] PGM_MEM =
+{
+	APP_SEG( APP_SEG_FWD_LD, 0, 0, APP_MOVE_FWD_LD_LED ), APP_SEG_TURN_RIGHT, APP_SEG_TURN_RIGHT
+};
+
+#define APP_ROUTE( SEGMENTS, REPEAT )	{ SEGMENTS, sizeof( SEGMENTS ) / sizeof( SEGMENTS[0] ), REPEAT }
+
+/* Built-in routes, in flash, index is the route identifier */
+static const ST_APP_route_t st_gs_appRoutes[APP_ROUTES_NUMBER] PGM_MEM =
+{
+	/* APP_ROUTE_RECTANGLE */ APP_ROUTE( st_gs_appRectangleLap, APP_ROUTE_LOOP ),
+	/* APP_ROUTE_SQUARE    */ APP_ROUTE( st_gs_appSquareSide,   APP_ROUTE_LOOP ),
+	/* APP_ROUTE_SHUTTLE   */ APP_ROUTE( st_gs_appShuttleLeg,   APP_ROUTE_LOOP ),
+	/* APP_ROUTE_ONE_LAP   */ APP_ROUTE( st_gs_appRectangleLap, APP_ROUTE_ONCE )
+};
+
+/* Route selection private functions */
+static void APP_loadRoute  ( void );
+static void APP_selectRoute( void );
+static void APP_showRoute  ( void );
+
+/* Motion values used by the car modes, compile-time defaults until a valid calibration is loaded */
+static ST_APP_calibration_t st_gs_appCalibration =
+{
+	APP_ROTATION_DURATION, APP_FWD_LD_DURATION, APP_FWD_LD_DUTY, APP_FWD_SD_DURATION, APP_FWD_SD_DUTY
+};
+
+/* Calibration Moves */
+#define APP_CAL_MOVE_FORWARD	0
+#define APP_CAL_MOVE_ROTATE		1
+
+/* Calibration private functions */
+static u8   APP_isCalibrationRequested( void );
+static u8   APP_runCalibration        ( void );
+static u8   APP_measureMove           ( u8 u8_a_move, u8 u8_a_dutyCycle, u16 *u16_a_ticks );
+static u8   APP_calibrateSegment      ( u8 u8_a_dutyCycle, u16 u16_a_duration, u16 u16_a_targetTicks, u8 *u8_a_calDutyCycle, u16 *u16_a_calDuration );
+static u8   APP_getCalibrationChecksum( const ST_APP_calibration_t *st_a_calibration );
+static void APP_loadCalibration       ( void );
+static void APP_saveCalibration       ( void );
+
+/* Watchdog reset report private functions */
+static void APP_reportReset           ( void );
+
+/* Start-up code private functions */
+static u8   APP_startupDelay          ( u16 u16_a_delay );
+
+/* Startup menu private functions */
+static void APP_runMenu               ( void );
+static u8   APP_selectProgram         ( void );
+static void APP_onMenuGesture         ( u8 u8_a_btnPin, u8 u8_a_gesture );
+static u8   APP_waitMenuRelease       ( void );
+static void APP_showProgram           ( u8 u8_a_programId );
+static void APP_calibrationProgram    ( void );
+static void APP_diagnosticsProgram    ( void );
+static void APP_teleopProgram         ( void );
+
+/* Startup programs, index is the program identifier, the patrol is the normal start that follows every other program */
+static void ( * const pf_gs_appPrograms[APP_PROGRAMS_NUMBER] ) ( void ) PGM_MEM =
+{
+	/* APP_PRG_PATROL      */ NULL,
+	/* APP_PRG_CALIBRATION */ &APP_calibrationProgram,
+	/* APP_PRG_DIAGNOSTICS */ &APP_diagnosticsProgram,
+	/* APP_PRG_TELEOP      */ &APP_teleopProgram
+};
 
 /* *******************************************************************************************************************/
 
@@ -32,162 +238,1073 @@ u8 *u8Ptr_g_suddenBreakPtr = &u8_g_suddenBreakFlag;
 */
 void APP_initialization(void)
 {
+	u8 u8_l_btnState = DIO_U8_PIN_HIGH;
+
+	/* Reset cause first, then the watchdog watches the start-up code: its waits feed it ( APP_startupDelay ) */
+	SUP_init();
+
+	/* Bottom halves first, the INT0 callback posts one */
+	DFR_init( pf_gs_appWorks, sizeof( pf_gs_appWorks ) / sizeof( pf_gs_appWorks[0] ) );
+
 	/* MCAL Initialization */
 	GLI_enableGIE();
 
 	EXI_intSetCallBack( EXI_U8_INT0, &APP_stopCar );
 	EXI_enablePIE( EXI_U8_INT0, EXI_U8_SENSE_FALLING_EDGE );
 
-	EXI_intSetCallBack( EXI_U8_INT1, &APP_startCar );
-	EXI_enablePIE( EXI_U8_INT1, EXI_U8_SENSE_FALLING_EDGE );
-
-	TIMER_timer0NormalModeInit( DISABLED, &u8Ptr_g_suddenBreakPtr);
-	TIMER_timer2NormalModeInit( ENABLED, &u8Ptr_g_suddenBreakPtr);
+	TIMER_timer0NormalModeInit( DISABLED, EVG_U8_STOP );
+	TIMER_timer2NormalModeInit( ENABLED, EVG_U8_STOP );
 	
 	/* HAL Initialization */
-	BTN_init( APP_STOP_BTN , PORT_D );
-	BTN_init( APP_START_BTN, PORT_D );
+	BTN_init( APP_STOP_BTN , APP_BTN_PORT );
+	BTN_init( APP_START_BTN, APP_BTN_PORT );
 	LED_arrayInit( PORT_A, DIO_MASK_BITS_0_1_2_3 );
-	DCM_motorInit(&u8Ptr_g_suddenBreakPtr);
-	
-	u8_gs_appMode = APP_CAR_STOP;
+	LED_patternInit( PORT_A, DIO_MASK_BITS_0_1_2_3 );
+	DCM_motorInit( EVG_U8_STOP | EVG_U8_FAULT );
+	ENC_init();
+
+	/* Report a watchdog reset on the LEDs, and log it */
+	APP_reportReset();
+
+	/* Load calibrated motion values, compile-time defaults stay in use if none is stored */
+	APP_loadCalibration();
+
+	/* Load the mission, checked by the diagnostics */
+	MSN_load( &st_gs_appMission, APP_MSN_EEPROM_ADDRESS, &st_gs_appMissionOps );
+
+	/* Check 1: START button is held, then run the startup menu ( the normal start only reads the pin ) */
+	u8_l_btnState = DIO_PIN_READ( APP_START_BTN_PIN );
+	if ( u8_l_btnState == DIO_U8_PIN_LOW ) APP_runMenu();
+
+	/* Load the selected route, then let the user select another one if the STOP button is held */
+	APP_loadRoute();
+	APP_selectRoute();
+
+	/* SERVICE Initialization */
+	/* Button presses during the calibration sequence are not car events, so the queue starts empty here,
+	 * and the debounce starts from the buttons state here */
+	EVQ_init( &st_gs_appEventQueue );
+	BTN_debounceInit( APP_BTN_PORT, BTN_U8_MASK( APP_STOP_BTN ) | BTN_U8_MASK( APP_START_BTN ) );
+	GST_init( BTN_U8_MASK( APP_STOP_BTN ) | BTN_U8_MASK( APP_START_BTN ), &APP_onGesture );
+	/* Scheduler first, the initial mode entry action suspends the motors PWM or mission task */
+	SCH_init( st_gs_appTasks, sizeof( st_gs_appTasks ) / sizeof( st_gs_appTasks[0] ) );
+	FSM_init( &st_gs_appCarFsm, &st_gs_appCarMachine, u8_gs_appFirstMode );
+
+	/* Every task checks in, the supervisor itself is watched by the watchdog */
+	SUP_register( APP_PWM_TASK_ID, APP_PWM_TASK_DEADLINE );
+	SUP_register( APP_CAR_TASK_ID, APP_CAR_TASK_DEADLINE );
+	SUP_register( APP_MSN_TASK_ID, APP_MSN_TASK_DEADLINE );
 }
 
 /**
  * @brief This function starts the car program and keeps it running indefinitely.
- * The function uses a while loop to continuously check for the required app mode.
- * The app mode is checked using a switch statement, which contains various cases
- * that correspond to the different modes of operation for the car program. Each
- * case contains a series of steps to be executed to perform the desired action
- * for that mode.
+ * The function starts the scheduler, which runs the application tasks forever:
+ * the motors software PWM every 1 msec., and the car task every 10 msec.
+ * The car task feeds the car modes state machine with events: buttons presses
+ * ( STOP from the INT0 ISR, START from the debounced buttons ),
+ * end of a delay, and end of a move. The entry action of each mode starts the
+ * desired action for that mode without blocking.
  * @return void
  * */
 void APP_startProgram(void)
 {
-    /* Toggle forever */
-    while (1)
-	 {
-		/* Check 1: Required appMode */
-        switch ( u8_gs_appMode )
-		{
-            case APP_CAR_STOP:
-
-				/* Step A1: Turn on red LED, and turn off other LEDs */
-				LED_arrayOff( PORT_A, DIO_MASK_BITS_0_1_2 );
-				LED_on( PORT_A, APP_STOP_LED );
-				/* Step A2: Stop both motors */
-				DCM_stopDCM();
-
-				break;
-
-            case APP_CAR_START:
-			
-                /* Step B1: Delay 1 sec. */
-                TIMER_timer0Delay( APP_STARTING_DELAY );
-
-				/* Check 1.1: appMode is not "CAR_STOP" mode */
-                if ( u8_gs_appMode != APP_CAR_STOP )
-				{
-					/* Step B2: Update appMode to "CAR_MOVE_FWD_LD" mode */
-                    u8_gs_appMode = APP_CAR_MOVE_FWD_LD;
-                }
-                break;
-
-            case APP_CAR_MOVE_FWD_LD:
-			
-				/* Step C1: Update diagonalFlag to "LONG_DGNL" */
-				u8_gs_diagonalFlag = APP_LONG_DGNL;
-                /* Step C2: Turn on green(LD) LED, and turn off other LEDs */
-				LED_arrayOff( PORT_A, DIO_MASK_BITS_1_2_3 );
-				LED_on( PORT_A, APP_MOVE_FWD_LD_LED );
-				/* Step C3: Car moves for 3 sec. with 50% of speed */
-				TIMER_timer2Delay( APP_FWD_LD_DURATION );
-				DCM_setDutyCycleOfPWM( APP_FWD_LD_DUTY );
-				DCM_stopDCM();
-
-				/* Check 1.2: appMode is not "CAR_STOP" mode */
-                if ( u8_gs_appMode != APP_CAR_STOP )
-				{
-					/* Step C4: Update appMode to "CAR_ROT_90_DEG" mode */
-                    u8_gs_appMode = APP_CAR_ROT_90_DEG;
-                }
-                break;
-
-            case APP_CAR_ROT_90_DEG:
-
-				/* Step D1: Turn on yellow LED, and turn off other LEDs */
-               	LED_arrayOff( PORT_A, DIO_MASK_BITS_0_1_3 );
-				LED_on( PORT_A, APP_ROTATE_LED );
-                /* Step D2: Delay 0.5 sec. */
-                TIMER_timer0Delay( APP_ROTATION_DELAY );
-				/* Step D3: Car rotates for 620 msec. with 50% of speed */
-                TIMER_timer2Delay( APP_ROTATION_DURATION );
-				DCM_rotateDCM();
-				DCM_stopDCM();
-                /* Step D4: Delay 0.5 sec. */
-                TIMER_timer0Delay( APP_ROTATION_DELAY );
-
-				/* Check 1.3: appMode is not "CAR_STOP" mode */
-                if ( u8_gs_appMode != APP_CAR_STOP )
-				{
-					/* Step D5: Update appMode to "CAR_MOVE_FWD_SD" or "CAR_MOVE_FWD_LD" modes */
-					/* Check 1.3.1: Required diagonalFlag  */
-					switch ( u8_gs_diagonalFlag )
-					{
-						case APP_SHORT_DGNL:
-							u8_gs_appMode = APP_CAR_MOVE_FWD_LD; 
-							break;
-						case APP_LONG_DGNL : 
-							u8_gs_appMode = APP_CAR_MOVE_FWD_SD; 
-							break;
-						default: 
-							 u8_gs_diagonalFlag = APP_LONG_DGNL; 
-							u8_gs_appMode = APP_CAR_MOVE_FWD_LD;
-					}					
-                }
-                break;
-
-            case APP_CAR_MOVE_FWD_SD:
-				
-				/* Step E1: Update diagonalFlag to "SHORT_DGNL" */
-				u8_gs_diagonalFlag = APP_SHORT_DGNL;				
-				/* Step E2: Turn on green(SD) LED, and turn off other LEDs */
-                LED_arrayOff( PORT_A, DIO_MASK_BITS_0_2_3 );
-                LED_on( PORT_A, APP_MOVE_FWD_SD_LED );
-                /* Step E3: Car moves for 2 sec. with 30% of speed */
-                TIMER_timer2Delay( APP_FWD_SD_DURATION );
-				DCM_setDutyCycleOfPWM( APP_FWD_SD_DUTY );
-
-				/* Check 1.4: appMode is not "CAR_STOP" mode */
-                if ( u8_gs_appMode != APP_CAR_STOP )
-				{
-					/* Step E4: Update appMode to "CAR_ROT_90_DEG" mode */
-                    u8_gs_appMode = APP_CAR_ROT_90_DEG;
-                }
-                break;
-				
-            default:
-                u8_gs_appMode = APP_CAR_STOP;
-				u8_gs_diagonalFlag = APP_LONG_DGNL;
-                break;
-        }
-    }
-}
-
-/* ISR Callback function for starting the car */
-void APP_startCar( void )
-{
-    if(u8_gs_appMode != APP_CAR_STOP) return;
-	/* Update appMode to "CAR_START" mode */
-    u8_gs_diagonalFlag = APP_LONG_DGNL;
-    u8_g_suddenBreakFlag = APP_BREAK_FLAG_DOWN;
-    u8_gs_appMode = APP_CAR_START;
-}
-
-/* ISR Callback function for stopping the car immediately */
+	/* Tasks are supervised from here, the blocking start-up code is over */
+	SUP_start();
+
+	/* LEDs levels, the brightness control runs out of the "CAR_STOP" mode only ( APP_enterStart, APP_enterStop ) */
+	LED_bcmSetLevel( APP_MOVE_FWD_LD_LED, APP_ROUTE_LEDS_LEVEL );
+	LED_bcmSetLevel( APP_MOVE_FWD_SD_LED, APP_ROUTE_LEDS_LEVEL );
+	LED_bcmSetLevel( APP_ROTATE_LED,      APP_ROUTE_LEDS_LEVEL );
+	LED_bcmSetLevel( APP_STOP_LED,        APP_STOP_LED_LEVEL );
+
+	/* Interrupts-off time accounting of DEBUG builds times the car program only, not the start-up code */
+	GLI_resetLongestSpan();
+
+	/* Runs forever */
+	SCH_start();
+}
+
+/* ISR Callback function for stopping the car immediately, top half: interrupts disabled */
 void APP_stopCar( void )
 {
-	/* Update appMode to "CAR_STOP" mode */
-    u8_g_suddenBreakFlag = APP_BREAK_FLAG_UP;
-    u8_gs_appMode = APP_CAR_STOP;
+	/* Motors PWM pins are already low ( INT0 safe state, exi_config.h ), the sudden break keeps them low,
+	 * then the event push runs as a bottom half */
+	EVG_SET_FROM_ISR( EVG_U8_STOP );
+	DFR_POST_FROM_ISR( APP_STOP_WORK_ID );
+	DFR_runFromIsr();
+}
+
+/* Bottom half of APP_stopCar, interrupts enabled: push "STOP_BTN" event, handled by the car task.
+ * Bottom halves do not nest, so this is still the only producer of the events queue */
+static void APP_stopCarWork( void )
+{
+	u32 u32_l_ticks;
+
+	SCH_getTicks( &u32_l_ticks );
+	EVQ_push( &st_gs_appEventQueue, APP_EV_STOP_BTN, u32_l_ticks );
+}
+
+/* *******************************************************************************************************************/
+/* Car Task */
+
+/**
+ * @brief Motors PWM task, runs every APP_PWM_TASK_PERIOD msec. while the car moves.
+ */
+static void APP_pwmTask( void )
+{
+	SUP_checkIn( APP_PWM_TASK_ID );
+	DCM_pwmTask();
+}
+
+/**
+ * @brief Car modes task, runs every APP_CAR_TASK_PERIOD msec. and never blocks.
+ * Collects the events raised since the last run, and dispatches them to the car modes state machine.
+ */
+static void APP_carTask( void )
+{
+	ST_EVQ_event_t st_l_events[APP_EVENTS_BATCH_SIZE];
+	u8 u8_l_eventsCount;
+	u8 u8_l_index;
+	u8 u8_l_pressedBtns;
+	u8 u8_l_releasedBtns;
+
+	SUP_checkIn( APP_CAR_TASK_ID );
+
+	/* Step 0: Debounce the buttons, the car task period is the sampling period */
+	BTN_debounceTask();
+	BTN_getEdges( &u8_l_pressedBtns, &u8_l_releasedBtns );
+
+	/* Step 1: Drain the STOP button events pushed by the INT0 ISR callback, in the order they were raised */
+	do
+	{
+		EVQ_popBatch( &st_gs_appEventQueue, st_l_events, APP_EVENTS_BATCH_SIZE, &u8_l_eventsCount );
+
+		for ( u8_l_index = 0; u8_l_index < u8_l_eventsCount; u8_l_index++ )
+		{
+			FSM_dispatch( &st_gs_appCarFsm, st_l_events[u8_l_index].u8_event );
+		}
+	}
+	while ( u8_l_eventsCount == APP_EVENTS_BATCH_SIZE );
+
+	/* Step 1.1: Buttons gestures, after the STOP events raised before them ( APP_onGesture ) */
+	GST_task( u8_l_pressedBtns, u8_l_releasedBtns );
+
+	/* Step 2: Delay elapsed */
+	if ( ( u8_gs_appDelayArmed == STD_OK ) && ( APP_isDelayElapsed() == STD_OK ) )
+	{
+		u8_gs_appDelayArmed = STD_NOK;
+		FSM_dispatch( &st_gs_appCarFsm, APP_EV_TIMEOUT );
+	}
+
+	/* Step 3: Move ended */
+	if ( ( u8_gs_appMoveArmed == STD_OK ) && ( DCM_isMoving() == FALSE ) )
+	{
+		u8_gs_appMoveArmed = STD_NOK;
+		FSM_dispatch( &st_gs_appCarFsm, APP_EV_MOVE_DONE );
+	}
+
+	/* Step 4: Route run once ended */
+	if ( u8_gs_appRouteDone == STD_OK )
+	{
+		u8_gs_appRouteDone = STD_NOK;
+		FSM_dispatch( &st_gs_appCarFsm, APP_EV_ROUTE_DONE );
+	}
+
+	/* Step 5: LED patterns, after the modes actions that started or stopped them */
+	LED_patternTask();
+}
+
+/**
+ * @brief Buttons gestures action, called by GST_task from the car task: maps gestures to car events.
+ *  - START press: "START_BTN", once per debounced press whatever the contact bounce.
+ *  - STOP long press: "STOP_LONG" ( the press itself already stopped the car through INT0 ).
+ * @param[in] u8_a_btnPin  Button pin.
+ * @param[in] u8_a_gesture Gesture ( GST_U8_xxx ).
+ */
+static void APP_onGesture( u8 u8_a_btnPin, u8 u8_a_gesture )
+{
+	if      ( ( u8_a_btnPin == APP_START_BTN ) && ( u8_a_gesture == GST_U8_PRESS ) )      FSM_dispatch( &st_gs_appCarFsm, APP_EV_START_BTN );
+	else if ( ( u8_a_btnPin == APP_STOP_BTN  ) && ( u8_a_gesture == GST_U8_LONG_PRESS ) ) FSM_dispatch( &st_gs_appCarFsm, APP_EV_STOP_LONG );
+}
+
+/* "CAR_STOP" mode entry */
+static void APP_enterStop( void )
+{
+	/* Step A1: Stop the LEDs brightness control, its 8 Timer0 ISRs per frame would wake the parked car up,
+	 *          then turn on red LED at full brightness, and turn off other LEDs */
+	LED_bcmStop();
+	LED_arraySet( PORT_A, DIO_MASK_BITS_0_1_2_3, 1 << APP_STOP_LED );
+	/* Step A2: Stop both motors, and park the motors PWM and mission tasks so the tickless idle skips their 1 msec. ticks */
+	DCM_stopDCM();
+	SCH_suspendTask( APP_PWM_TASK_ID );
+	SCH_suspendTask( APP_MSN_TASK_ID );
+}
+
+/* "CAR_START" mode entry */
+static void APP_enterStart( void )
+{
+	/* Step B1: Dim the LEDs again, release the sudden break, then delay 1 sec. ( the LEDs belong to the route again ) */
+	LED_bcmStart();
+	LED_patternStop( DIO_MASK_BITS_0_1_2_3 );
+	EVG_clear( EVG_U8_STOP );
+	SCH_resumeTask( APP_PWM_TASK_ID );
+	SUP_restartDeadline( APP_PWM_TASK_ID );
+	APP_startDelay( APP_STARTING_DELAY );
+}
+
+/* "CAR_RUN_ROUTE" mode entry */
+static void APP_enterRunRoute( void )
+{
+	u8 u8_l_btnState = DIO_U8_PIN_HIGH;
+
+	/* Check 1: A run was cut by the STOP button, and the START button is not held through the starting delay, then resume it */
+	u8_l_btnState = DIO_PIN_READ( APP_START_BTN_PIN );
+	if ( ( u8_gs_appCheckpoint == STD_OK ) && ( u8_l_btnState != DIO_U8_PIN_LOW ) )
+	{
+		APP_resumeRun();
+		return;
+	}
+
+	/* Full restart: forget the checkpoint */
+	u8_gs_appCheckpoint = STD_NOK;
+	DCM_discardCutMove();
+
+	/* Check 2: Mission is selected, then the mission task runs it from its first instruction */
+	if ( u8_gs_appRouteId == APP_ROUTE_MISSION )
+	{
+		MSN_start( &st_gs_appMission );
+		SCH_resumeTask( APP_MSN_TASK_ID );
+		SUP_restartDeadline( APP_MSN_TASK_ID );
+		return;
+	}
+
+	/* Step C1: Run starts from the first segment of the selected route */
+	u8_gs_appSegmentId = 0;
+	APP_startSegment();
+}
+
+/* "CAR_RUN_ROUTE" mode, current segment ended */
+static void APP_nextSegment( void )
+{
+	const ST_APP_route_t *st_l_route = &st_gs_appRoutes[u8_gs_appRouteId];
+
+	u8_gs_appSegmentId++;
+
+	/* Check 1: Last segment ended, then restart the route, or stop the car */
+	if ( u8_gs_appSegmentId >= PGM_READ_BYTE( &st_l_route->u8_segmentsNumber ) )
+	{
+		if ( PGM_READ_BYTE( &st_l_route->u8_repeat ) == APP_ROUTE_ONCE )
+		{
+			u8_gs_appRouteDone = STD_OK;
+			return;
+		}
+
+		u8_gs_appSegmentId = 0;
+	}
+
+	APP_startSegment();
+}
+
+/* "CAR_RUN_ROUTE" mode exit: keep a checkpoint if the run is not over, so the next start resumes it */
+static void APP_exitRunRoute( void )
+{
+	const ST_APP_route_t *st_l_route = &st_gs_appRoutes[u8_gs_appRouteId];
+	u32 u32_l_ticks;
+
+	SCH_getTicks( &u32_l_ticks );
+
+	/* Check 1: Mission, then pause it if it is still running */
+	if ( u8_gs_appRouteId == APP_ROUTE_MISSION )
+	{
+		u8_gs_appCheckpoint = ( MSN_pause( &st_gs_appMission, u32_l_ticks ) == MSN_OK ) ? STD_OK : STD_NOK;
+	}
+	/* Check 2: Route, then keep its segment unless a route run once is over, and the time left of its delay */
+	else if ( u8_gs_appSegmentId < PGM_READ_BYTE( &st_l_route->u8_segmentsNumber ) )
+	{
+		u8_gs_appCheckpoint = STD_OK;
+		u16_gs_appCheckpointDelay = 0;
+
+		if ( ( u8_gs_appDelayArmed == STD_OK ) && ( APP_isDelayElapsed() == STD_NOK ) )
+		{
+			u16_gs_appCheckpointDelay = ( u16 ) ( u32_gs_appDeadline - u32_l_ticks );
+		}
+	}
+	else
+	{
+		u8_gs_appCheckpoint = STD_NOK;
+	}
+
+	APP_exitRunning();
+}
+
+/* "CAR_STOP" mode, STOP button long press: forget the checkpoint, so the next start runs the route or mission
+ * from its beginning, and blink the route LEDs to show it ( the red LED stays on ) */
+static void APP_forgetRun( void )
+{
+	u8_gs_appCheckpoint = STD_NOK;
+	DCM_discardCutMove();
+	LED_patternStart( DIO_MASK_BITS_0_1_2, &st_gs_appForgetPattern );
+}
+
+/* "CAR_TELEOP" mode entry: show the program LED, and park the mission task, the motors PWM task runs the moves */
+static void APP_enterTeleop( void )
+{
+	LED_arraySet( PORT_A, DIO_MASK_BITS_0_1_2_3, 1 << APP_PRG_TELEOP );
+	SCH_suspendTask( APP_MSN_TASK_ID );
+}
+
+/* "CAR_TELEOP" mode, START button pressed or a move ended: one more forward burst while the START button is held */
+static void APP_teleopDrive( void )
+{
+	u8 u8_l_btnState = DIO_U8_PIN_HIGH;
+
+	/* Check 1: A move or turn is in progress, its end checks the button again */
+	if ( DCM_isMoving() == TRUE ) return;
+
+	/* Check 2: START button is held */
+	u8_l_btnState = DIO_PIN_READ( APP_START_BTN_PIN );
+	if ( u8_l_btnState != DIO_U8_PIN_LOW ) return;
+
+	DCM_startMove( APP_TELEOP_DUTY, APP_TELEOP_STEP );
+	u8_gs_appMoveArmed = STD_OK;
+}
+
+/* "CAR_TELEOP" mode, STOP button pressed: the sudden break already cut the motors, release it and turn right 90 degrees */
+static void APP_teleopTurn( void )
+{
+	EVG_clear( EVG_U8_STOP );
+	DCM_discardCutMove();
+	DCM_startRotation( st_gs_appCalibration.u16_rotationDuration );
+	u8_gs_appMoveArmed = STD_OK;
+}
+
+/* Exit of every mode but "CAR_STOP": a left mode's delay, move or route must not raise events anymore */
+static void APP_exitRunning( void )
+{
+	u8_gs_appDelayArmed = STD_NOK;
+	u8_gs_appMoveArmed = STD_NOK;
+	u8_gs_appRouteDone = STD_NOK;
+}
+
+/**
+ * @brief Starts the current segment of the selected route without blocking: reads it from flash,
+ * shows its LED, then starts its move ( end raises "MOVE_DONE" ) or its delay ( end raises "TIMEOUT" ).
+ */
+static void APP_startSegment( void )
+{
+	const ST_APP_route_t        *st_l_route = &st_gs_appRoutes[u8_gs_appRouteId];
+	const ST_APP_routeSegment_t *st_l_segment;
+	u8  u8_l_led;
+	u16 u16_l_duration;
+
+	/* Step 1: Read the segment from flash */
+	st_l_segment   = ( const ST_APP_routeSegment_t * ) PGM_READ_WORD( &st_l_route->pst_segments ) + u8_gs_appSegmentId;
+	u8_l_led       = PGM_READ_BYTE( &st_l_segment->u8_led );
+	u16_l_duration = PGM_READ_WORD( &st_l_segment->u16_duration );
+
+	/* Step 2: Turn on the segment LED, and turn off the other route LEDs */
+	if ( u8_l_led != APP_SEG_LED_KEEP ) APP_setLeds( 1 << u8_l_led );
+
+	/* Step 3: Start the segment */
+	switch ( PGM_READ_BYTE( &st_l_segment->u8_type ) )
+	{
+		/* Calibrated long side ( default: 3 sec. with 50% of speed ) */
+		case APP_SEG_FWD_LD : DCM_startMove( st_gs_appCalibration.u8_fwdLdDuty, st_gs_appCalibration.u16_fwdLdDuration ); u8_gs_appMoveArmed = STD_OK; break;
+		/* Calibrated short side ( default: 2 sec. with 30% of speed ) */
+		case APP_SEG_FWD_SD : DCM_startMove( st_gs_appCalibration.u8_fwdSdDuty, st_gs_appCalibration.u16_fwdSdDuration ); u8_gs_appMoveArmed = STD_OK; break;
+		case APP_SEG_FORWARD: DCM_startMove( PGM_READ_BYTE( &st_l_segment->u8_duty ), u16_l_duration );                    u8_gs_appMoveArmed = STD_OK; break;
+		/* Calibrated 90 degrees turn with 50% of speed ( default: 620 msec. ) */
+		case APP_SEG_ROTATE : DCM_startRotation( st_gs_appCalibration.u16_rotationDuration );                              u8_gs_appMoveArmed = STD_OK; break;
+		case APP_SEG_WAIT   : APP_startDelay( u16_l_duration ); break;
+		/* Unknown segment type, skip it on the next car task run */
+		default             : APP_startDelay( 0 ); break;
+	}
+}
+
+/**
+ * @brief Resumes the run cut by the STOP button where it stopped: the route LEDs are shown again, then the cut move
+ * is finished, the cut delay waits for its time left, and a paused mission goes on from its next instruction.
+ */
+static void APP_resumeRun( void )
+{
+	const ST_APP_route_t        *st_l_route = &st_gs_appRoutes[u8_gs_appRouteId];
+	const ST_APP_routeSegment_t *st_l_segment;
+	u32 u32_l_ticks;
+
+	u8_gs_appCheckpoint = STD_NOK;
+	APP_setLeds( u8_gs_appLedMask );
+
+	/* Check 1: Mission, the cut move or turn ends before its next instruction runs */
+	if ( u8_gs_appRouteId == APP_ROUTE_MISSION )
+	{
+		DCM_resumeMove();
+		SCH_getTicks( &u32_l_ticks );
+		MSN_resume( &st_gs_appMission, u32_l_ticks );
+		SCH_resumeTask( APP_MSN_TASK_ID );
+		SUP_restartDeadline( APP_MSN_TASK_ID );
+		return;
+	}
+
+	st_l_segment = ( const ST_APP_routeSegment_t * ) PGM_READ_WORD( &st_l_route->pst_segments ) + u8_gs_appSegmentId;
+
+	/* Check 2: Delay segment, then wait for its time left */
+	if ( PGM_READ_BYTE( &st_l_segment->u8_type ) == APP_SEG_WAIT )
+	{
+		APP_startDelay( u16_gs_appCheckpointDelay );
+	}
+	/* Check 3: Move segment cut, then finish it */
+	else if ( DCM_resumeMove() == DCM_OK )
+	{
+		u8_gs_appMoveArmed = STD_OK;
+	}
+	/* Check 4: Move segment ended before it was cut, then go on with the next one */
+	else
+	{
+		APP_nextSegment();
+	}
+}
+
+/**
+ * @brief Shows the route LEDs: LEDs of the mask on, the other ones off, and keeps the mask for a resumed run.
+ *
+ * @param[in] u8_a_mask LEDs 0 -> 3 mask.
+ */
+static void APP_setLeds( u8 u8_a_mask )
+{
+	u8_gs_appLedMask = u8_a_mask;
+	LED_arraySet( PORT_A, DIO_MASK_BITS_0_1_2_3, u8_a_mask );
+}
+
+/**
+ * @brief Starts a car task delay, measured in scheduler ticks ( msec. ).
+ * @param[in] u16_a_delay Delay in msec.
+ */
+static void APP_startDelay( u16 u16_a_delay )
+{
+	SCH_getTicks( &u32_gs_appDeadline );
+	u32_gs_appDeadline += u16_a_delay;
+	u8_gs_appDelayArmed = STD_OK;
+}
+
+/**
+ * @brief Checks whether the car task delay elapsed ( wrap-safe ticks comparison ).
+ * @return STD_OK if the delay elapsed, STD_NOK otherwise.
+ */
+static u8 APP_isDelayElapsed( void )
+{
+	u32 u32_l_ticks;
+
+	SCH_getTicks( &u32_l_ticks );
+
+	return ( ( i32 ) ( u32_l_ticks - u32_gs_appDeadline ) >= 0 ) ? STD_OK : STD_NOK;
+}
+
+/* *******************************************************************************************************************/
+/* Route Selection */
+
+/**
+ * @brief Loads the selected route from EEPROM. The default route is kept if none is stored.
+ */
+static void APP_loadRoute( void )
+{
+	u8 u8_l_routeId;
+
+	if ( EEP_readByte( APP_ROUTE_EEPROM_ADDRESS, &u8_l_routeId ) != EEP_OK ) return;
+
+	/* Check 1: Stored route exists ( a blank EEPROM reads 0xFF ), or the stored mission is valid */
+	if ( ( u8_l_routeId < APP_ROUTES_NUMBER ) ||
+		 ( ( u8_l_routeId == APP_ROUTE_MISSION ) && ( st_gs_appMission.u8_state != MSN_U8_FAULT ) ) ) u8_gs_appRouteId = u8_l_routeId;
+}
+
+/**
+ * @brief Runs the route selection if the STOP button is held at power-up: the selected route is shown
+ * on its LED, and advances to the next route every APP_ROUTE_SELECT_STEP msec. while the button is held.
+ * The EEPROM mission comes after the built-in routes, if it is valid.
+ * Releasing the button keeps the shown route, and stores it for the next power-ups.
+ */
+static void APP_selectRoute( void )
+{
+	u8  u8_l_btnState = DIO_U8_PIN_HIGH;
+	u16 u16_l_elapsedTime = 0;
+
+	/* Check 1: STOP button is held ( buttons are active low, pull up enabled ) */
+	u8_l_btnState = DIO_PIN_READ( APP_STOP_BTN_PIN );
+	if ( u8_l_btnState != DIO_U8_PIN_LOW ) return;
+
+	APP_showRoute();
+
+	while ( u8_l_btnState == DIO_U8_PIN_LOW )
+	{
+		/* Step 1: The STOP press raised the sudden break through INT0 ( again on every bounce ), which would skip
+		 * the delay: release it before each poll, and count only the polls that really waited */
+		EVG_clear( EVG_U8_STOP );
+		if ( APP_startupDelay( APP_ROUTE_SELECT_POLL ) == STD_OK ) u16_l_elapsedTime += APP_ROUTE_SELECT_POLL;
+
+		/* Check 1.1: Button held for one more step, then show the next route */
+		if ( u16_l_elapsedTime >= APP_ROUTE_SELECT_STEP )
+		{
+			u16_l_elapsedTime = 0;
+			u8_gs_appRouteId++;
+
+			/* Check 1.1.1: Past the built-in routes, and the mission is not valid, or past the mission */
+			if ( ( ( u8_gs_appRouteId == APP_ROUTE_MISSION ) && ( st_gs_appMission.u8_state == MSN_U8_FAULT ) ) ||
+				 ( u8_gs_appRouteId > APP_ROUTE_MISSION ) ) u8_gs_appRouteId = 0;
+
+			APP_showRoute();
+		}
+
+		u8_l_btnState = DIO_PIN_READ( APP_STOP_BTN_PIN );
+	}
+
+	EEP_updateBlock( APP_ROUTE_EEPROM_ADDRESS, &u8_gs_appRouteId, 1 );
+
+	/* STOP presses went through INT0 too, so release the sudden break */
+	EVG_clear( EVG_U8_STOP );
+}
+
+/**
+ * @brief Shows the selected route: route N on LED N, the mission on all LEDs.
+ */
+static void APP_showRoute( void )
+{
+	if ( u8_gs_appRouteId == APP_ROUTE_MISSION )
+	{
+		LED_arraySet( PORT_A, DIO_MASK_BITS_0_1_2_3, DIO_MASK_BITS_0_1_2_3 );
+	}
+	else
+	{
+		LED_arraySet( PORT_A, DIO_MASK_BITS_0_1_2_3, 1 << u8_gs_appRouteId );
+	}
+}
+
+/* *******************************************************************************************************************/
+/* Mission */
+
+/**
+ * @brief Mission task, runs every APP_MSN_TASK_PERIOD msec. while a mission runs, and never blocks.
+ * Runs one mission instruction per run, then raises "ROUTE_DONE" once the mission reaches its END.
+ */
+static void APP_missionTask( void )
+{
+	u32 u32_l_ticks;
+	u8  u8_l_state;
+
+	SUP_checkIn( APP_MSN_TASK_ID );
+
+	SCH_getTicks( &u32_l_ticks );
+	MSN_step( &st_gs_appMission, u32_l_ticks );
+
+	/* Check 1: Mission is done, then the car task stops the car, and this task parks itself */
+	MSN_getState( &st_gs_appMission, &u8_l_state );
+	if ( u8_l_state != MSN_U8_RUNNING )
+	{
+		u8_gs_appRouteDone = STD_OK;
+		SCH_suspendTask( APP_MSN_TASK_ID );
+	}
+}
+
+/* Mission MOVE: forward move, the encoder counts the move ticks */
+static void APP_msnMove( u8 u8_a_speed, u16 u16_a_time )
+{
+	ENC_reset();
+	DCM_startMove( u8_a_speed, u16_a_time );
+}
+
+/* Mission TURN: calibrated 90 degrees turn per quarter */
+static void APP_msnTurn( u8 u8_a_quarters )
+{
+	u32 u32_l_duration = ( u32 ) st_gs_appCalibration.u16_rotationDuration * u8_a_quarters;
+
+	ENC_reset();
+	DCM_startRotation( ( u32_l_duration > 0xFFFF ) ? 0xFFFF : ( u16 ) u32_l_duration );
+}
+
+/* Mission busy while a move or turn is in progress */
+static u8 APP_msnIsBusy( void )
+{
+	return ( DCM_isMoving() == TRUE ) ? STD_OK : STD_NOK;
+}
+
+/* Mission BR sensors */
+static u8 APP_msnReadSensor( u8 u8_a_sensor )
+{
+	u8  u8_l_btnState = DIO_U8_PIN_HIGH;
+	u16 u16_l_ticks = 0;
+
+	switch ( u8_a_sensor )
+	{
+		case APP_MSN_SENSOR_START_BTN:
+			u8_l_btnState = DIO_PIN_READ( APP_START_BTN_PIN );
+			return ( u8_l_btnState == DIO_U8_PIN_LOW ) ? STD_OK : STD_NOK;
+
+		case APP_MSN_SENSOR_BLOCKED:
+			ENC_getTicks( &u16_l_ticks );
+			return ( u16_l_ticks == 0 ) ? STD_OK : STD_NOK;
+
+		default:
+			return STD_NOK;
+	}
+}
+
+/* *******************************************************************************************************************/
+/* Startup Menu */
+
+/**
+ * @brief Blocking delay of the start-up code, on Timer0, then feeds the start-up watchdog ( SUP_feedStartup ).
+ * The delay subscribes to the sudden break: while EVG_U8_STOP is raised it returns at once, or early.
+ * @param[in] u16_a_delay Delay in msec., shorter than the start-up watchdog timeout.
+ * @return u8 STD_OK if the whole delay elapsed, STD_NOK if the sudden break skipped or cut it.
+ */
+static u8 APP_startupDelay( u16 u16_a_delay )
+{
+	EN_TIMER_ERROR_T en_l_error = TIMER_timer0Delay( u16_a_delay );
+
+	SUP_feedStartup();
+
+	return ( en_l_error == TIMER_OK ) ? STD_OK : STD_NOK;
+}
+
+/**
+ * @brief Runs the startup menu, the START button being held at power-up: the calibration button sequence runs
+ * the calibration at once, otherwise the program is selected with gestures, then the selected program runs.
+ * Every program returns, and the normal start goes on ( the teleoperation only selects the first car mode ).
+ */
+static void APP_runMenu( void )
+{
+	void ( *pf_l_program ) ( void );
+	u8 u8_l_programId;
+
+	/* Check 1: Calibration mode button sequence is entered */
+	if ( APP_isCalibrationRequested() == STD_OK ) u8_l_programId = APP_PRG_CALIBRATION;
+	else                                          u8_l_programId = APP_selectProgram();
+
+	/* STOP presses went through INT0 too, so release the sudden break first */
+	EVG_clear( EVG_U8_STOP );
+	LED_arrayOff( PORT_A, DIO_MASK_BITS_0_1_2_3 );
+
+	pf_l_program = ( void ( * ) ( void ) ) PGM_READ_WORD( &pf_gs_appPrograms[u8_l_programId] );
+	if ( pf_l_program != NULL ) pf_l_program();
+}
+
+/**
+ * @brief Selects a program with START button gestures, once the button held at power-up is released.
+ * The buttons are debounced ( BTN_debounceTask ) and turned into gestures ( GST_task ) every APP_MENU_POLL, as the
+ * car task does: the shown program starts as the patrol, each click shows the next program, and a long press runs
+ * the shown program ( all LEDs turn on ) once the button is released ( see APP_onMenuGesture ).
+ * A STOP press, or no button edge for APP_MENU_TIMEOUT, leaves with the patrol.
+ * @return u8 Selected program identifier ( APP_PRG_xxx ).
+ */
+static u8 APP_selectProgram( void )
+{
+	u8  u8_l_pressedBtns = 0;
+	u8  u8_l_releasedBtns = 0;
+	u16 u16_l_idleTime = 0;
+
+	u8_gs_appMenuProgramId   = APP_PRG_PATROL;
+	u8_gs_appMenuSecondPress = STD_NOK;
+	u8_gs_appMenuChosen      = STD_NOK;
+
+	/* The START button held at power-up is the initial debounced state, so it reports no press */
+	BTN_debounceInit( APP_BTN_PORT, BTN_U8_MASK( APP_START_BTN ) );
+	GST_init( BTN_U8_MASK( APP_START_BTN ), &APP_onMenuGesture );
+
+	/* Step 1: Wait for the START button held at power-up to be released, its release is no gesture */
+	if ( APP_waitMenuRelease() == STD_NOK ) return APP_PRG_PATROL;
+	BTN_getEdges( &u8_l_pressedBtns, &u8_l_releasedBtns );
+
+	APP_showProgram( u8_gs_appMenuProgramId );
+
+	/* Step 2: Read gestures */
+	while ( u16_l_idleTime < APP_MENU_TIMEOUT )
+	{
+		/* Check 1: STOP button is pressed, then leave */
+		if ( EVG_TEST_ANY( EVG_U8_STOP ) ) return APP_PRG_PATROL;
+
+		/* Check 2: Poll cut short, then the buttons are not sampled */
+		if ( APP_startupDelay( APP_MENU_POLL ) == STD_NOK ) continue;
+
+		BTN_debounceTask();
+		BTN_getEdges( &u8_l_pressedBtns, &u8_l_releasedBtns );
+		GST_task( u8_l_pressedBtns, u8_l_releasedBtns );
+
+		/* Check 3: Long press chose the shown program, then run it once the button is released */
+		if ( u8_gs_appMenuChosen == STD_OK ) return ( APP_waitMenuRelease() == STD_OK ) ? u8_gs_appMenuProgramId : APP_PRG_PATROL;
+
+		if ( ( u8_l_pressedBtns | u8_l_releasedBtns ) != 0 ) u16_l_idleTime = 0;
+		else                                                  u16_l_idleTime += APP_MENU_POLL;
+	}
+
+	return APP_PRG_PATROL;
+}
+
+/**
+ * @brief Startup menu gestures action, called by GST_task from APP_selectProgram.
+ * A click shows the next program, and so does the second press of a double click ( GST reports no click for it ).
+ * A long press chooses the shown program, if it is the second press of a double click its step is taken back first.
+ * @param[in] u8_a_btnPin  Button pin.
+ * @param[in] u8_a_gesture Gesture ( GST_U8_xxx ).
+ */
+static void APP_onMenuGesture( u8 u8_a_btnPin, u8 u8_a_gesture )
+{
+	if ( u8_a_btnPin != APP_START_BTN ) return;
+
+	switch ( u8_a_gesture )
+	{
+		case GST_U8_PRESS:
+			u8_gs_appMenuSecondPress = STD_NOK;
+			break;
+
+		case GST_U8_CLICK:
+		case GST_U8_DOUBLE_CLICK:
+			if ( u8_a_gesture == GST_U8_DOUBLE_CLICK ) u8_gs_appMenuSecondPress = STD_OK;
+
+			u8_gs_appMenuProgramId = ( u8_gs_appMenuProgramId + 1 ) % APP_PROGRAMS_NUMBER;
+			APP_showProgram( u8_gs_appMenuProgramId );
+			break;
+
+		case GST_U8_LONG_PRESS:
+			if ( u8_gs_appMenuSecondPress == STD_OK ) u8_gs_appMenuProgramId = ( u8_gs_appMenuProgramId + APP_PROGRAMS_NUMBER - 1 ) % APP_PROGRAMS_NUMBER;
+			u8_gs_appMenuChosen = STD_OK;
+			LED_arrayOn( PORT_A, DIO_MASK_BITS_0_1_2_3 );
+			break;
+
+		default:
+			break;
+	}
+}
+
+/**
+ * @brief Waits for the debounced START button to be released, sampling it every APP_MENU_POLL.
+ * @return u8 STD_OK once released, STD_NOK if the STOP button was pressed meanwhile.
+ */
+static u8 APP_waitMenuRelease( void )
+{
+	u8 u8_l_btnsState = BTN_U8_MASK( APP_START_BTN );
+
+	while ( ( u8_l_btnsState & BTN_U8_MASK( APP_START_BTN ) ) != 0 )
+	{
+		if ( EVG_TEST_ANY( EVG_U8_STOP ) ) return STD_NOK;
+
+		if ( APP_startupDelay( APP_MENU_POLL ) == STD_NOK ) continue;
+
+		BTN_debounceTask();
+		BTN_getDebouncedState( &u8_l_btnsState );
+	}
+
+	return STD_OK;
+}
+
+/**
+ * @brief Shows a startup program: program N on LED N.
+ * @param[in] u8_a_programId Program identifier ( APP_PRG_xxx ).
+ */
+static void APP_showProgram( u8 u8_a_programId )
+{
+	LED_arraySet( PORT_A, DIO_MASK_BITS_0_1_2_3, 1 << u8_a_programId );
+}
+
+/**
+ * @brief Calibration program: runs the calibration mode, and keeps the calibrated values for the next power-ups.
+ */
+static void APP_calibrationProgram( void )
+{
+	/* Check 1: Calibration completed */
+	if ( APP_runCalibration() == STD_OK )
+	{
+		APP_saveCalibration();
+	}
+
+	/* STOP aborts the calibration through INT0 */
+	EVG_clear( EVG_U8_STOP );
+	LED_arrayOff( PORT_A, DIO_MASK_BITS_0_1_2_3 );
+}
+
+/**
+ * @brief Diagnostics program: each LED turns on alone, then the car moves forward for APP_CAL_PROBE_DURATION.
+ * Results are shown for APP_DIAG_SHOW msec.: LED 0 on if the encoder counted ticks ( motors and encoder work ),
+ * LED 1 on if the EEPROM mission is valid, and LED 3 on if any check failed.
+ */
+static void APP_diagnosticsProgram( void )
+{
+	u8  u8_l_led;
+	u8  u8_l_results = 0;
+	u16 u16_l_ticks;
+	u16 u16_l_shown;
+
+	/* Step 1: LEDs walk */
+	for ( u8_l_led = 0; u8_l_led < 4; u8_l_led++ )
+	{
+		LED_arraySet( PORT_A, DIO_MASK_BITS_0_1_2_3, 1 << u8_l_led );
+		APP_startupDelay( APP_DIAG_STEP );
+	}
+	LED_arrayOff( PORT_A, DIO_MASK_BITS_0_1_2_3 );
+
+	/* Step 2: Motors and encoder */
+	if ( APP_measureMove( APP_CAL_MOVE_FORWARD, APP_DIAG_DUTY, &u16_l_ticks ) == STD_OK ) u8_l_results |= ( 1 << 0 );
+
+	/* Step 3: Mission */
+	if ( st_gs_appMission.u8_state != MSN_U8_FAULT ) u8_l_results |= ( 1 << 1 );
+
+	/* Step 4: Show the results, a STOP press during the move went through INT0 so release the sudden break */
+	EVG_clear( EVG_U8_STOP );
+	if ( u8_l_results != ( ( 1 << 0 ) | ( 1 << 1 ) ) ) u8_l_results |= ( 1 << APP_STOP_LED );
+	LED_arraySet( PORT_A, DIO_MASK_BITS_0_1_2_3, u8_l_results );
+
+	for ( u16_l_shown = 0; u16_l_shown < APP_DIAG_SHOW; u16_l_shown += APP_DIAG_STEP )
+	{
+		APP_startupDelay( APP_DIAG_STEP );
+	}
+
+	LED_arrayOff( PORT_A, DIO_MASK_BITS_0_1_2_3 );
+}
+
+/**
+ * @brief Teleoperation program: the car starts in the "CAR_TELEOP" mode instead of "CAR_STOP", run by the car task
+ * until power off like the other car modes.
+ */
+static void APP_teleopProgram( void )
+{
+	u8_gs_appFirstMode = APP_CAR_TELEOP;
+}
+
+/* *******************************************************************************************************************/
+/* Calibration */
+
+/**
+ * @brief Checks whether the calibration mode button sequence is entered at power-up.
+ * The sequence is: START button held while powering up, then STOP button pressed within
+ * APP_CAL_ENTRY_WINDOW msec. while START is still held.
+ * @return STD_OK if the sequence is entered, STD_NOK otherwise.
+ */
+static u8 APP_isCalibrationRequested( void )
+{
+	u8  u8_l_btnState = DIO_U8_PIN_HIGH;
+	u16 u16_l_elapsedTime;
+
+	/* Check 1: START button is held ( buttons are active low, pull up enabled ) */
+	u8_l_btnState = DIO_PIN_READ( APP_START_BTN_PIN );
+	if ( u8_l_btnState != DIO_U8_PIN_LOW ) return STD_NOK;
+
+	for ( u16_l_elapsedTime = 0; u16_l_elapsedTime < APP_CAL_ENTRY_WINDOW; u16_l_elapsedTime += APP_CAL_ENTRY_POLL )
+	{
+		/* Check 1.1: START button is released before STOP is pressed, then sequence is aborted */
+		u8_l_btnState = DIO_PIN_READ( APP_START_BTN_PIN );
+		if ( u8_l_btnState != DIO_U8_PIN_LOW ) return STD_NOK;
+
+		/* Check 1.2: STOP button is pressed */
+		u8_l_btnState = DIO_PIN_READ( APP_STOP_BTN_PIN );
+		if ( u8_l_btnState == DIO_U8_PIN_LOW ) return STD_OK;
+
+		APP_startupDelay( APP_CAL_ENTRY_POLL );
+	}
+
+	return STD_NOK;
+}
+
+/**
+ * @brief Runs the calibration test moves, and computes the motion values that give exact
+ * 90 degrees turns and the target segment lengths measured by the wheel encoder.
+ * All LEDs are on while calibrating. The STOP button aborts the calibration.
+ * @return STD_OK if the calibration completed, STD_NOK if it was aborted or no encoder ticks were measured.
+ */
+static u8 APP_runCalibration( void )
+{
+	ST_APP_calibration_t st_l_calibration;
+	u16 u16_l_ticks;
+	u32 u32_l_duration;
+
+	LED_arrayOn( PORT_A, DIO_MASK_BITS_0_1_2_3 );
+
+	/* Step 1: Rotation duration for 90 degrees, at the fixed rotation speed */
+	if ( APP_measureMove( APP_CAL_MOVE_ROTATE, ROTATION_DUTY_CYCLE, &u16_l_ticks ) != STD_OK ) return STD_NOK;
+	u32_l_duration = ( ( u32 ) APP_CAL_ROT_90_TICKS * APP_CAL_PROBE_DURATION ) / u16_l_ticks;
+	if ( ( u32_l_duration == 0 ) || ( u32_l_duration > 0xFFFF ) ) return STD_NOK;
+	st_l_calibration.u16_rotationDuration = ( u16 ) u32_l_duration;
+
+	/* Step 2: Long diagonal duty and duration */
+	if ( APP_calibrateSegment( APP_FWD_LD_DUTY, APP_FWD_LD_DURATION, APP_CAL_FWD_LD_TICKS,
+							   &st_l_calibration.u8_fwdLdDuty, &st_l_calibration.u16_fwdLdDuration ) != STD_OK ) return STD_NOK;
+
+	/* Step 3: Short diagonal duty and duration */
+	if ( APP_calibrateSegment( APP_FWD_SD_DUTY, APP_FWD_SD_DURATION, APP_CAL_FWD_SD_TICKS,
+							   &st_l_calibration.u8_fwdSdDuty, &st_l_calibration.u16_fwdSdDuration ) != STD_OK ) return STD_NOK;
+
+	st_gs_appCalibration = st_l_calibration;
+
+	return STD_OK;
+}
+
+/**
+ * @brief Runs one test move for APP_CAL_PROBE_DURATION msec. and counts the encoder ticks.
+ * @param[in] u8_a_move Move to run ( APP_CAL_MOVE_FORWARD or APP_CAL_MOVE_ROTATE ).
+ * @param[in] u8_a_dutyCycle Forward move speed ( ignored for rotation, which has its own fixed speed ).
+ * @param[out] u16_a_ticks Encoder ticks counted during the move.
+ * @return STD_OK if ticks were counted, STD_NOK if the move was stopped or the encoder did not tick.
+ */
+static u8 APP_measureMove( u8 u8_a_move, u8 u8_a_dutyCycle, u16 *u16_a_ticks )
+{
+	/* Step 1: Let the car settle before measuring */
+	DCM_stopDCM();
+	APP_startupDelay( APP_ROTATION_DELAY );
+	ENC_reset();
+
+	/* Step 2: Run the move for the probe duration */
+	TIMER_timer2Delay( APP_CAL_PROBE_DURATION );
+	if ( u8_a_move == APP_CAL_MOVE_ROTATE )
+	{
+		DCM_rotateDCM();
+	}
+	else
+	{
+		DCM_setDutyCycleOfPWM( u8_a_dutyCycle );
+	}
+	DCM_stopDCM();
+
+	/* Step 3: Read the measured ticks */
+	ENC_getTicks( u16_a_ticks );
+
+	if ( EVG_TEST_ANY( EVG_U8_STOP ) || ( *u16_a_ticks == 0 ) ) return STD_NOK;
+
+	return STD_OK;
+}
+
+/**
+ * @brief Measures a forward segment at its default speed, then computes the speed that covers the
+ * target length in the default duration ( rounded to the 10% PWM resolution ), and the duration
+ * that covers the target length at that speed ( speed is taken as proportional to duty cycle ).
+ * @param[in] u8_a_dutyCycle Default segment speed.
+ * @param[in] u16_a_duration Default segment duration.
+ * @param[in] u16_a_targetTicks Segment target length in encoder ticks.
+ * @param[out] u8_a_calDutyCycle Calibrated segment speed.
+ * @param[out] u16_a_calDuration Calibrated segment duration.
+ * @return STD_OK if the segment was calibrated, STD_NOK otherwise.
+ */
+static u8 APP_calibrateSegment( u8 u8_a_dutyCycle, u16 u16_a_duration, u16 u16_a_targetTicks, u8 *u8_a_calDutyCycle, u16 *u16_a_calDuration )
+{
+	u16 u16_l_ticks;
+	u32 u32_l_dutyCycle;
+	u32 u32_l_duration;
+
+	if ( APP_measureMove( APP_CAL_MOVE_FORWARD, u8_a_dutyCycle, &u16_l_ticks ) != STD_OK ) return STD_NOK;
+
+	/* Step 1: Required speed = default speed * required tick rate / measured tick rate */
+	u32_l_dutyCycle = ( ( u32 ) u8_a_dutyCycle * u16_a_targetTicks * APP_CAL_PROBE_DURATION ) / ( ( u32 ) u16_l_ticks * u16_a_duration );
+	u32_l_dutyCycle = ( ( u32_l_dutyCycle + ( PERIOD_TIME / 2 ) ) / PERIOD_TIME ) * PERIOD_TIME;
+	if ( u32_l_dutyCycle < APP_CAL_MIN_DUTY ) u32_l_dutyCycle = APP_CAL_MIN_DUTY;
+	if ( u32_l_dutyCycle > MAX_DUTY_CYCLE ) u32_l_dutyCycle = MAX_DUTY_CYCLE;
+
+	/* Step 2: Duration = target ticks / tick rate expected at the selected speed */
+	u32_l_duration = ( ( u32 ) u16_a_targetTicks * APP_CAL_PROBE_DURATION * u8_a_dutyCycle ) / ( ( u32 ) u16_l_ticks * u32_l_dutyCycle );
+	if ( ( u32_l_duration == 0 ) || ( u32_l_duration > 0xFFFF ) ) return STD_NOK;
+
+	*u8_a_calDutyCycle = ( u8 ) u32_l_dutyCycle;
+	*u16_a_calDuration = ( u16 ) u32_l_duration;
+
+	return STD_OK;
+}
+
+/**
+ * @brief Computes the checksum protecting the calibration record in EEPROM.
+ * @param[in] st_a_calibration Calibrated motion values.
+ * @return The two's complement of the bytes sum, so that the sum of all bytes and checksum is 0.
+ */
+static u8 APP_getCalibrationChecksum( const ST_APP_calibration_t *st_a_calibration )
+{
+	const u8 *u8_l_bytes = ( const u8 * ) st_a_calibration;
+	u8 u8_l_sum = APP_CAL_MAGIC + APP_CAL_VERSION;
+	u8 u8_l_index;
+
+	for ( u8_l_index = 0; u8_l_index < sizeof( ST_APP_calibration_t ); u8_l_index++ )
+	{
+		u8_l_sum += u8_l_bytes[u8_l_index];
+	}
+
+	return ( u8 ) ( 0 - u8_l_sum );
+}
+
+/**
+ * @brief Loads the calibrated motion values from EEPROM. The compile-time defaults are kept
+ * if no valid record is stored ( blank EEPROM, older record version or corrupted record ).
+ */
+static void APP_loadCalibration( void )
+{
+	ST_APP_calibrationRecord_t st_l_record;
+
+	if ( EEP_readBlock( APP_CAL_EEPROM_ADDRESS, ( u8 * ) &st_l_record, sizeof( st_l_record ) ) != EEP_OK ) return;
+
+	/* Check 1: Record is valid */
+	if ( ( st_l_record.u8_magic == APP_CAL_MAGIC )   &&
+		 ( st_l_record.u8_version == APP_CAL_VERSION ) &&
+		 ( st_l_record.u8_checksum == APP_getCalibrationChecksum( &st_l_record.st_calibration ) ) &&
+		 ( st_l_record.st_calibration.u8_fwdLdDuty <= MAX_DUTY_CYCLE ) &&
+		 ( st_l_record.st_calibration.u8_fwdSdDuty <= MAX_DUTY_CYCLE ) )
+	{
+		st_gs_appCalibration = st_l_record.st_calibration;
+	}
+}
+
+/**
+ * @brief Stores the calibrated motion values into EEPROM.
+ */
+static void APP_saveCalibration( void )
+{
+	ST_APP_calibrationRecord_t st_l_record;
+
+	st_l_record.u8_magic       = APP_CAL_MAGIC;
+	st_l_record.u8_version     = APP_CAL_VERSION;
+	st_l_record.st_calibration = st_gs_appCalibration;
+	st_l_record.u8_checksum    = APP_getCalibrationChecksum( &st_gs_appCalibration );
+
+	EEP_updateBlock( APP_CAL_EEPROM_ADDRESS, ( const u8 * ) &st_l_record, sizeof( st_l_record ) );
+}
+
+/* *******************************************************************************************************************/
+/* Watchdog Reset Report */
+
+/**
+ * @brief Reports a watchdog reset: all LEDs blink APP_RESET_REPORT_BLINKS times, then the LED of the task to blame
+ * is shown for APP_RESET_REPORT_SHOW msec. ( all LEDs if unknown ), and the resets log in EEPROM is updated.
+ * Does nothing after any other reset.
+ */
+static void APP_reportReset( void )
+{
+	ST_APP_resetLog_t st_l_log;
+	u8  u8_l_resetCause;
+	u8  u8_l_taskId;
+	u8  u8_l_blink;
+	u16 u16_l_shown;
+
+	SUP_getResetCause( &u8_l_resetCause, &u8_l_taskId );
+
+	/* Check 1: Not a watchdog reset */
+	if ( ( u8_l_resetCause & WDT_U8_RESET_WATCHDOG ) == 0 ) return;
+
+	/* Step 1: Log it, a blank log reads 0xFF resets */
+	if ( ( EEP_readBlock( APP_RESET_LOG_EEPROM_ADDRESS, ( u8 * ) &st_l_log, sizeof( st_l_log ) ) != EEP_OK ) ||
+		 ( st_l_log.u8_watchdogResets == 0xFF ) ) st_l_log.u8_watchdogResets = 0;
+
+	if ( st_l_log.u8_watchdogResets < 0xFE ) st_l_log.u8_watchdogResets++;
+	st_l_log.u8_lastTaskId = u8_l_taskId;
+
+	EEP_updateBlock( APP_RESET_LOG_EEPROM_ADDRESS, ( const u8 * ) &st_l_log, sizeof( st_l_log ) );
+
+	/* Step 2: Blink all LEDs */
+	for ( u8_l_blink = 0; u8_l_blink < APP_RESET_REPORT_BLINKS; u8_l_blink++ )
+	{
+		LED_arrayOn( PORT_A, DIO_MASK_BITS_0_1_2_3 );
+		APP_startupDelay( APP_RESET_REPORT_STEP );
+		LED_arrayOff( PORT_A, DIO_MASK_BITS_0_1_2_3 );
+		APP_startupDelay( APP_RESET_REPORT_STEP );
+	}
+
+	/* Step 3: Show the task to blame, task N on LED N */
+	if ( u8_l_taskId != SUP_U8_NO_TASK ) LED_on( PORT_A, u8_l_taskId );
+	else                                 LED_arrayOn( PORT_A, DIO_MASK_BITS_0_1_2_3 );
+
+	for ( u16_l_shown = 0; u16_l_shown < APP_RESET_REPORT_SHOW; u16_l_shown += APP_RESET_REPORT_STEP )
+	{
+		APP_startupDelay( APP_RESET_REPORT_STEP );
+	}
+
+	LED_arrayOff( PORT_A, DIO_MASK_BITS_0_1_2_3 );
 }
\ No newline at end of file
@@ -32,6 +32,9 @@
 #define BTN_U8_7	7
 #define BTN_U8_8	8
 
+/* Debounced buttons bitmap of a pin, bit n is pin n of the debounced port */
+#define BTN_U8_MASK( PIN )	( ( u8 ) ( 1 << ( PIN ) ) )
+
 /* ***********************************************************************************************/
 /* BTN Functions' Prototypes */
 
@@ -39,6 +42,51 @@ u8 BTN_init(u8 u8_a_pinNumber, EN_DIO_PORT_T en_a_portNumber);
 
 u8 BTN_getBtnState(u8 u8_a_btnId, u8 *u8ptr_a_returnedBtnState);
 
+/*
+ * Debounce engine: the whole port is sampled at once every BTN_debounceTask call, and all its 8 pins are debounced
+ * in parallel by a 2-bit vertical counter per pin ( bit n of two bytes ), so a pin changes its debounced state only
+ * after 4 equal samples in a row, with a handful of instructions per call whatever the
+ * number of buttons. Buttons are active low ( pull up enabled by BTN_init ): in all the bitmaps, 1 means pressed.
+ * All functions are for the main loop ( scheduler tasks ) only.
+ */
+
+/**
+ * @brief Initializes the debounce engine on a port. The current pins state is taken as the debounced state,
+ * so a button held at initialization does not report a press edge.
+ *
+ * @param[in] en_a_portNumber The port the buttons are connected to (PORT_A, PORT_B, PORT_C or PORT_D).
+ * @param[in] u8_a_btnsMask   Pins of the port that are buttons ( BTN_U8_MASK ), the other pins are never reported.
+ *
+ * @return STD_OK if the engine was initialized, STD_NOK if the port is invalid.
+ */
+u8 BTN_debounceInit(EN_DIO_PORT_T en_a_portNumber, u8 u8_a_btnsMask);
+
+/**
+ * @brief Samples the port and updates the debounced state, and the press and release edges.
+ * Call it periodically, e.g. from a 10 msec. task: a press is then reported 30 to 40 msec. after the contact settles.
+ */
+void BTN_debounceTask(void);
+
+/**
+ * @brief Gets the debounced buttons state.
+ *
+ * @param[out] u8ptr_a_btnsState Pointer to where the bitmap of the pressed buttons will be stored.
+ *
+ * @return STD_OK if the state was stored, STD_NOK if the pointer is NULL.
+ */
+u8 BTN_getDebouncedState(u8 *u8ptr_a_btnsState);
+
+/**
+ * @brief Gets the press and release edges detected since the last call, then clears them.
+ * Edges are kept until read, so a consumer slower than the debounce task does not miss any.
+ *
+ * @param[out] u8ptr_a_pressedBtns  Pointer to where the bitmap of the buttons pressed since the last call will be stored.
+ * @param[out] u8ptr_a_releasedBtns Pointer to where the bitmap of the buttons released since the last call will be stored.
+ *
+ * @return STD_OK if the edges were stored, STD_NOK if a pointer is NULL.
+ */
+u8 BTN_getEdges(u8 *u8ptr_a_pressedBtns, u8 *u8ptr_a_releasedBtns);
+
 /* ***********************************************************************************************/
 
 #endif /* BTN_INTERFACE_H_ */
\ No newline at end of file
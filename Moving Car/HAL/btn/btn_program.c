@@ -10,6 +10,22 @@
 #include "btn_config.h"
 #include "btn_interface.h"
 
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+/* Debounced port, and its buttons pins */
+static EN_DIO_PORT_T en_gs_btnPort = PORT_A;
+static u8 u8_gs_btnMask = 0;
+
+/* Debounced state, the two bits of each pin's vertical counter, and the edges not read yet ( 1: pressed ) */
+static u8 u8_gs_btnState = 0;
+static u8 u8_gs_btnCount0 = 0xFF;
+static u8 u8_gs_btnCount1 = 0xFF;
+static u8 u8_gs_btnPressed = 0;
+static u8 u8_gs_btnReleased = 0;
+
+/* ***********************************************************************************************/
+
 /**
  * @brief Initialize a GPIO pin as an input pin for button (pull up enabled by default)
  *
@@ -84,4 +100,95 @@ u8 BTN_getBtnState(u8 u8_a_btnId, u8 *u8ptr_a_returnedBtnState) {
     return Loc_u8ErrorState;
 }
 
-/* ***********************************************************************************************/
\ No newline at end of file
+/* ***********************************************************************************************/
+
+/**
+ * @brief Initializes the debounce engine on a port. The current pins state is taken as the debounced state,
+ * so a button held at initialization does not report a press edge.
+ *
+ * @param[in] en_a_portNumber The port the buttons are connected to (PORT_A, PORT_B, PORT_C or PORT_D).
+ * @param[in] u8_a_btnsMask   Pins of the port that are buttons ( BTN_U8_MASK ), the other pins are never reported.
+ *
+ * @return STD_OK if the engine was initialized, STD_NOK if the port is invalid.
+ */
+u8 BTN_debounceInit(EN_DIO_PORT_T en_a_portNumber, u8 u8_a_btnsMask) {
+    u8 u8_l_pins;
+
+    /* Check 1: Port is valid */
+    if (DIO_portRead(en_a_portNumber, &u8_l_pins) != DIO_OK) return STD_NOK;
+
+    en_gs_btnPort = en_a_portNumber;
+    u8_gs_btnMask = u8_a_btnsMask;
+
+    /* Step 1: Start from the current state, with all counters reset and no edge */
+    u8_gs_btnState = (u8) ~u8_l_pins & u8_a_btnsMask;
+    u8_gs_btnCount0 = 0xFF;
+    u8_gs_btnCount1 = 0xFF;
+    u8_gs_btnPressed = 0;
+    u8_gs_btnReleased = 0;
+
+    return STD_OK;
+}
+
+/**
+ * @brief Samples the port and updates the debounced state, and the press and release edges.
+ * Call it periodically, e.g. from a 10 msec. task: a press is then reported 30 to 40 msec. after the contact settles.
+ */
+void BTN_debounceTask(void) {
+    u8 u8_l_pins;
+    u8 u8_l_changed;
+
+    DIO_portRead(en_gs_btnPort, &u8_l_pins);
+
+    /* Step 1: Pins whose sample differs from their debounced state */
+    u8_l_changed = u8_gs_btnState ^ ((u8) ~u8_l_pins & u8_gs_btnMask);
+
+    /* Step 2: Count the differing pins ( 3, 2, 1, 0 ), reset the counters of the others to 3 */
+    u8_gs_btnCount0 = ~(u8_gs_btnCount0 & u8_l_changed);
+    u8_gs_btnCount1 = u8_gs_btnCount0 ^ (u8_gs_btnCount1 & u8_l_changed);
+
+    /* Step 3: Counters rolled over from 0 to 3, the pin differed for 4 samples in a row: toggle its state */
+    u8_l_changed &= u8_gs_btnCount0 & u8_gs_btnCount1;
+    u8_gs_btnState ^= u8_l_changed;
+
+    /* Step 4: Keep the edges until read */
+    u8_gs_btnPressed |= u8_gs_btnState & u8_l_changed;
+    u8_gs_btnReleased |= (u8) ~u8_gs_btnState & u8_l_changed;
+}
+
+/**
+ * @brief Gets the debounced buttons state.
+ *
+ * @param[out] u8ptr_a_btnsState Pointer to where the bitmap of the pressed buttons will be stored.
+ *
+ * @return STD_OK if the state was stored, STD_NOK if the pointer is NULL.
+ */
+u8 BTN_getDebouncedState(u8 *u8ptr_a_btnsState) {
+    if (u8ptr_a_btnsState == NULL) return STD_NOK;
+
+    *u8ptr_a_btnsState = u8_gs_btnState;
+
+    return STD_OK;
+}
+
+/**
+ * @brief Gets the press and release edges detected since the last call, then clears them.
+ * Edges are kept until read, so a consumer slower than the debounce task does not miss any.
+ *
+ * @param[out] u8ptr_a_pressedBtns  Pointer to where the bitmap of the buttons pressed since the last call will be stored.
+ * @param[out] u8ptr_a_releasedBtns Pointer to where the bitmap of the buttons released since the last call will be stored.
+ *
+ * @return STD_OK if the edges were stored, STD_NOK if a pointer is NULL.
+ */
+u8 BTN_getEdges(u8 *u8ptr_a_pressedBtns, u8 *u8ptr_a_releasedBtns) {
+    if ((u8ptr_a_pressedBtns == NULL) || (u8ptr_a_releasedBtns == NULL)) return STD_NOK;
+
+    *u8ptr_a_pressedBtns = u8_gs_btnPressed;
+    *u8ptr_a_releasedBtns = u8_gs_btnReleased;
+    u8_gs_btnPressed = 0;
+    u8_gs_btnReleased = 0;
+
+    return STD_OK;
+}
+
+/* ***********************************************************************************************/
@@ -23,18 +23,28 @@
 				  -------------- 				  ----------				| 	 (OC1A) PD5|---------------->|CCW       |
 																			  --------------                   ----------
   */
+  /* Pins are compile-time descriptors: DIO_PIN( port letter A -> D, pin 0 -> 7 ), see MCAL/dio/dio_interface.h
+   * Both motors must share one port: the PWM pins are driven together through one port write */
   /********************* Motor_0 Configurations ***********************/
-#define	    MOT0_EN_PIN_NUMBER_0				4
-#define		MOT0_EN_PIN_NUMBER_1				5	
-#define		MOT0_PWM_PIN_NUMBER					0
-#define		MOT0_EN_PORT_NUMBER					PORT_C
-#define		MOT0_PWM_PORT_NUMBER				PORT_C
+#define		MOT0_EN_PIN_0						DIO_PIN( C, 4 )
+#define		MOT0_EN_PIN_1						DIO_PIN( C, 5 )
+#define		MOT0_PWM_PIN						DIO_PIN( C, 0 )
  /********************* Motor_1 Configurations ***********************/
-#define	    MOT1_EN_PIN_NUMBER_0				6
-#define		MOT1_EN_PIN_NUMBER_1				7
-#define		MOT1_PWM_PIN_NUMBER					1
-#define		MOT1_EN_PORT_NUMBER					PORT_C
-#define		MOT1_PWM_PORT_NUMBER				PORT_C
+#define		MOT1_EN_PIN_0						DIO_PIN( C, 6 )
+#define		MOT1_EN_PIN_1						DIO_PIN( C, 7 )
+#define		MOT1_PWM_PIN						DIO_PIN( C, 1 )
+
+/* Runtime pin numbers and ports, for the motors table */
+#define	    MOT0_EN_PIN_NUMBER_0				DIO_PIN_NUMBER( MOT0_EN_PIN_0 )
+#define		MOT0_EN_PIN_NUMBER_1				DIO_PIN_NUMBER( MOT0_EN_PIN_1 )
+#define		MOT0_PWM_PIN_NUMBER					DIO_PIN_NUMBER( MOT0_PWM_PIN )
+#define		MOT0_EN_PORT_NUMBER					DIO_PIN_PORT( MOT0_EN_PIN_0 )
+#define		MOT0_PWM_PORT_NUMBER				DIO_PIN_PORT( MOT0_PWM_PIN )
+#define	    MOT1_EN_PIN_NUMBER_0				DIO_PIN_NUMBER( MOT1_EN_PIN_0 )
+#define		MOT1_EN_PIN_NUMBER_1				DIO_PIN_NUMBER( MOT1_EN_PIN_1 )
+#define		MOT1_PWM_PIN_NUMBER					DIO_PIN_NUMBER( MOT1_PWM_PIN )
+#define		MOT1_EN_PORT_NUMBER					DIO_PIN_PORT( MOT1_EN_PIN_0 )
+#define		MOT1_PWM_PORT_NUMBER				DIO_PIN_PORT( MOT1_PWM_PIN )
 
 /* End of Configurations */
 
@@ -16,10 +16,12 @@
 /* LIB */
 #include "../../LIB/std.h"
 #include "../../LIB/bit_math.h"
+#include "../../LIB/evg.h"
 
 /* MCAL */
 #include "../../MCAL/dio/dio_interface.h"
 #include "../../MCAL/timer/timer_interface.h"
+#include "../../MCAL/gli/gli_interface.h"
 
 /* ***********************************************************************************************/
 /* DCM Macros */
@@ -55,18 +57,24 @@ typedef enum {
 	FALSE,
 	TRUE
 }EN_DCM_FLAG;
+
+/* Timer2 delay ended, raised from the Timer2 overflow ISR */
+extern EN_DCM_FLAG en_g_stopFlag;
+
+/* Raises the stop flag from the Timer2 overflow ISR: inlined in the vector when bound at compile time ( APP/app_bindings.h ) */
+#define DCM_UPDATE_STOP_FLAG_FROM_ISR()	( en_g_stopFlag = TRUE )
 /* ***********************************************************************************************/
 /* DCM Functions' Prototypes */
 
 /**
  * @brief Initialize the DC Motors by initializing their pins.
  *
- * @param u8_a_shutdownFlag Pointer to the Shutdown flag variable that acts as a main kill switch.
+ * @param u8_a_stopFlags System flags ( EVG_U8_xxx ) that act as a main kill switch, any of them raised is a shutdown.
  *
  * @return EN_DCM_ERROR_T Returns DCM_OK if initialization is successful, or DCM_ERROR if initialization failed.
  *
  */
-EN_DCM_ERROR_T DCM_motorInit(u8 ** u8_a_shutdownFlag);
+EN_DCM_ERROR_T DCM_motorInit(u8 u8_a_stopFlags);
 
 
 /**
@@ -105,6 +113,8 @@ EN_DCM_ERROR_T DCM_setDutyCycleOfPWM(u8 u8_a_dutyCycleValue);
 
 /**
  * @brief Stops the DC motors by setting the PWM output pins to low and resetting the stop flag.
+ * A non-blocking move in progress is ended, and a reversed rotation direction is restored.
+ * A move cut by the shutdown flag is kept, so DCM_resumeMove can finish it.
  */
 void DCM_stopDCM(void);
 
@@ -117,6 +127,55 @@ void DCM_stopDCM(void);
  */
 void DCM_updateStopFlag(void);
 
+/**
+ * @brief Starts moving the car forward for a given duration, without blocking.
+ *
+ * The motors are driven by DCM_pwmTask, which must be called every 1 msec. The motors are
+ * stopped by DCM_pwmTask when the duration elapses, or when the shutdown flag is raised.
+ *
+ * @param u8_a_dutyCycleValue The duty cycle value for the motors ( 0 to 100 ).
+ * @param u16_a_duration The move duration in msec.
+ * @return EN_DCM_ERROR_T DCM_OK if the move is started, DCM_ERROR if the duty cycle is out of range.
+ */
+EN_DCM_ERROR_T DCM_startMove(u8 u8_a_dutyCycleValue, u16 u16_a_duration);
+
+/**
+ * @brief Starts rotating the car to the right for a given duration, without blocking.
+ *
+ * The right motor direction is reversed, and it is restored when the motors are stopped.
+ *
+ * @param u16_a_duration The rotation duration in msec.
+ * @return EN_DCM_ERROR_T DCM_OK if the rotation is started, DCM_ERROR if the shutdown flag is raised.
+ */
+EN_DCM_ERROR_T DCM_startRotation(u16 u16_a_duration);
+
+/**
+ * @brief Software PWM step of the non-blocking moves, must be called every 1 msec.
+ *
+ * Drives the PWM pins of a move started by DCM_startMove/DCM_startRotation ( PERIOD_TIME msec. period ),
+ * and stops the motors when the move duration elapses or the shutdown flag is raised.
+ */
+void DCM_pwmTask(void);
+
+/**
+ * @brief Checks whether a non-blocking move is in progress.
+ *
+ * @return EN_DCM_FLAG TRUE if a move started by DCM_startMove/DCM_startRotation is in progress, FALSE otherwise.
+ */
+EN_DCM_FLAG DCM_isMoving(void);
+
+/**
+ * @brief Finishes the move cut by the shutdown flag: same speed and direction, for the time it had left.
+ *
+ * @return EN_DCM_ERROR_T DCM_OK if the move is restarted, DCM_ERROR if no move was cut or the shutdown flag is raised.
+ */
+EN_DCM_ERROR_T DCM_resumeMove(void);
+
+/**
+ * @brief Forgets the move cut by the shutdown flag, DCM_resumeMove then has nothing to finish.
+ */
+void DCM_discardCutMove(void);
+
 //u8 DCM_u8GetDutyCycleOfPWM(u8* Cpy_pu8ReturnedDutyCycleValue);
 /* ***********************************************************************************************/
 
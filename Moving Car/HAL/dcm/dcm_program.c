@@ -24,26 +24,52 @@ ST_DCM_g_Config_t st_g_carMotors[2] =
 
 EN_DCM_FLAG en_g_stopFlag = FALSE;
 
-u8 * u8_g_shutdownFlag = NULL;
+/* Subscribed system flags ( EVG_U8_xxx ), the shutdown flag is raised when any of them is */
+static u8 u8_gs_stopFlags = 0;
+
+/* PWM pins of both motors, driven together */
+#define DCM_U8_PWM_PINS_MASK	( ( 1 << MOT0_PWM_PIN_NUMBER ) | ( 1 << MOT1_PWM_PIN_NUMBER ) )
+
+/* The INT0 fast path ( MCAL/exi/exi_config.h ) clears the PWM pins at any time, and raises the shutdown flag:
+ * every read-modify-write of the motors port runs with interrupts disabled, and the PWM pins are only set high
+ * while the shutdown flag is down, so a stop is never written back high. */
+#define DCM_SHUTDOWN_RAISED()	EVG_TEST_ANY( u8_gs_stopFlags )
+
+/* Non-blocking move state, driven by DCM_pwmTask */
+static EN_DCM_FLAG en_gs_moving = FALSE;
+static EN_DCM_FLAG en_gs_rotating = FALSE;
+static u16 u16_gs_moveTimeLeft = 0;
+static u8 u8_gs_pwmOnTime = 0;
+static u8 u8_gs_pwmCounter = 0;
+static u8 u8_gs_moveDuty = 0;
+
+/* Move cut by the shutdown flag, kept for DCM_resumeMove */
+static EN_DCM_FLAG en_gs_cutMove = FALSE;
+static EN_DCM_FLAG en_gs_cutRotating = FALSE;
+static u8 u8_gs_cutDuty = 0;
+static u16 u16_gs_cutTimeLeft = 0;
 
 /* ***********************************************************************************************/
 
 /**
  * @brief Initialize the DC Motors by initializing their pins.
  *
- * @param u8_a_shutdownFlag Pointer to the Shutdown flag variable that acts as a main kill switch.
+ * @param u8_a_stopFlags System flags ( EVG_U8_xxx ) that act as a main kill switch, any of them raised is a shutdown.
  *
  * @return EN_DCM_ERROR_T Returns DCM_OK if initialization is successful, or DCM_ERROR if initialization failed.
  *
  */
-EN_DCM_ERROR_T DCM_motorInit(u8 ** u8_a_shutdownFlag)
+EN_DCM_ERROR_T DCM_motorInit(u8 u8_a_stopFlags)
 {
-    u8_g_shutdownFlag = *u8_a_shutdownFlag;
+    u8_gs_stopFlags = u8_a_stopFlags;
 	/*if (st_g_carMotors == NULL)
 		return DCM_ERROR;
 	else
 	{*/
     u8 u8_a_loopCounter;
+    ST_DIO_transaction_t st_l_transaction;
+
+    DIO_beginTransaction(&st_l_transaction);
     for (u8_a_loopCounter = 0; u8_a_loopCounter < MOTORS_NUMBER; u8_a_loopCounter++)
     {
         DIO_init(st_g_carMotors[u8_a_loopCounter].DCM_g_motEnPinNumber0,
@@ -56,14 +82,15 @@ EN_DCM_ERROR_T DCM_motorInit(u8 ** u8_a_shutdownFlag)
             st_g_carMotors[u8_a_loopCounter].DCM_g_motEnPortNumber,
             DIO_OUT);
 			
-		DIO_write(st_g_carMotors[u8_a_loopCounter].DCM_g_motEnPinNumber0,
+		DIO_stagePin(&st_l_transaction, st_g_carMotors[u8_a_loopCounter].DCM_g_motEnPinNumber0,
 			st_g_carMotors[u8_a_loopCounter].DCM_g_motEnPortNumber,
 			DIO_U8_PIN_HIGH);
-		DIO_write(st_g_carMotors[u8_a_loopCounter].DCM_g_motEnPinNumber1,
+		DIO_stagePin(&st_l_transaction, st_g_carMotors[u8_a_loopCounter].DCM_g_motEnPinNumber1,
 			st_g_carMotors[u8_a_loopCounter].DCM_g_motEnPortNumber,
-			DIO_U8_PIN_LOW);	
-			
+			DIO_U8_PIN_LOW);
     }
+    /* forward direction of both motors in one write */
+    DIO_commitTransaction(&st_l_transaction);
 //	}
     TIMER_ovfSetCallback(DCM_updateStopFlag);
     return DCM_OK;
@@ -83,24 +110,45 @@ EN_DCM_ERROR_T DCM_changeDCMDirection(EN_DCM_MOTORSIDE en_a_motorNum)
 	//else
 	//{
 
-		DIO_toggle(st_g_carMotors[en_a_motorNum].DCM_g_motEnPinNumber0,
-			st_g_carMotors[en_a_motorNum].DCM_g_motEnPortNumber
-		);
-		DIO_toggle(st_g_carMotors[en_a_motorNum].DCM_g_motEnPinNumber1,
-			st_g_carMotors[en_a_motorNum].DCM_g_motEnPortNumber
-		);
+		ST_DIO_transaction_t st_l_transaction;
+
+		/* both enable pins switch in one port write, the motor never passes through a brake or coast state,
+		 * and the write runs with interrupts disabled so an ISR write to the motors port cannot be lost */
+		DIO_beginTransaction(&st_l_transaction);
+		DIO_stageToggle(&st_l_transaction, st_g_carMotors[en_a_motorNum].DCM_g_motEnPortNumber,
+			(1 << st_g_carMotors[en_a_motorNum].DCM_g_motEnPinNumber0) | (1 << st_g_carMotors[en_a_motorNum].DCM_g_motEnPinNumber1));
+		DIO_commitTransaction(&st_l_transaction);
 	//}
 	return DCM_OK;
 }
 
 /**
  * @brief Stops the DC motors by setting the PWM output pins to low and resetting the stop flag.
+ * A non-blocking move in progress is ended, and a reversed rotation direction is restored.
+ * A move cut by the shutdown flag is kept, so DCM_resumeMove can finish it.
  */
 void DCM_stopDCM(void)
 {
-	DIO_write(st_g_carMotors[0].DCM_g_motPWMPinNumber, st_g_carMotors[0].DCM_g_motPWMPortNumber, DIO_U8_PIN_LOW);
-	DIO_write(st_g_carMotors[1].DCM_g_motPWMPinNumber, st_g_carMotors[1].DCM_g_motPWMPortNumber, DIO_U8_PIN_LOW);
+	/* one CBI each, no critical section needed */
+	DIO_PIN_CLEAR(MOT0_PWM_PIN);
+	DIO_PIN_CLEAR(MOT1_PWM_PIN);
     en_g_stopFlag = FALSE;
+
+    if (en_gs_moving == TRUE && u16_gs_moveTimeLeft != 0 && DCM_SHUTDOWN_RAISED())
+    {
+        en_gs_cutMove = TRUE;
+        en_gs_cutRotating = en_gs_rotating;
+        u8_gs_cutDuty = u8_gs_moveDuty;
+        u16_gs_cutTimeLeft = u16_gs_moveTimeLeft;
+    }
+
+    en_gs_moving = FALSE;
+    u16_gs_moveTimeLeft = 0;
+    if (en_gs_rotating == TRUE)
+    {
+        DCM_changeDCMDirection(MOTOR_RIGHT);
+        en_gs_rotating = FALSE;
+    }
 }
 
 /* ***********************************************************************************************/
@@ -127,12 +175,16 @@ EN_DCM_ERROR_T DCM_setDutyCycleOfPWM(u8 u8_a_dutyCycleValue)
 		u8 DCM_a_mappedDuty = u8_a_dutyCycleValue / PERIOD_TIME;
 		u16 u16_onTime = DCM_a_mappedDuty;
 		u16 u16_offTime = PERIOD_TIME - DCM_a_mappedDuty;
+		u8 u8_l_sreg;
 
-		while (en_g_stopFlag != TRUE && (u8_g_shutdownFlag == NULL || *u8_g_shutdownFlag == 0))
+		while (en_g_stopFlag != TRUE && !DCM_SHUTDOWN_RAISED())
 		{
-			DIO_portWrite(st_g_carMotors[0].DCM_g_motEnPortNumber, DIO_U8_PORT_HIGH, DIO_MASK_BITS_0_1);
+			GLI_ENTER_CRITICAL(u8_l_sreg, GLI_U8_SITE_DCM_PWM);
+			if (!DCM_SHUTDOWN_RAISED())
+				DIO_portWrite(st_g_carMotors[0].DCM_g_motEnPortNumber, DIO_U8_PORT_HIGH, DIO_MASK_BITS_0_1);
+			GLI_EXIT_CRITICAL(u8_l_sreg);
 			TIMER_timer0Delay(u16_onTime);
-			DIO_portWrite(st_g_carMotors[0].DCM_g_motEnPortNumber, DIO_U8_PORT_LOW, DIO_MASK_BITS_0_1);
+			DIO_portWriteAtomic(st_g_carMotors[0].DCM_g_motEnPortNumber, DIO_U8_PORT_LOW, DIO_MASK_BITS_0_1);
 			TIMER_timer0Delay(u16_offTime);
 		}
 		en_g_stopFlag = FALSE;
@@ -149,7 +201,7 @@ EN_DCM_ERROR_T DCM_setDutyCycleOfPWM(u8 u8_a_dutyCycleValue)
  */
 void DCM_updateStopFlag(void)
 {
-	en_g_stopFlag = TRUE;
+	DCM_UPDATE_STOP_FLAG_FROM_ISR();
 }
 
 /**
@@ -163,9 +215,123 @@ void DCM_updateStopFlag(void)
  */
 EN_DCM_ERROR_T DCM_rotateDCM()
 {
-    if(u8_g_shutdownFlag != NULL && *u8_g_shutdownFlag == 1) return DCM_ERROR;
+    if (DCM_SHUTDOWN_RAISED()) return DCM_ERROR;
 	DCM_changeDCMDirection(MOTOR_RIGHT);
 	DCM_setDutyCycleOfPWM (ROTATION_DUTY_CYCLE);
 	DCM_changeDCMDirection(MOTOR_RIGHT);
     return DCM_OK;
 }
+
+/* ***********************************************************************************************/
+
+/**
+ * @brief Starts moving the car forward for a given duration, without blocking.
+ *
+ * The motors are driven by DCM_pwmTask, which must be called every 1 msec. The motors are
+ * stopped by DCM_pwmTask when the duration elapses, or when the shutdown flag is raised.
+ *
+ * @param u8_a_dutyCycleValue The duty cycle value for the motors ( 0 to 100 ).
+ * @param u16_a_duration The move duration in msec.
+ * @return EN_DCM_ERROR_T DCM_OK if the move is started, DCM_ERROR if the duty cycle is out of range.
+ */
+EN_DCM_ERROR_T DCM_startMove(u8 u8_a_dutyCycleValue, u16 u16_a_duration)
+{
+    if (u8_a_dutyCycleValue > MAX_DUTY_CYCLE)
+        return DCM_ERROR;
+
+    /* a new move replaces a cut one */
+    en_gs_cutMove = FALSE;
+
+    /* same mapping as DCM_setDutyCycleOfPWM: on-time in msec. out of PERIOD_TIME msec. */
+    u8_gs_moveDuty = u8_a_dutyCycleValue;
+    u8_gs_pwmOnTime = u8_a_dutyCycleValue / PERIOD_TIME;
+    u8_gs_pwmCounter = 0;
+    u16_gs_moveTimeLeft = u16_a_duration;
+    en_gs_moving = TRUE;
+    return DCM_OK;
+}
+
+/**
+ * @brief Starts rotating the car to the right for a given duration, without blocking.
+ *
+ * The right motor direction is reversed, and it is restored when the motors are stopped.
+ *
+ * @param u16_a_duration The rotation duration in msec.
+ * @return EN_DCM_ERROR_T DCM_OK if the rotation is started, DCM_ERROR if the shutdown flag is raised.
+ */
+EN_DCM_ERROR_T DCM_startRotation(u16 u16_a_duration)
+{
+    if (DCM_SHUTDOWN_RAISED()) return DCM_ERROR;
+
+    if (en_gs_rotating == FALSE)
+    {
+        DCM_changeDCMDirection(MOTOR_RIGHT);
+        en_gs_rotating = TRUE;
+    }
+    return DCM_startMove(ROTATION_DUTY_CYCLE, u16_a_duration);
+}
+
+/**
+ * @brief Software PWM step of the non-blocking moves, must be called every 1 msec.
+ *
+ * Drives the PWM pins of a move started by DCM_startMove/DCM_startRotation ( PERIOD_TIME msec. period ),
+ * and stops the motors when the move duration elapses or the shutdown flag is raised.
+ */
+void DCM_pwmTask(void)
+{
+    u8 u8_l_sreg;
+
+    if (en_gs_moving == FALSE) return;
+
+    /* move ended, or sudden break */
+    if (u16_gs_moveTimeLeft == 0 || DCM_SHUTDOWN_RAISED())
+    {
+        DCM_stopDCM();
+        return;
+    }
+    u16_gs_moveTimeLeft--;
+
+    GLI_ENTER_CRITICAL(u8_l_sreg, GLI_U8_SITE_DCM_PWM);
+    if (u8_gs_pwmCounter < u8_gs_pwmOnTime && !DCM_SHUTDOWN_RAISED())
+        DIO_portWrite(st_g_carMotors[0].DCM_g_motEnPortNumber, DIO_U8_PORT_HIGH, DCM_U8_PWM_PINS_MASK);
+    else
+        DIO_portWrite(st_g_carMotors[0].DCM_g_motEnPortNumber, DIO_U8_PORT_LOW, DCM_U8_PWM_PINS_MASK);
+    GLI_EXIT_CRITICAL(u8_l_sreg);
+
+    u8_gs_pwmCounter++;
+    if (u8_gs_pwmCounter >= PERIOD_TIME) u8_gs_pwmCounter = 0;
+}
+
+/**
+ * @brief Finishes the move cut by the shutdown flag: same speed and direction, for the time it had left.
+ *
+ * @return EN_DCM_ERROR_T DCM_OK if the move is restarted, DCM_ERROR if no move was cut or the shutdown flag is raised.
+ */
+EN_DCM_ERROR_T DCM_resumeMove(void)
+{
+    if (en_gs_cutMove == FALSE || DCM_SHUTDOWN_RAISED()) return DCM_ERROR;
+
+    /* starting the move clears the cut one */
+    if (en_gs_cutRotating == TRUE)
+        return DCM_startRotation(u16_gs_cutTimeLeft);
+    else
+        return DCM_startMove(u8_gs_cutDuty, u16_gs_cutTimeLeft);
+}
+
+/**
+ * @brief Forgets the move cut by the shutdown flag, DCM_resumeMove then has nothing to finish.
+ */
+void DCM_discardCutMove(void)
+{
+    en_gs_cutMove = FALSE;
+}
+
+/**
+ * @brief Checks whether a non-blocking move is in progress.
+ *
+ * @return EN_DCM_FLAG TRUE if a move started by DCM_startMove/DCM_startRotation is in progress, FALSE otherwise.
+ */
+EN_DCM_FLAG DCM_isMoving(void)
+{
+    return en_gs_moving;
+}
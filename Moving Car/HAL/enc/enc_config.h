@@ -0,0 +1,41 @@
+/*
+ * enc_config.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Wheel Encoder (ENC) pre-build configurations, through which user can configure before using the ENC peripheral.
+ */
+
+#ifndef ENC_CONFIG_H_
+#define ENC_CONFIG_H_
+
+/* ***********************************************************************************************/
+/* ATmega32(L) interfacing with the wheel encoder: */
+/*
+				  --------------                   -----------
+				 |   ATmega32   |                 |  Encoder  |
+				 |              |                 |           |
+				 | 	(INT2) PB2  |<----------------|  Pulse    |
+				  --------------                   -----------
+ */
+
+/* ***********************************************************************************************/
+/* ENC Configurations */
+
+/* The External Interrupt connected to the encoder pulse output */
+/* Options: EXI_U8_INT0, EXI_U8_INT1, EXI_U8_INT2 */
+#define ENC_U8_EXI_ID			EXI_U8_INT2
+
+/* The Port/Pin connected to the encoder pulse output ( must match the selected External Interrupt pin ) */
+#define ENC_U8_PORT				PORT_B
+#define ENC_U8_PIN				DIO_U8_PIN_2
+
+/* The edge counted as one encoder tick */
+/* Options: EXI_U8_SENSE_FALLING_EDGE, EXI_U8_SENSE_RISING_EDGE */
+#define ENC_U8_SENSE_EDGE		EXI_U8_SENSE_RISING_EDGE
+
+/* End of Configurations */
+
+/* ***********************************************************************************************/
+
+#endif /* ENC_CONFIG_H_ */
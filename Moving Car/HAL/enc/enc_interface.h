@@ -0,0 +1,68 @@
+/*
+ * enc_interface.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Wheel Encoder (ENC) functions' prototypes and definitions (Macros) to avoid magic numbers.
+ */
+
+#ifndef ENC_INTERFACE_H_
+#define ENC_INTERFACE_H_
+
+/* ***********************************************************************************************/
+/* ENC Includes */
+
+/* LIB */
+#include "../../LIB/std.h"
+#include "../../LIB/bit_math.h"
+
+/* MCAL */
+#include "../../MCAL/dio/dio_interface.h"
+#include "../../MCAL/exi/exi_interface.h"
+
+/* ***********************************************************************************************/
+/* ENC Macros */
+
+typedef enum {
+	ENC_OK,
+	ENC_ERROR
+}EN_ENC_ERROR_T;
+
+/* Number of encoder ticks since the last reset, written only by the encoder ISR and ENC_reset */
+extern volatile u16 u16_g_encTicks;
+
+/* Counts one encoder tick, from the encoder ISR: inlined in the vector when bound at compile time ( APP/app_bindings.h ) */
+#define ENC_COUNT_TICK_FROM_ISR()	( u16_g_encTicks++ )
+
+/* ***********************************************************************************************/
+/* ENC Functions' Prototypes */
+
+/**
+ * @brief Initializes the wheel encoder input pin and its external interrupt, and clears the tick counter.
+ *
+ * @return EN_ENC_ERROR_T ENC_OK if the encoder was initialized successfully, ENC_ERROR otherwise.
+ */
+EN_ENC_ERROR_T ENC_init    ( void );
+
+/**
+ * @brief Clears the encoder tick counter.
+ *
+ * @note Call it while the wheels are stopped, the 16-bit clear is not atomic against the encoder ISR.
+ */
+void           ENC_reset   ( void );
+
+/**
+ * @brief Reads the number of encoder ticks counted since the last reset.
+ *
+ * The counter is updated from the encoder ISR, so it is read twice until both reads match
+ * instead of disabling interrupts.
+ *
+ * @param[out] u16_a_ticks Pointer to where the tick count will be stored.
+ *
+ * @return EN_ENC_ERROR_T ENC_OK if the ticks were read, ENC_ERROR if the pointer is NULL.
+ */
+EN_ENC_ERROR_T ENC_getTicks( u16 *u16_a_ticks );
+
+/* ***********************************************************************************************/
+
+#endif /* ENC_INTERFACE_H_ */
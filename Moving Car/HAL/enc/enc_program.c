@@ -0,0 +1,87 @@
+/*
+ * enc_program.c
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Wheel Encoder (ENC) functions' implementation.
+ */
+
+/* HAL */
+#include "enc_config.h"
+#include "enc_interface.h"
+
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+/* Number of encoder ticks since the last reset, updated from the encoder ISR */
+volatile u16 u16_g_encTicks = 0;
+
+/* ISR Callback function for counting one encoder tick ( runtime binding ) */
+static void ENC_countTick( void );
+
+/* ***********************************************************************************************/
+
+/**
+ * @brief Initializes the wheel encoder input pin and its external interrupt, and clears the tick counter.
+ *
+ * @return EN_ENC_ERROR_T ENC_OK if the encoder was initialized successfully, ENC_ERROR otherwise.
+ */
+EN_ENC_ERROR_T ENC_init    ( void )
+{
+	u16_g_encTicks = 0;
+
+	/* Step 1: Encoder pin as input with pull up enabled */
+	if ( DIO_init( ENC_U8_PIN, ENC_U8_PORT, DIO_IN ) != DIO_OK ) return ENC_ERROR;
+	DIO_write( ENC_U8_PIN, ENC_U8_PORT, DIO_U8_PIN_HIGH );
+
+	/* Step 2: Count ticks on the configured edge */
+	if ( EXI_intSetCallBack( ENC_U8_EXI_ID, &ENC_countTick ) != STD_OK ) return ENC_ERROR;
+	if ( EXI_enablePIE( ENC_U8_EXI_ID, ENC_U8_SENSE_EDGE ) != STD_OK ) return ENC_ERROR;
+
+	return ENC_OK;
+}
+
+/**
+ * @brief Clears the encoder tick counter.
+ *
+ * @note Call it while the wheels are stopped, the 16-bit clear is not atomic against the encoder ISR.
+ */
+void           ENC_reset   ( void )
+{
+	u16_g_encTicks = 0;
+}
+
+/**
+ * @brief Reads the number of encoder ticks counted since the last reset.
+ *
+ * The counter is updated from the encoder ISR, so it is read twice until both reads match
+ * instead of disabling interrupts.
+ *
+ * @param[out] u16_a_ticks Pointer to where the tick count will be stored.
+ *
+ * @return EN_ENC_ERROR_T ENC_OK if the ticks were read, ENC_ERROR if the pointer is NULL.
+ */
+EN_ENC_ERROR_T ENC_getTicks( u16 *u16_a_ticks )
+{
+	u16 u16_l_ticks;
+
+	if ( u16_a_ticks == NULL ) return ENC_ERROR;
+
+	do
+	{
+		u16_l_ticks = u16_g_encTicks;
+	}
+	while ( u16_l_ticks != u16_g_encTicks );
+
+	*u16_a_ticks = u16_l_ticks;
+
+	return ENC_OK;
+}
+
+/* ISR Callback function for counting one encoder tick ( runtime binding ) */
+static void ENC_countTick( void )
+{
+	ENC_COUNT_TICK_FROM_ISR();
+}
+
+/* ***********************************************************************************************/
@@ -0,0 +1,33 @@
+/*
+ * led_config.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Light Emitting Diode (LED) pre-build configurations, through which user can configure before using the LED peripheral.
+ */
+
+#ifndef LED_CONFIG_H_
+#define LED_CONFIG_H_
+
+/* ***********************************************************************************************/
+/* LED Brightness ( Binary Code Modulation ) Configurations */
+
+/* The Port of the dimmed LEDs, as a port letter: the slice handler writes its register directly */
+/* Options: A, B, C, D */
+#define LED_BCM_PORT				A
+
+/* The Pins of the dimmed LEDs in that port, the other pins of the port are never written by the slice handler */
+#define LED_U8_BCM_MASK				DIO_MASK_BITS_0_1_2_3
+
+/* Timer0 prescaler: a frame is 255 timer counts, slice N lasts 2^N counts ( 64 -> 8 usec. slice, 2 msec. frame at
+ * 8 MHz ). A slice ISR delayed past the end of its slice ( the 1 and 2 counts slices, behind a longer ISR or critical
+ * section ) does not stretch the frame: the Timer0 ISR folds the next slice in, that frame only shows a slightly
+ * wrong level. 256 makes such delays rarer, at a 8 msec. frame that may flicker */
+/* Options: 64, 256 */
+#define LED_U16_BCM_PRESCALER		64
+
+/* End of Configurations */
+
+/* ***********************************************************************************************/
+
+#endif /* LED_CONFIG_H_ */
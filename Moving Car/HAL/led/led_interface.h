@@ -14,9 +14,18 @@
 /* SRVL */
 #include "../../LIB/std.h"
 #include "../../LIB/bit_math.h"
+#include "../../LIB/pgm.h"
 
 /* MCAL */
 #include "../../MCAL/dio/dio_interface.h"
+#include "../../MCAL/timer/timer_interface.h"
+
+/* HAL */
+#include "led_config.h"
+
+#if ( LED_U16_BCM_PRESCALER != 64 ) && ( LED_U16_BCM_PRESCALER != 256 )
+#error "LED_U16_BCM_PRESCALER must be 64 or 256"
+#endif
 
 /* LED Macros */
 typedef enum EN_LED_ERROR_t
@@ -25,6 +34,63 @@ typedef enum EN_LED_ERROR_t
     LED_ERROR
 }EN_LED_ERROR_t;
 
+/* LED Pattern Macros */
+
+/* One pattern step in a byte: LED level in bit 7, duration in pattern ticks ( 1 to 127 ) in bits 0 -> 6 */
+#define LED_STEP_ON( TICKS )            ( ( u8 ) ( 0x80 | ( ( TICKS ) & 0x7F ) ) )
+#define LED_STEP_OFF( TICKS )           ( ( u8 ) ( ( TICKS ) & 0x7F ) )
+
+/* Blink steps: ON ticks on, then OFF ticks off, the rate and duty of a blink are set by ON and OFF */
+#define LED_STEPS_BLINK( ON, OFF )      LED_STEP_ON( ON ), LED_STEP_OFF( OFF )
+
+/* Repeat a pattern until it is stopped */
+#define LED_U8_REPEAT_FOREVER           0
+
+/* LED Brightness Macros */
+
+/* Brightness levels, from off to full ( always on ) */
+#define LED_U8_LEVEL_OFF                0
+#define LED_U8_LEVEL_FULL               255
+
+/* Slice handler state, shared with the Timer0 compare match ISR: slice N holds the LEDs with bit N of their level set */
+extern volatile u8 u8_g_ledBcmSlices[8];
+extern volatile u8 u8_g_ledBcmOn;
+extern volatile u8 u8_g_ledBcmBit;
+extern volatile u8 u8_g_ledBcmWeight;
+
+/* Dimmed LEDs port, as EN_DIO_PORT_T */
+#define LED_BCM_PORT_ID                 LED_BCM_PORT_ID_( LED_BCM_PORT )
+#define LED_BCM_PORT_ID_( PORT )        LED_BCM_PORT_ID__( PORT )
+#define LED_BCM_PORT_ID__( PORT )       ( PORT_##PORT )
+
+/* Shows the next brightness slice, from the Timer0 compare match ISR: inlined in the vector when bound at compile
+ * time ( APP/app_bindings.h ). Slices run from bit 7 ( 128 counts ) down to bit 0 ( 1 count ), the LEDs shown
+ * on get the slice pins, in one write of the port. Returns the slice length - 1, the next compare value */
+#define LED_BCM_NEXT_SLICE_FROM_ISR()   LED_BCM_NEXT_SLICE_( LED_BCM_PORT )
+#define LED_BCM_NEXT_SLICE_( PORT )     LED_BCM_NEXT_SLICE__( PORT )
+#define LED_BCM_NEXT_SLICE__( PORT )                                                                \
+    ( __extension__ ( {                                                                             \
+        u8 u8_l_bcmWeight = u8_g_ledBcmWeight >> 1;                                                 \
+        u8 u8_l_bcmBit = u8_g_ledBcmBit - 1;                                                        \
+        if (u8_l_bcmWeight == 0) { u8_l_bcmWeight = 0x80; u8_l_bcmBit = 7; }                        \
+        u8_g_ledBcmWeight = u8_l_bcmWeight;                                                         \
+        u8_g_ledBcmBit = u8_l_bcmBit;                                                               \
+        DIO_U8_PORT_##PORT##_REG = (DIO_U8_PORT_##PORT##_REG & (u8) ~LED_U8_BCM_MASK) |             \
+                                   (u8_g_ledBcmSlices[u8_l_bcmBit] & u8_g_ledBcmOn);                \
+        (u8) (u8_l_bcmWeight - 1);                                                                  \
+    } ) )
+
+/**
+ * @brief Constant pattern, placed in flash ( PGM_MEM ) with its steps.
+ * A pattern shows its steps in order, then starts again, u8_repeats times; when it ends, the LED keeps the level
+ * of the last step ( a pattern that must leave the LED off ends with an OFF step ).
+ */
+typedef struct {
+    const u8 *pu8_steps;        /* Steps ( LED_STEP_xxx ), in flash */
+    u8  u8_stepsNumber;         /* Number of steps ( 1 or more ) */
+    u8  u8_repeats;             /* Number of runs of the steps, or LED_U8_REPEAT_FOREVER */
+}ST_LED_pattern_t;
+
 /* ******************************************************************** */
 /* LED Prototypes                                                       */
 /* ******************************************************************** */
@@ -100,5 +166,100 @@ EN_LED_ERROR_t LED_arrayOn(EN_DIO_PORT_T en_a_ledPort, u8 u8_a_mask);
  */
 EN_LED_ERROR_t LED_arrayOff(EN_DIO_PORT_T en_a_ledPort, u8 u8_a_mask);
 
+/**
+ * @brief Shows a pattern on a group of LEDs: the LED pins of the array mask that are in the on mask are turned on,
+ *        the other ones are turned off, all in one port write ( no LED passes through an intermediate state ).
+ *
+ * @param [in]en_a_ledPort The LED port (PORT_A, PORT_B, PORT_C or PORT_D).
+ * @param [in]u8_a_arrayMask The bit mask of the LED pins of the array. (DIO_NO_MASK, DIO_MASK_BITS_n..), 0 is the whole port
+ *        as in LED_arrayOn and LED_arrayOff
+ * @param [in]u8_a_onMask The bit mask of the LED pins to turn on.
+ * @return EN_LED_ERROR_t Returns LED_OK if the LED pins were successfully written, or LED_ERROR if there
+ *         was an error in writing the LED pins.
+ */
+EN_LED_ERROR_t LED_arraySet(EN_DIO_PORT_T en_a_ledPort, u8 u8_a_arrayMask, u8 u8_a_onMask);
+
+
+
+/* ******************************************************************** */
+/* LED PATTERNS Prototypes                                              */
+/* ******************************************************************** */
+
+
+/**
+ * @brief Initializes the patterns engine on a group of LEDs, no pattern runs.
+ * Patterns are advanced by LED_patternTask, which must run in the same context as the other LED pattern functions.
+ *
+ * @param [in]en_a_ledPort The LED port (PORT_A, PORT_B, PORT_C or PORT_D).
+ * @param [in]u8_a_arrayMask The bit mask of the LED pins patterns may run on. (DIO_NO_MASK, DIO_MASK_BITS_n..)
+ * @return EN_LED_ERROR_t Returns LED_OK if the engine was initialized, or LED_ERROR if the port is invalid.
+ */
+EN_LED_ERROR_t LED_patternInit(EN_DIO_PORT_T en_a_ledPort, u8 u8_a_arrayMask);
+
+/**
+ * @brief Starts a pattern on a group of LEDs, in step with each other, replacing the patterns they were running.
+ * The first step is shown by the next LED_patternTask.
+ *
+ * @param [in]u8_a_ledsMask The bit mask of the LED pins to run the pattern on, within the patterns array mask.
+ * @param [in]st_a_pattern Pointer to the pattern, in flash.
+ * @return EN_LED_ERROR_t Returns LED_OK if the pattern was started, or LED_ERROR if the mask is out of the array,
+ *         or the pattern is NULL or has no step.
+ */
+EN_LED_ERROR_t LED_patternStart(u8 u8_a_ledsMask, const ST_LED_pattern_t *st_a_pattern);
+
+/**
+ * @brief Stops the patterns of a group of LEDs, and turns them off. LEDs with no running pattern are left as they are.
+ *
+ * @param [in]u8_a_ledsMask The bit mask of the LED pins to stop.
+ * @return EN_LED_ERROR_t Returns LED_OK if the patterns were stopped, or LED_ERROR if there was an error in
+ *         writing the LED pins.
+ */
+EN_LED_ERROR_t LED_patternStop(u8 u8_a_ledsMask);
+
+/**
+ * @brief Advances the running patterns by one pattern tick, and shows them in one masked port write
+ * ( nothing is written when no pattern runs ). Never blocks, meant to run from a periodic task: its period is the
+ * pattern tick.
+ */
+void LED_patternTask(void);
+
+
+
+/* ******************************************************************** */
+/* LED BRIGHTNESS Prototypes                                            */
+/* ******************************************************************** */
+
+
+/**
+ * @brief Starts the brightness control of the dimmed LEDs ( led_config.h ) with Binary Code Modulation: every frame
+ * of 255 Timer0 counts is cut into 8 bit-weighted slices, and in slice N an LED is on if bit N of its level is set,
+ * so all LEDs cost 8 slice ISRs per frame whatever their number and levels.
+ * The other LED functions keep working: for the dimmed LEDs they only select which ones are shown on, at their
+ * level. The dimmed LEDs keep their state. Timer0 belongs to the brightness control until LED_bcmStop.
+ * While it runs, other pins of the port must only be written atomically ( DIO_portWriteAtomic, transactions ).
+ *
+ * @return EN_LED_ERROR_t Returns LED_OK if the brightness control runs, or LED_ERROR if Timer0 could not be started.
+ */
+EN_LED_ERROR_t LED_bcmStart(void);
+
+/**
+ * @brief Stops the brightness control, and frees Timer0: the LEDs shown on are turned on at full brightness.
+ *
+ * @return EN_LED_ERROR_t Returns LED_OK if stopped, or LED_ERROR if there was an error in writing the LED pins.
+ */
+EN_LED_ERROR_t LED_bcmStop(void);
+
+/**
+ * @brief Sets the brightness level of one dimmed LED, used from the next slice on ( levels default to full ).
+ * A frame may show a mix of the previous and the new level, never anything else.
+ *
+ * @param [in]u8_a_ledPin The pin number of the LED, in the dimmed LEDs mask (DIO_U8_PIN_0 to DIO_U8_PIN_7)
+ * @param [in]u8_a_level The brightness level, LED_U8_LEVEL_OFF to LED_U8_LEVEL_FULL ( on for level / 255 of the time ).
+ * @return EN_LED_ERROR_t Returns LED_OK if the level was set, or LED_ERROR if the LED is not dimmed.
+ */
+EN_LED_ERROR_t LED_bcmSetLevel(u8 u8_a_ledPin, u8 u8_a_level);
+
+
+
 
 #endif /* LED_INTERFACE_H_ */
\ No newline at end of file
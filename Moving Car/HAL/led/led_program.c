@@ -9,6 +9,44 @@
 /* HAL */
 #include "LED_Interface.h"
 
+/* ******************************************************************** */
+/* LED Patterns Declaration and Initialization                          */
+/* ******************************************************************** */
+
+/* Patterns port, and LED pins patterns may run on */
+static EN_DIO_PORT_T en_gs_ledPatternPort = PORT_A;
+static u8 u8_gs_ledPatternArray = 0;
+
+/* LED pins running a pattern */
+static u8 u8_gs_ledPatternActive = 0;
+
+/* Running pattern of each LED pin, copied from flash at start so a tick reads one step byte per LED */
+static const u8 *pu8_gs_ledPatternSteps[8];
+static u8 u8_gs_ledPatternStepsNumber[8];
+static u8 u8_gs_ledPatternStep[8];
+static u8 u8_gs_ledPatternTicksLeft[8];
+static u8 u8_gs_ledPatternRepeatsLeft[8];
+
+/* ******************************************************************** */
+/* LED Brightness Declaration and Initialization                        */
+/* ******************************************************************** */
+
+/* Brightness slices, all levels full until set */
+volatile u8 u8_g_ledBcmSlices[8] = { LED_U8_BCM_MASK, LED_U8_BCM_MASK, LED_U8_BCM_MASK, LED_U8_BCM_MASK,
+                                     LED_U8_BCM_MASK, LED_U8_BCM_MASK, LED_U8_BCM_MASK, LED_U8_BCM_MASK };
+
+/* Dimmed LEDs shown on */
+volatile u8 u8_g_ledBcmOn = 0;
+
+/* Slice being shown, bit 0 ( weight 1 ) so the first slice ISR starts a frame */
+volatile u8 u8_g_ledBcmBit = 0;
+volatile u8 u8_g_ledBcmWeight = 1;
+
+static u8 u8_gs_ledBcmRunning = STD_NOK;
+
+static u8 LED_bcmShow(EN_DIO_PORT_T en_a_ledPort, u8 u8_a_mask, u8 u8_a_onMask);
+static u8 LED_bcmNextSlice(void);
+
 /* ******************************************************************** */
 /* LED Prototypes                                                       */
 /* ******************************************************************** */
@@ -37,6 +75,7 @@ EN_LED_ERROR_t LED_init(EN_DIO_PORT_T en_a_ledPort, u8 u8_a_ledPin) {
  * @return The status of the LED operation, either LED_OK or LED_ERROR.
  */
 EN_LED_ERROR_t LED_on(EN_DIO_PORT_T en_a_ledPort, u8 u8_a_ledPin) {
+    if (u8_a_ledPin <= DIO_U8_PIN_7 && LED_bcmShow(en_a_ledPort, 1 << u8_a_ledPin, 1 << u8_a_ledPin) == 0) return LED_OK;
     EN_DIO_ERROR_T dioError = DIO_write(u8_a_ledPin, en_a_ledPort, DIO_U8_PIN_HIGH);
     return dioError == DIO_ERROR ? LED_ERROR : LED_OK;
 }
@@ -49,6 +88,7 @@ EN_LED_ERROR_t LED_on(EN_DIO_PORT_T en_a_ledPort, u8 u8_a_ledPin) {
  * @return EN_LED_ERROR_t LED_OK if successful, or LED_ERROR if there was an error.
  */
 EN_LED_ERROR_t LED_off(EN_DIO_PORT_T en_a_ledPort, u8 u8_a_ledPin) {
+if (u8_a_ledPin <= DIO_U8_PIN_7 && LED_bcmShow(en_a_ledPort, 1 << u8_a_ledPin, 0) == 0) return LED_OK;
 EN_DIO_ERROR_T dioError = DIO_write(u8_a_ledPin, en_a_ledPort, DIO_U8_PIN_LOW);
 return dioError == DIO_ERROR ? LED_ERROR : LED_OK;
 }
@@ -82,6 +122,9 @@ EN_LED_ERROR_t LED_arrayInit(EN_DIO_PORT_T en_a_ledPort, u8 u8_a_mask) {
  *         or LED_ERROR if there was an error in turning on the LED pins.
  */
 EN_LED_ERROR_t LED_arrayOn(EN_DIO_PORT_T en_a_ledPort, u8 u8_a_mask) {
+    if (u8_a_mask == 0) u8_a_mask = 0xFF;
+    u8_a_mask = LED_bcmShow(en_a_ledPort, u8_a_mask, u8_a_mask);
+    if (u8_a_mask == 0) return LED_OK;
     EN_DIO_ERROR_T dioError = DIO_portWrite(en_a_ledPort, DIO_U8_PORT_HIGH, u8_a_mask);
     return dioError == DIO_ERROR ? LED_ERROR : LED_OK;
 }
@@ -95,6 +138,264 @@ EN_LED_ERROR_t LED_arrayOn(EN_DIO_PORT_T en_a_ledPort, u8 u8_a_mask) {
  *         was an error in turning off the LED pins.
  */
 EN_LED_ERROR_t LED_arrayOff(EN_DIO_PORT_T en_a_ledPort, u8 u8_a_mask){
+    if (u8_a_mask == 0) u8_a_mask = 0xFF;
+    u8_a_mask = LED_bcmShow(en_a_ledPort, u8_a_mask, 0);
+    if (u8_a_mask == 0) return LED_OK;
     EN_DIO_ERROR_T dioError = DIO_portWrite(en_a_ledPort, DIO_U8_PORT_LOW, u8_a_mask);
     return dioError == DIO_ERROR ? LED_ERROR : LED_OK;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Shows a pattern on a group of LEDs: the LED pins of the array mask that are in the on mask are turned on,
+ *        the other ones are turned off, all in one port write ( no LED passes through an intermediate state ).
+ *
+ * @param [in]en_a_ledPort The LED port (PORT_A, PORT_B, PORT_C or PORT_D).
+ * @param [in]u8_a_arrayMask The bit mask of the LED pins of the array. (DIO_NO_MASK, DIO_MASK_BITS_n..), 0 is the whole port
+ *        as in LED_arrayOn and LED_arrayOff
+ * @param [in]u8_a_onMask The bit mask of the LED pins to turn on.
+ * @return EN_LED_ERROR_t Returns LED_OK if the LED pins were successfully written, or LED_ERROR if there
+ *         was an error in writing the LED pins.
+ */
+EN_LED_ERROR_t LED_arraySet(EN_DIO_PORT_T en_a_ledPort, u8 u8_a_arrayMask, u8 u8_a_onMask){
+    ST_DIO_transaction_t st_l_transaction;
+
+    /* A mask of 0 is the whole port, as in DIO, the check below is then only for no pin left after the BCM pins */
+    if (u8_a_arrayMask == 0) u8_a_arrayMask = 0xFF;
+    u8_a_arrayMask = LED_bcmShow(en_a_ledPort, u8_a_arrayMask, u8_a_onMask);
+    if (u8_a_arrayMask == 0) return LED_OK;
+
+    DIO_beginTransaction(&st_l_transaction);
+    EN_DIO_ERROR_T dioError = DIO_stagePort(&st_l_transaction, en_a_ledPort, u8_a_onMask, u8_a_arrayMask);
+    if (dioError == DIO_OK) dioError = DIO_commitTransaction(&st_l_transaction);
+    return dioError == DIO_ERROR ? LED_ERROR : LED_OK;
+}
+
+
+
+/* ******************************************************************** */
+/* LED PATTERNS Prototypes                                              */
+/* ******************************************************************** */
+
+/**
+ * @brief Initializes the patterns engine on a group of LEDs, no pattern runs.
+ * Patterns are advanced by LED_patternTask, which must run in the same context as the other LED pattern functions.
+ *
+ * @param [in]en_a_ledPort The LED port (PORT_A, PORT_B, PORT_C or PORT_D).
+ * @param [in]u8_a_arrayMask The bit mask of the LED pins patterns may run on. (DIO_NO_MASK, DIO_MASK_BITS_n..)
+ * @return EN_LED_ERROR_t Returns LED_OK if the engine was initialized, or LED_ERROR if the port is invalid.
+ */
+EN_LED_ERROR_t LED_patternInit(EN_DIO_PORT_T en_a_ledPort, u8 u8_a_arrayMask){
+    if (en_a_ledPort > PORT_D) return LED_ERROR;
+
+    en_gs_ledPatternPort = en_a_ledPort;
+    u8_gs_ledPatternArray = u8_a_arrayMask;
+    u8_gs_ledPatternActive = 0;
+
+    return LED_OK;
+}
+
+/**
+ * @brief Starts a pattern on a group of LEDs, in step with each other, replacing the patterns they were running.
+ * The first step is shown by the next LED_patternTask.
+ *
+ * @param [in]u8_a_ledsMask The bit mask of the LED pins to run the pattern on, within the patterns array mask.
+ * @param [in]st_a_pattern Pointer to the pattern, in flash.
+ * @return EN_LED_ERROR_t Returns LED_OK if the pattern was started, or LED_ERROR if the mask is out of the array,
+ *         or the pattern is NULL or has no step.
+ */
+EN_LED_ERROR_t LED_patternStart(u8 u8_a_ledsMask, const ST_LED_pattern_t *st_a_pattern){
+    const u8 *pu8_l_steps;
+    u8 u8_l_stepsNumber;
+    u8 u8_l_repeats;
+    u8 u8_l_led;
+
+    /* Check 1: LEDs are in the array, and the pattern is valid */
+    if ((u8_a_ledsMask & ~u8_gs_ledPatternArray) != 0 || st_a_pattern == NULL) return LED_ERROR;
+
+    pu8_l_steps = (const u8 *) PGM_READ_WORD(&st_a_pattern->pu8_steps);
+    u8_l_stepsNumber = PGM_READ_BYTE(&st_a_pattern->u8_stepsNumber);
+    u8_l_repeats = PGM_READ_BYTE(&st_a_pattern->u8_repeats);
+
+    if (u8_l_stepsNumber == 0) return LED_ERROR;
+
+    /* Step 1: Every LED of the group starts from the first step, a zero ticks left loads it on the next tick */
+    for (u8_l_led = 0; u8_l_led < 8; u8_l_led++) {
+        if (GET_BIT(u8_a_ledsMask, u8_l_led) == 0) continue;
+
+        pu8_gs_ledPatternSteps[u8_l_led] = pu8_l_steps;
+        u8_gs_ledPatternStepsNumber[u8_l_led] = u8_l_stepsNumber;
+        u8_gs_ledPatternStep[u8_l_led] = 0;
+        u8_gs_ledPatternTicksLeft[u8_l_led] = 0;
+        u8_gs_ledPatternRepeatsLeft[u8_l_led] = u8_l_repeats;
+    }
+
+    u8_gs_ledPatternActive |= u8_a_ledsMask;
+
+    return LED_OK;
+}
+
+/**
+ * @brief Stops the patterns of a group of LEDs, and turns them off. LEDs with no running pattern are left as they are.
+ *
+ * @param [in]u8_a_ledsMask The bit mask of the LED pins to stop.
+ * @return EN_LED_ERROR_t Returns LED_OK if the patterns were stopped, or LED_ERROR if there was an error in
+ *         writing the LED pins.
+ */
+EN_LED_ERROR_t LED_patternStop(u8 u8_a_ledsMask){
+    u8 u8_l_stopped = u8_gs_ledPatternActive & u8_a_ledsMask;
+
+    if (u8_l_stopped == 0) return LED_OK;
+
+    u8_gs_ledPatternActive &= ~u8_l_stopped;
+
+    return LED_arrayOff(en_gs_ledPatternPort, u8_l_stopped);
+}
+
+/**
+ * @brief Advances the running patterns by one pattern tick, and shows them in one masked port write
+ * ( nothing is written when no pattern runs ). Never blocks, meant to run from a periodic task: its period is the
+ * pattern tick.
+ */
+void LED_patternTask(void){
+    u8 u8_l_shown = u8_gs_ledPatternActive;
+    u8 u8_l_onMask = 0;
+    u8 u8_l_step;
+    u8 u8_l_led;
+
+    /* Check 1: No pattern runs */
+    if (u8_l_shown == 0) return;
+
+    for (u8_l_led = 0; u8_l_led < 8; u8_l_led++) {
+        if (GET_BIT(u8_l_shown, u8_l_led) == 0) continue;
+
+        u8_l_step = PGM_READ_BYTE(pu8_gs_ledPatternSteps[u8_l_led] + u8_gs_ledPatternStep[u8_l_led]);
+
+        /* Step 1: Step just entered, load its duration ( a zero duration lasts 1 tick ) */
+        if (u8_gs_ledPatternTicksLeft[u8_l_led] == 0) {
+            u8_gs_ledPatternTicksLeft[u8_l_led] = u8_l_step & 0x7F;
+            if (u8_gs_ledPatternTicksLeft[u8_l_led] == 0) u8_gs_ledPatternTicksLeft[u8_l_led] = 1;
+        }
+
+        /* Step 2: Show the step level for this tick */
+        if ((u8_l_step & 0x80) != 0) SET_BIT(u8_l_onMask, u8_l_led);
+
+        /* Step 3: Step shown for all its ticks, move to the next step, and end the pattern after its last run,
+         * the LED keeps the level of the last step */
+        u8_gs_ledPatternTicksLeft[u8_l_led]--;
+        if (u8_gs_ledPatternTicksLeft[u8_l_led] != 0) continue;
+
+        u8_gs_ledPatternStep[u8_l_led]++;
+        if (u8_gs_ledPatternStep[u8_l_led] < u8_gs_ledPatternStepsNumber[u8_l_led]) continue;
+
+        u8_gs_ledPatternStep[u8_l_led] = 0;
+        if (u8_gs_ledPatternRepeatsLeft[u8_l_led] == LED_U8_REPEAT_FOREVER) continue;
+
+        u8_gs_ledPatternRepeatsLeft[u8_l_led]--;
+        if (u8_gs_ledPatternRepeatsLeft[u8_l_led] == 0) CLR_BIT(u8_gs_ledPatternActive, u8_l_led);
+    }
+
+    /* Step 4: All pattern LEDs in one port write */
+    LED_arraySet(en_gs_ledPatternPort, u8_l_shown, u8_l_onMask);
+}
+
+
+
+/* ******************************************************************** */
+/* LED BRIGHTNESS Prototypes                                            */
+/* ******************************************************************** */
+
+/**
+ * @brief Starts the brightness control of the dimmed LEDs ( led_config.h ) with Binary Code Modulation: every frame
+ * of 255 Timer0 counts is cut into 8 bit-weighted slices, and in slice N an LED is on if bit N of its level is set,
+ * so all LEDs cost 8 slice ISRs per frame whatever their number and levels.
+ * The other LED functions keep working: for the dimmed LEDs they only select which ones are shown on, at their
+ * level. The dimmed LEDs keep their state. Timer0 belongs to the brightness control until LED_bcmStop.
+ * While it runs, other pins of the port must only be written atomically ( DIO_portWriteAtomic, transactions ).
+ *
+ * @return EN_LED_ERROR_t Returns LED_OK if the brightness control runs, or LED_ERROR if Timer0 could not be started.
+ */
+EN_LED_ERROR_t LED_bcmStart(void){
+    u8 u8_l_portValue = 0;
+
+    if (u8_gs_ledBcmRunning == STD_OK) return LED_OK;
+
+    /* Step 1: Dimmed LEDs keep their state, output pins read back their level */
+    DIO_portRead(LED_BCM_PORT_ID, &u8_l_portValue);
+    u8_g_ledBcmOn = u8_l_portValue & LED_U8_BCM_MASK;
+
+    /* Step 2: First period of 1 count, then the first slice ISR starts a frame */
+    u8_g_ledBcmBit = 0;
+    u8_g_ledBcmWeight = 1;
+    TIMER_timer0CtcInit(0);
+    TIMER_timer0CompSetCallback(&LED_bcmNextSlice);
+
+    u8_gs_ledBcmRunning = STD_OK;
+
+    return TIMER_timer0Start(LED_U16_BCM_PRESCALER) == TIMER_OK ? LED_OK : LED_ERROR;
+}
+
+/**
+ * @brief Stops the brightness control, and frees Timer0: the LEDs shown on are turned on at full brightness.
+ *
+ * @return EN_LED_ERROR_t Returns LED_OK if stopped, or LED_ERROR if there was an error in writing the LED pins.
+ */
+EN_LED_ERROR_t LED_bcmStop(void){
+    if (u8_gs_ledBcmRunning != STD_OK) return LED_OK;
+
+    TIMER_timer0CtcDeInit();
+    u8_gs_ledBcmRunning = STD_NOK;
+
+    return LED_arraySet(LED_BCM_PORT_ID, LED_U8_BCM_MASK, u8_g_ledBcmOn);
+}
+
+/**
+ * @brief Sets the brightness level of one dimmed LED, used from the next slice on ( levels default to full ).
+ * A frame may show a mix of the previous and the new level, never anything else.
+ *
+ * @param [in]u8_a_ledPin The pin number of the LED, in the dimmed LEDs mask (DIO_U8_PIN_0 to DIO_U8_PIN_7)
+ * @param [in]u8_a_level The brightness level, LED_U8_LEVEL_OFF to LED_U8_LEVEL_FULL ( on for level / 255 of the time ).
+ * @return EN_LED_ERROR_t Returns LED_OK if the level was set, or LED_ERROR if the LED is not dimmed.
+ */
+EN_LED_ERROR_t LED_bcmSetLevel(u8 u8_a_ledPin, u8 u8_a_level){
+    u8 u8_l_bit;
+
+    if (u8_a_ledPin > DIO_U8_PIN_7 || GET_BIT(LED_U8_BCM_MASK, u8_a_ledPin) == 0) return LED_ERROR;
+
+    /* Each slice is one byte, written in one store: the ISR only reads them */
+    for (u8_l_bit = 0; u8_l_bit < 8; u8_l_bit++) {
+        if (GET_BIT(u8_a_level, u8_l_bit) == 1) u8_g_ledBcmSlices[u8_l_bit] |= (u8) (1 << u8_a_ledPin);
+        else                                    u8_g_ledBcmSlices[u8_l_bit] &= (u8) ~(1 << u8_a_ledPin);
+    }
+
+    return LED_OK;
+}
+
+/**
+ * @brief Shows LEDs through the brightness control when it drives them: the dimmed LEDs of the mask are shown on
+ * if they are in the on mask, off otherwise.
+ *
+ * @param [in]en_a_ledPort The LED port.
+ * @param [in]u8_a_mask The bit mask of the LED pins to show.
+ * @param [in]u8_a_onMask The bit mask of the LED pins to show on.
+ * @return u8 The bit mask of the LED pins left to write to the port.
+ */
+static u8 LED_bcmShow(EN_DIO_PORT_T en_a_ledPort, u8 u8_a_mask, u8 u8_a_onMask){
+    u8 u8_l_dimmed;
+
+    if (u8_gs_ledBcmRunning != STD_OK || en_a_ledPort != LED_BCM_PORT_ID) return u8_a_mask;
+
+    /* Only the main context writes it, the ISR reads it in one load */
+    u8_l_dimmed = u8_a_mask & LED_U8_BCM_MASK;
+    u8_g_ledBcmOn = (u8_g_ledBcmOn & ~u8_l_dimmed) | (u8_a_onMask & u8_l_dimmed);
+
+    return u8_a_mask & (u8) ~LED_U8_BCM_MASK;
+}
+
+/**
+ * @brief Slice handler for the runtime binding of the Timer0 compare match ISR ( MCAL/timer/timer_config.h ).
+ *
+ * @return u8 Length of the started slice - 1.
+ */
+static u8 LED_bcmNextSlice(void){
+    return LED_BCM_NEXT_SLICE_FROM_ISR();
+}
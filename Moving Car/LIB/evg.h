@@ -0,0 +1,40 @@
+/*
+ * evg.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: System Event Group (EVG): one byte of named system flags, shared by every layer.
+ *               A module subscribes to the flags it cares about by keeping their mask, then one test of the
+ *               group byte against that mask tells it whether any of them is raised ( a stop reason, a fault ).
+ *               This header only holds what any layer may use without interrupts masking: the flags, the test,
+ *               and the _FROM_ISR macros, for an ISR or code running with interrupts already disabled.
+ *               The atomic set, clear and test-and-clear, which need GLI sections, and the group byte itself are
+ *               in SERVICE/evg ( evg_interface.h ).
+ */
+
+#ifndef EVG_H_
+#define EVG_H_
+
+#include "std.h"
+
+/* ***********************************************************************************************/
+/* EVG Macros */
+
+/* EVG flags */
+#define EVG_U8_STOP				0x01	/* Sudden break: STOP button pressed, motors must stay off */
+#define EVG_U8_FAULT			0x02	/* A task missed its deadline, the watchdog is about to reset the MCU */
+#define EVG_U8_ALL				0xFF
+
+/* Group byte ( SERVICE/evg/evg_program.c ), written only through the EVG macros and functions */
+extern volatile u8 u8_g_evgFlags;
+
+/* One flag of the mask is raised */
+#define EVG_TEST_ANY( MASK )			( ( u8_g_evgFlags & ( MASK ) ) != 0 )
+
+/* Set or clear flags from an ISR, or with interrupts already disabled */
+#define EVG_SET_FROM_ISR( MASK )		( u8_g_evgFlags |= ( MASK ) )
+#define EVG_CLEAR_FROM_ISR( MASK )		( u8_g_evgFlags &= ( u8 ) ~( MASK ) )
+
+/* ***********************************************************************************************/
+
+#endif /* EVG_H_ */
@@ -0,0 +1,39 @@
+/*
+ * pgm.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: Program memory (flash) constants: placement attribute, and byte/word reads through the LPM instruction.
+ *               A constant placed with PGM_MEM is not copied into SRAM, so it must only be read with PGM_READ_BYTE / PGM_READ_WORD.
+ */
+
+#ifndef PGM_H_
+#define PGM_H_
+
+#include "std.h"
+
+/* Place a constant in flash only */
+#define PGM_MEM		__attribute__ ( ( __progmem__ ) )
+
+/* Read one byte at a flash address ( ATmega32 flash is 32 KB, so a 16-bit Z pointer reaches all of it ) */
+#define PGM_READ_BYTE( ADDRESS )												\
+	( __extension__ ( {															\
+		u16 u16_l_pgmAddress = ( u16 ) ( ADDRESS );								\
+		u8  u8_l_pgmByte;														\
+		__asm__ __volatile__ ( "lpm %0, Z" : "=r" ( u8_l_pgmByte ) : "z" ( u16_l_pgmAddress ) );	\
+		u8_l_pgmByte;															\
+	} ) )
+
+/* Read one little-endian word at a flash address ( u16 values and function pointers ) */
+#define PGM_READ_WORD( ADDRESS )												\
+	( __extension__ ( {															\
+		u16 u16_l_pgmAddress = ( u16 ) ( ADDRESS );								\
+		u16 u16_l_pgmWord;														\
+		__asm__ __volatile__ ( "lpm %A0, Z+" "\n\t"								\
+							   "lpm %B0, Z"										\
+							   : "=r" ( u16_l_pgmWord ), "=z" ( u16_l_pgmAddress )	\
+							   : "1" ( u16_l_pgmAddress ) );					\
+		u16_l_pgmWord;															\
+	} ) )
+
+#endif /* PGM_H_ */
@@ -12,6 +12,17 @@
 #ifndef DIO_INTERFACE_H_
 #define DIO_INTERFACE_H_
 
+/**
+ * ISR safety of the DIO entry points ( an ISR may write a port the main code also writes, e.g. the INT0 motors cut ):
+ *  - ISR-safe, single instruction: DIO_PIN_SET, DIO_PIN_CLEAR, DIO_PIN_OUTPUT, DIO_PIN_INPUT, DIO_PIN_READ ( SBI/CBI/SBIS ),
+ *    DIO_read ( one IN ). DIO_PIN_TOGGLE never changes another pin, but racing an ISR write of the same pin it may be lost.
+ *  - ISR-safe, SREG-save critical section around the read-modify-write: DIO_writeAtomic, DIO_toggleAtomic,
+ *    DIO_portWriteAtomic, DIO_portToggleAtomic, DIO_commitTransaction.
+ *  - Not ISR-safe, plain read-modify-write: DIO_write, DIO_toggle, DIO_portWrite, DIO_portToggle, DIO_init, DIO_portInit.
+ *    Use them only on ports no ISR writes, or inside a critical section ( the DCM does so to test the stop flag and
+ *    write the PWM pins in one section ).
+ */
+
 /* ***************************************************************************************************************** */
 /* DIO Includes **/
 
@@ -19,6 +30,9 @@
 #include "../../LIB/bit_math.h"
 #include "../../LIB/std.h"
 
+/* Registers of the compile-time pin descriptors */
+#include "dio_private.h"
+
 /* ***************************************************************************************************************** */
 /* DIO Macros/Enums **/
 
@@ -345,6 +359,68 @@ typedef enum EN_DIO_ERROR_T
     DIO_ERROR   /**< An error occurred during the operation */
 } EN_DIO_ERROR_T;
 
+/* Number of DIO ports, PORT_A to PORT_D */
+#define DIO_PORTS_NUMBER    4
+
+/**
+ * @brief Port changes staged by a DIO transaction, per port: pins driven high, pins driven low, and pins toggled.
+ * A pin is staged in one of the three masks at most.
+ */
+typedef struct ST_DIO_transaction_t
+{
+    u8 u8_setMask[DIO_PORTS_NUMBER];
+    u8 u8_clearMask[DIO_PORTS_NUMBER];
+    u8 u8_toggleMask[DIO_PORTS_NUMBER];
+} ST_DIO_transaction_t;
+
+/* ******************************************************** */
+/*            DIO Compile-time Pin Descriptors             **/
+/* ******************************************************** */
+
+/**
+ * @brief A pin known at build time is described once, as DIO_PIN( port letter A -> D, pin 0 -> 7 ), e.g.
+ * #define APP_START_BTN_PIN DIO_PIN( D, 3 ), then accessed with the macros below, without range checks nor port switch.
+ * All ports are in the I/O range of the single bit instructions, so with constant descriptors:
+ *  - DIO_PIN_OUTPUT / DIO_PIN_INPUT compile to one SBI / CBI on DDRx,
+ *  - DIO_PIN_SET / DIO_PIN_CLEAR compile to one SBI / CBI on PORTx,
+ *  - DIO_PIN_READ compiles to one SBIS / SBIC on PINx when tested in a condition,
+ *  - DIO_PIN_TOGGLE compiles to SBIS on PORTx then one CBI or SBI ( writing PINx does not toggle on the ATmega32 ).
+ * A single bit instruction cannot be split by an interrupt, so these accesses need no critical section.
+ * An unknown port letter fails to build ( no such register ), and so does a pin number over 7.
+ *
+ * @note The runtime functions below stay for pins only known at run time ( tables, arguments ).
+ */
+#define DIO_PIN( PORT, PIN )				PORT, PIN
+
+/* Runtime port ( EN_DIO_PORT_T ) and pin number of a descriptor, for the runtime functions */
+#define DIO_PIN_PORT( DESCRIPTOR )			DIO_PIN_PORT_( DESCRIPTOR )
+#define DIO_PIN_NUMBER( DESCRIPTOR )		DIO_PIN_NUMBER_( DESCRIPTOR )
+
+#define DIO_PIN_OUTPUT( DESCRIPTOR )		DIO_PIN_OUTPUT_( DESCRIPTOR )
+#define DIO_PIN_INPUT( DESCRIPTOR )			DIO_PIN_INPUT_( DESCRIPTOR )
+#define DIO_PIN_SET( DESCRIPTOR )			DIO_PIN_SET_( DESCRIPTOR )
+#define DIO_PIN_CLEAR( DESCRIPTOR )			DIO_PIN_CLEAR_( DESCRIPTOR )
+#define DIO_PIN_TOGGLE( DESCRIPTOR )		DIO_PIN_TOGGLE_( DESCRIPTOR )
+/* Pin level: DIO_U8_PIN_LOW or DIO_U8_PIN_HIGH */
+#define DIO_PIN_READ( DESCRIPTOR )			DIO_PIN_READ_( DESCRIPTOR )
+
+/* Second expansion step: the descriptor is split into its port letter and pin number */
+/* Zero, or a negative array size build error for a pin number over 7 ( still a constant expression, for initializers ) */
+#define DIO_PIN_CHECK( PIN )				( 0 * sizeof( char[ ( ( PIN ) <= DIO_U8_PIN_7 ) ? 1 : -1 ] ) )
+#define DIO_PIN_MASK( PIN )					( ( u8 ) ( 1 << ( PIN ) ) )
+#define DIO_PIN_PORT_( PORT, PIN )			( ( EN_DIO_PORT_T ) ( PORT_##PORT + DIO_PIN_CHECK( PIN ) ) )
+#define DIO_PIN_NUMBER_( PORT, PIN )		( ( u8 ) ( ( PIN ) + DIO_PIN_CHECK( PIN ) ) )
+#define DIO_PIN_OUTPUT_( PORT, PIN )		do { ( void ) DIO_PIN_CHECK( PIN ); DIO_U8_DDR_##PORT##_REG  |=  DIO_PIN_MASK( PIN ); } while ( 0 )
+#define DIO_PIN_INPUT_( PORT, PIN )			do { ( void ) DIO_PIN_CHECK( PIN ); DIO_U8_DDR_##PORT##_REG  &= ( u8 ) ~DIO_PIN_MASK( PIN ); } while ( 0 )
+#define DIO_PIN_SET_( PORT, PIN )			do { ( void ) DIO_PIN_CHECK( PIN ); DIO_U8_PORT_##PORT##_REG |=  DIO_PIN_MASK( PIN ); } while ( 0 )
+#define DIO_PIN_CLEAR_( PORT, PIN )			do { ( void ) DIO_PIN_CHECK( PIN ); DIO_U8_PORT_##PORT##_REG &= ( u8 ) ~DIO_PIN_MASK( PIN ); } while ( 0 )
+#define DIO_PIN_TOGGLE_( PORT, PIN )												\
+	do {																			\
+		( void ) DIO_PIN_CHECK( PIN );												\
+		if ( ( DIO_U8_PORT_##PORT##_REG & DIO_PIN_MASK( PIN ) ) != 0 ) DIO_U8_PORT_##PORT##_REG &= ( u8 ) ~DIO_PIN_MASK( PIN );	\
+		else                                                           DIO_U8_PORT_##PORT##_REG |=  DIO_PIN_MASK( PIN );		\
+	} while ( 0 )
+#define DIO_PIN_READ_( PORT, PIN )			( ( ( DIO_U8_PIN_##PORT##_REG & DIO_PIN_MASK( PIN + DIO_PIN_CHECK( PIN ) ) ) != 0 ) ? DIO_U8_PIN_HIGH : DIO_U8_PIN_LOW )
 
 /* ******************************************************** */
 /*                 DIO PINS Functions                      **/
@@ -461,4 +537,145 @@ EN_DIO_ERROR_T DIO_portWrite(EN_DIO_PORT_T en_a_portNumber, u8 u8_a_portValue, u
  */
 EN_DIO_ERROR_T DIO_portToggle(EN_DIO_PORT_T en_a_portNumber, u8 u8_a_mask);
 
+/**
+ * @brief Reads all the pins of a port of the DIO interface at once
+ *
+ * This function reads the input register (PIN) of the port in one instruction, so all the pins of the
+ * port are sampled at the same instant, and the value is stored in the u8_a_portValue parameter.
+ *
+ * @param[in] en_a_portNumber The port number of the DIO interface to read from (PORT_A, PORT_B, PORT_C or PORT_D)
+ * @param[out] u8_a_portValue Pointer to an unsigned 8-bit integer where the value of the port will be stored
+ *
+ * @return An EN_DIO_ERROR_T value indicating the success or failure of the operation
+ *         (DIO_OK if the operation succeeded, DIO_ERROR otherwise)
+ */
+EN_DIO_ERROR_T DIO_portRead(EN_DIO_PORT_T en_a_portNumber, u8 * u8_a_portValue);
+
+/* ******************************************************* */
+/*            DIO Atomic Functions                         */
+/* ******************************************************  */
+
+/**
+ * @brief Writes a digital value to a specific pin in a specific port, atomically ( ISR-safe ).
+ *
+ * Same as DIO_write, but the port read-modify-write runs with interrupts disabled ( only the load, OR/AND
+ * and store of the port register, reached through its pointer in the ports table, LD/ST rather than IN/OUT ),
+ * so it never undoes a write of another pin of the port done by an ISR.
+ *
+ * @param[in] u8_a_pinNumber The number of the pin to write to. (DIO_U8_PIN_0 to DIO_U8_PIN_7)
+ * @param[in] en_a_portNumber The port number to write to. (PORT_A, PORT_B, PORT_C or PORT_D)
+ * @param[in] u8_a_value The digital value to write (either DIO_U8_PIN_HIGH or DIO_U8_PIN_LOW).
+ *
+ * @return EN_DIO_ERROR_T Returns DIO_OK if the write is successful, DIO_ERROR otherwise.
+ */
+EN_DIO_ERROR_T DIO_writeAtomic(u8 u8_a_pinNumber, EN_DIO_PORT_T en_a_portNumber, u8 u8_a_value);
+
+/**
+ * @brief Toggles the state of a pin in the specified port, atomically ( ISR-safe ).
+ *
+ * Same as DIO_toggle, but the pin is inverted with one read-modify-write run with interrupts disabled.
+ *
+ * @param[in] u8_a_pinNumber The pin number to toggle. (DIO_U8_PIN_0 to DIO_U8_PIN_7)
+ * @param[in] en_a_portNumber The port to which the pin belongs. (PORT_A, PORT_B, PORT_C or PORT_D)
+ *
+ * @return EN_DIO_ERROR_T Returns DIO_OK on success or DIO_ERROR if an error occurred.
+ */
+EN_DIO_ERROR_T DIO_toggleAtomic(u8 u8_a_pinNumber, EN_DIO_PORT_T en_a_portNumber);
+
+/**
+ * @brief Writes a byte to a port of the DIO interface, atomically ( ISR-safe ).
+ *
+ * Same as DIO_portWrite, but the masked read-modify-write runs with interrupts disabled.
+ *
+ * @param[in] en_a_portNumber The port number of the DIO interface to write to (PORT_A, PORT_B, PORT_C or PORT_D)
+ * @param[in] u8_a_portValue The byte value to write to the port (DIO_U8_PORT_LOW, DIO_U8_PORT_HIGH)
+ * @param[in] u8_a_mask The mask to use when setting the PORT of the port (DIO_NO_MASK, DIO_MASK_BITS_n..)
+ *
+ * @return An EN_DIO_ERROR_T value indicating the success or failure of the operation
+ *         (DIO_OK if the operation succeeded, DIO_ERROR otherwise)
+ */
+EN_DIO_ERROR_T DIO_portWriteAtomic(EN_DIO_PORT_T en_a_portNumber, u8 u8_a_portValue, u8 u8_a_mask);
+
+/**
+ * @brief Toggles the state of the pins of a port of the DIO interface, atomically ( ISR-safe ).
+ *
+ * Same as DIO_portToggle, but the XOR read-modify-write runs with interrupts disabled.
+ *
+ * @param[in] en_a_portNumber The port number of the DIO interface to toggle (PORT_A, PORT_B, PORT_C or PORT_D)
+ * @param[in] u8_a_mask The mask to use when toggling the PORT of the port (DIO_NO_MASK, DIO_MASK_BITS_n..)
+ *
+ * @return An EN_DIO_ERROR_T value indicating the success or failure of the operation
+ *         (DIO_OK if the operation succeeded, DIO_ERROR otherwise)
+ */
+EN_DIO_ERROR_T DIO_portToggleAtomic(EN_DIO_PORT_T en_a_portNumber, u8 u8_a_mask);
+
+/* ******************************************************* */
+/*            DIO Transactions Functions                   */
+/* ******************************************************  */
+
+/**
+ * @brief Begins a DIO transaction: nothing is staged.
+ *
+ * Pin and port changes staged in a transaction are only written by DIO_commitTransaction, with exactly one
+ * masked write per touched port, so the outputs of a port switch together, without intermediate states.
+ *
+ * @param[out] st_a_transaction Pointer to the transaction to begin.
+ *
+ * @return An EN_DIO_ERROR_T value indicating the success or failure of the operation
+ *         (DIO_OK if the operation succeeded, DIO_ERROR if the pointer is NULL)
+ */
+EN_DIO_ERROR_T DIO_beginTransaction(ST_DIO_transaction_t * st_a_transaction);
+
+/**
+ * @brief Stages the value of a pin in a DIO transaction, replacing any change of that pin staged before.
+ *
+ * @param[in,out] st_a_transaction Pointer to the transaction.
+ * @param[in] u8_a_pinNumber The pin number (DIO_U8_PIN_0 to DIO_U8_PIN_7)
+ * @param[in] en_a_portNumber The port of the pin (PORT_A, PORT_B, PORT_C or PORT_D)
+ * @param[in] u8_a_value The value to write (DIO_U8_PIN_HIGH or DIO_U8_PIN_LOW)
+ *
+ * @return An EN_DIO_ERROR_T value indicating the success or failure of the operation
+ *         (DIO_OK if the operation succeeded, DIO_ERROR otherwise)
+ */
+EN_DIO_ERROR_T DIO_stagePin(ST_DIO_transaction_t * st_a_transaction, u8 u8_a_pinNumber, EN_DIO_PORT_T en_a_portNumber, u8 u8_a_value);
+
+/**
+ * @brief Stages the masked value of a port in a DIO transaction, replacing any change of the masked pins staged before.
+ *
+ * @param[in,out] st_a_transaction Pointer to the transaction.
+ * @param[in] en_a_portNumber The port (PORT_A, PORT_B, PORT_C or PORT_D)
+ * @param[in] u8_a_portValue The byte value to write
+ * @param[in] u8_a_mask The pins to write (DIO_NO_MASK, DIO_MASK_BITS_n..), a mask of 0 is the whole port as in DIO_portWrite
+ *
+ * @return An EN_DIO_ERROR_T value indicating the success or failure of the operation
+ *         (DIO_OK if the operation succeeded, DIO_ERROR otherwise)
+ */
+EN_DIO_ERROR_T DIO_stagePort(ST_DIO_transaction_t * st_a_transaction, EN_DIO_PORT_T en_a_portNumber, u8 u8_a_portValue, u8 u8_a_mask);
+
+/**
+ * @brief Stages the toggle of port pins in a DIO transaction, the pins are inverted from their value at commit time.
+ *
+ * @param[in,out] st_a_transaction Pointer to the transaction.
+ * @param[in] en_a_portNumber The port (PORT_A, PORT_B, PORT_C or PORT_D)
+ * @param[in] u8_a_mask The pins to toggle, replacing any change of these pins staged before (a mask of 0 is the whole port)
+ *
+ * @return An EN_DIO_ERROR_T value indicating the success or failure of the operation
+ *         (DIO_OK if the operation succeeded, DIO_ERROR otherwise)
+ */
+EN_DIO_ERROR_T DIO_stageToggle(ST_DIO_transaction_t * st_a_transaction, EN_DIO_PORT_T en_a_portNumber, u8 u8_a_mask);
+
+/**
+ * @brief Commits a DIO transaction: exactly one masked write of each port with staged changes.
+ *
+ * Each port write runs with interrupts disabled, so a pin of the same port written by an ISR is never
+ * written back with its old value. Ports without staged changes are not touched. The transaction is
+ * left as it is, so it can be committed again.
+ *
+ * @param[in] st_a_transaction Pointer to the transaction to commit.
+ *
+ * @return An EN_DIO_ERROR_T value indicating the success or failure of the operation
+ *         (DIO_OK if the operation succeeded, DIO_ERROR if the pointer is NULL)
+ */
+EN_DIO_ERROR_T DIO_commitTransaction(const ST_DIO_transaction_t * st_a_transaction);
+
 #endif /* DIO_INTERFACE_H_ */
\ No newline at end of file
@@ -35,4 +35,9 @@
 #define DIO_U8_DDR_D_REG    *( ( volatile u8 * ) 0x31 )
 #define DIO_U8_PIN_D_REG    *( ( volatile u8 * ) 0x30 )
 
+/** Critical section of a port read-modify-write: interrupts disabled, then restored as they were ( nesting safe ),
+ *  a GLI nestable critical section ( MCAL/gli/gli_interface.h ) **/
+#define DIO_ENTER_CRITICAL( SREG_COPY )     GLI_ENTER_CRITICAL( SREG_COPY, GLI_U8_SITE_DIO )
+#define DIO_EXIT_CRITICAL( SREG_COPY )      GLI_EXIT_CRITICAL( SREG_COPY )
+
 #endif /* DIO_PRIVATE_H_ */
\ No newline at end of file
@@ -12,6 +12,16 @@
 #include "dio_private.h"
 #include "dio_config.h"
 #include "dio_interface.h"
+#include "../gli/gli_interface.h"
+
+/* ***************************************************************************************************************** */
+/* Declaration and Initialization */
+
+/* PORT registers, indexed by EN_DIO_PORT_T */
+static volatile u8 * const pu8_gs_dioPortRegs[DIO_PORTS_NUMBER] =
+{
+    &DIO_U8_PORT_A_REG, &DIO_U8_PORT_B_REG, &DIO_U8_PORT_C_REG, &DIO_U8_PORT_D_REG
+};
 
 /* ***************************************************************************************************************** */
 
@@ -314,3 +324,272 @@ EN_DIO_ERROR_T DIO_portToggle(EN_DIO_PORT_T en_a_portNumber, u8 u8_a_mask)
     }
     return DIO_OK;
 }
+
+/**
+ * @brief Reads all the pins of a port of the DIO interface at once
+ *
+ * This function reads the input register (PIN) of the port in one instruction, so all the pins of the
+ * port are sampled at the same instant, and the value is stored in the u8_a_portValue parameter.
+ *
+ * @param[in] en_a_portNumber The port number of the DIO interface to read from (PORT_A, PORT_B, PORT_C or PORT_D)
+ * @param[out] u8_a_portValue Pointer to an unsigned 8-bit integer where the value of the port will be stored
+ *
+ * @return An EN_DIO_ERROR_T value indicating the success or failure of the operation
+ *         (DIO_OK if the operation succeeded, DIO_ERROR otherwise)
+ */
+EN_DIO_ERROR_T DIO_portRead(EN_DIO_PORT_T en_a_portNumber, u8 * u8_a_portValue)
+{
+    if(u8_a_portValue == NULL) return DIO_ERROR;
+    switch (en_a_portNumber) {
+        case PORT_A:
+            *u8_a_portValue = DIO_U8_PIN_A_REG;
+            break;
+        case PORT_B:
+            *u8_a_portValue = DIO_U8_PIN_B_REG;
+            break;
+        case PORT_C:
+            *u8_a_portValue = DIO_U8_PIN_C_REG;
+            break;
+        case PORT_D:
+            *u8_a_portValue = DIO_U8_PIN_D_REG;
+            break;
+        default:
+            return DIO_ERROR;
+    }
+    return DIO_OK;
+}
+
+/* ******************************************************* */
+/*            DIO Atomic Functions                         */
+/* ******************************************************  */
+
+/**
+ * @brief Writes a digital value to a specific pin in a specific port, atomically ( ISR-safe ).
+ *
+ * Same as DIO_write, but the port read-modify-write runs with interrupts disabled ( only the load, OR/AND
+ * and store of the port register, reached through its pointer in the ports table, LD/ST rather than IN/OUT ),
+ * so it never undoes a write of another pin of the port done by an ISR.
+ *
+ * @param[in] u8_a_pinNumber The number of the pin to write to. (DIO_U8_PIN_0 to DIO_U8_PIN_7)
+ * @param[in] en_a_portNumber The port number to write to. (PORT_A, PORT_B, PORT_C or PORT_D)
+ * @param[in] u8_a_value The digital value to write (either DIO_U8_PIN_HIGH or DIO_U8_PIN_LOW).
+ *
+ * @return EN_DIO_ERROR_T Returns DIO_OK if the write is successful, DIO_ERROR otherwise.
+ */
+EN_DIO_ERROR_T DIO_writeAtomic(u8 u8_a_pinNumber, EN_DIO_PORT_T en_a_portNumber, u8 u8_a_value)
+{
+    u8 u8_l_mask;
+    u8 u8_l_sreg;
+
+    if(u8_a_pinNumber > DIO_MAX_PIN_NO || en_a_portNumber >= DIO_PORTS_NUMBER) return DIO_ERROR;
+    if(u8_a_value != DIO_U8_PIN_HIGH && u8_a_value != DIO_U8_PIN_LOW) return DIO_ERROR;
+
+    u8_l_mask = (u8) (1 << u8_a_pinNumber);
+
+    DIO_ENTER_CRITICAL(u8_l_sreg);
+    if (u8_a_value == DIO_U8_PIN_HIGH) *pu8_gs_dioPortRegs[en_a_portNumber] |= u8_l_mask;
+    else                               *pu8_gs_dioPortRegs[en_a_portNumber] &= (u8) ~u8_l_mask;
+    DIO_EXIT_CRITICAL(u8_l_sreg);
+
+    return DIO_OK;
+}
+
+/**
+ * @brief Toggles the state of a pin in the specified port, atomically ( ISR-safe ).
+ *
+ * Same as DIO_toggle, but the pin is inverted with one read-modify-write run with interrupts disabled.
+ *
+ * @param[in] u8_a_pinNumber The pin number to toggle. (DIO_U8_PIN_0 to DIO_U8_PIN_7)
+ * @param[in] en_a_portNumber The port to which the pin belongs. (PORT_A, PORT_B, PORT_C or PORT_D)
+ *
+ * @return EN_DIO_ERROR_T Returns DIO_OK on success or DIO_ERROR if an error occurred.
+ */
+EN_DIO_ERROR_T DIO_toggleAtomic(u8 u8_a_pinNumber, EN_DIO_PORT_T en_a_portNumber)
+{
+    u8 u8_l_sreg;
+
+    if(u8_a_pinNumber > DIO_MAX_PIN_NO || en_a_portNumber >= DIO_PORTS_NUMBER) return DIO_ERROR;
+
+    DIO_ENTER_CRITICAL(u8_l_sreg);
+    *pu8_gs_dioPortRegs[en_a_portNumber] ^= (u8) (1 << u8_a_pinNumber);
+    DIO_EXIT_CRITICAL(u8_l_sreg);
+
+    return DIO_OK;
+}
+
+/**
+ * @brief Writes a byte to a port of the DIO interface, atomically ( ISR-safe ).
+ *
+ * Same as DIO_portWrite, but the masked read-modify-write runs with interrupts disabled.
+ *
+ * @param[in] en_a_portNumber The port number of the DIO interface to write to (PORT_A, PORT_B, PORT_C or PORT_D)
+ * @param[in] u8_a_portValue The byte value to write to the port (DIO_U8_PORT_LOW, DIO_U8_PORT_HIGH)
+ * @param[in] u8_a_mask The mask to use when setting the PORT of the port (DIO_NO_MASK, DIO_MASK_BITS_n..)
+ *
+ * @return An EN_DIO_ERROR_T value indicating the success or failure of the operation
+ *         (DIO_OK if the operation succeeded, DIO_ERROR otherwise)
+ */
+EN_DIO_ERROR_T DIO_portWriteAtomic(EN_DIO_PORT_T en_a_portNumber, u8 u8_a_portValue, u8 u8_a_mask)
+{
+    u8 u8_l_sreg;
+
+    if(en_a_portNumber >= DIO_PORTS_NUMBER) return DIO_ERROR;
+    if(u8_a_mask == 0) u8_a_mask = 0xFF;
+
+    DIO_ENTER_CRITICAL(u8_l_sreg);
+    *pu8_gs_dioPortRegs[en_a_portNumber] = ((~u8_a_mask) & *pu8_gs_dioPortRegs[en_a_portNumber]) | (u8_a_mask & u8_a_portValue);
+    DIO_EXIT_CRITICAL(u8_l_sreg);
+
+    return DIO_OK;
+}
+
+/**
+ * @brief Toggles the state of the pins of a port of the DIO interface, atomically ( ISR-safe ).
+ *
+ * Same as DIO_portToggle, but the XOR read-modify-write runs with interrupts disabled.
+ *
+ * @param[in] en_a_portNumber The port number of the DIO interface to toggle (PORT_A, PORT_B, PORT_C or PORT_D)
+ * @param[in] u8_a_mask The mask to use when toggling the PORT of the port (DIO_NO_MASK, DIO_MASK_BITS_n..)
+ *
+ * @return An EN_DIO_ERROR_T value indicating the success or failure of the operation
+ *         (DIO_OK if the operation succeeded, DIO_ERROR otherwise)
+ */
+EN_DIO_ERROR_T DIO_portToggleAtomic(EN_DIO_PORT_T en_a_portNumber, u8 u8_a_mask)
+{
+    u8 u8_l_sreg;
+
+    if(en_a_portNumber >= DIO_PORTS_NUMBER) return DIO_ERROR;
+    if(u8_a_mask == 0) u8_a_mask = 0xFF;
+
+    DIO_ENTER_CRITICAL(u8_l_sreg);
+    *pu8_gs_dioPortRegs[en_a_portNumber] ^= u8_a_mask;
+    DIO_EXIT_CRITICAL(u8_l_sreg);
+
+    return DIO_OK;
+}
+
+/* ******************************************************* */
+/*            DIO Transactions Functions                   */
+/* ******************************************************  */
+
+/**
+ * @brief Begins a DIO transaction: nothing is staged.
+ *
+ * Pin and port changes staged in a transaction are only written by DIO_commitTransaction, with exactly one
+ * masked write per touched port, so the outputs of a port switch together, without intermediate states.
+ *
+ * @param[out] st_a_transaction Pointer to the transaction to begin.
+ *
+ * @return An EN_DIO_ERROR_T value indicating the success or failure of the operation
+ *         (DIO_OK if the operation succeeded, DIO_ERROR if the pointer is NULL)
+ */
+EN_DIO_ERROR_T DIO_beginTransaction(ST_DIO_transaction_t * st_a_transaction)
+{
+    u8 u8_l_port;
+
+    if(st_a_transaction == NULL) return DIO_ERROR;
+
+    for(u8_l_port = 0; u8_l_port < DIO_PORTS_NUMBER; u8_l_port++) {
+        st_a_transaction->u8_setMask[u8_l_port] = 0;
+        st_a_transaction->u8_clearMask[u8_l_port] = 0;
+        st_a_transaction->u8_toggleMask[u8_l_port] = 0;
+    }
+    return DIO_OK;
+}
+
+/**
+ * @brief Stages the value of a pin in a DIO transaction, replacing any change of that pin staged before.
+ *
+ * @param[in,out] st_a_transaction Pointer to the transaction.
+ * @param[in] u8_a_pinNumber The pin number (DIO_U8_PIN_0 to DIO_U8_PIN_7)
+ * @param[in] en_a_portNumber The port of the pin (PORT_A, PORT_B, PORT_C or PORT_D)
+ * @param[in] u8_a_value The value to write (DIO_U8_PIN_HIGH or DIO_U8_PIN_LOW)
+ *
+ * @return An EN_DIO_ERROR_T value indicating the success or failure of the operation
+ *         (DIO_OK if the operation succeeded, DIO_ERROR otherwise)
+ */
+EN_DIO_ERROR_T DIO_stagePin(ST_DIO_transaction_t * st_a_transaction, u8 u8_a_pinNumber, EN_DIO_PORT_T en_a_portNumber, u8 u8_a_value)
+{
+    if(u8_a_pinNumber > DIO_MAX_PIN_NO) return DIO_ERROR;
+    if(u8_a_value != DIO_U8_PIN_HIGH && u8_a_value != DIO_U8_PIN_LOW) return DIO_ERROR;
+
+    return DIO_stagePort(st_a_transaction, en_a_portNumber, (u8_a_value == DIO_U8_PIN_HIGH) ? DIO_U8_PORT_HIGH : DIO_U8_PORT_LOW,
+                         (u8) (1 << u8_a_pinNumber));
+}
+
+/**
+ * @brief Stages the masked value of a port in a DIO transaction, replacing any change of the masked pins staged before.
+ *
+ * @param[in,out] st_a_transaction Pointer to the transaction.
+ * @param[in] en_a_portNumber The port (PORT_A, PORT_B, PORT_C or PORT_D)
+ * @param[in] u8_a_portValue The byte value to write
+ * @param[in] u8_a_mask The pins to write (DIO_NO_MASK, DIO_MASK_BITS_n..), a mask of 0 is the whole port as in DIO_portWrite
+ *
+ * @return An EN_DIO_ERROR_T value indicating the success or failure of the operation
+ *         (DIO_OK if the operation succeeded, DIO_ERROR otherwise)
+ */
+EN_DIO_ERROR_T DIO_stagePort(ST_DIO_transaction_t * st_a_transaction, EN_DIO_PORT_T en_a_portNumber, u8 u8_a_portValue, u8 u8_a_mask)
+{
+    if(st_a_transaction == NULL || en_a_portNumber >= DIO_PORTS_NUMBER) return DIO_ERROR;
+    if(u8_a_mask == 0) u8_a_mask = 0xFF;
+
+    st_a_transaction->u8_setMask[en_a_portNumber]    = (st_a_transaction->u8_setMask[en_a_portNumber] & ~u8_a_mask) | (u8_a_mask & u8_a_portValue);
+    st_a_transaction->u8_clearMask[en_a_portNumber]  = (st_a_transaction->u8_clearMask[en_a_portNumber] & ~u8_a_mask) | (u8_a_mask & ~u8_a_portValue);
+    st_a_transaction->u8_toggleMask[en_a_portNumber] &= ~u8_a_mask;
+    return DIO_OK;
+}
+
+/**
+ * @brief Stages the toggle of port pins in a DIO transaction, the pins are inverted from their value at commit time.
+ *
+ * @param[in,out] st_a_transaction Pointer to the transaction.
+ * @param[in] en_a_portNumber The port (PORT_A, PORT_B, PORT_C or PORT_D)
+ * @param[in] u8_a_mask The pins to toggle, replacing any change of these pins staged before (a mask of 0 is the whole port)
+ *
+ * @return An EN_DIO_ERROR_T value indicating the success or failure of the operation
+ *         (DIO_OK if the operation succeeded, DIO_ERROR otherwise)
+ */
+EN_DIO_ERROR_T DIO_stageToggle(ST_DIO_transaction_t * st_a_transaction, EN_DIO_PORT_T en_a_portNumber, u8 u8_a_mask)
+{
+    if(st_a_transaction == NULL || en_a_portNumber >= DIO_PORTS_NUMBER) return DIO_ERROR;
+    if(u8_a_mask == 0) u8_a_mask = 0xFF;
+
+    st_a_transaction->u8_setMask[en_a_portNumber]    &= ~u8_a_mask;
+    st_a_transaction->u8_clearMask[en_a_portNumber]  &= ~u8_a_mask;
+    st_a_transaction->u8_toggleMask[en_a_portNumber] |= u8_a_mask;
+    return DIO_OK;
+}
+
+/**
+ * @brief Commits a DIO transaction: exactly one masked write of each port with staged changes.
+ *
+ * Each port write runs with interrupts disabled, so a pin of the same port written by an ISR is never
+ * written back with its old value. Ports without staged changes are not touched. The transaction is
+ * left as it is, so it can be committed again.
+ *
+ * @param[in] st_a_transaction Pointer to the transaction to commit.
+ *
+ * @return An EN_DIO_ERROR_T value indicating the success or failure of the operation
+ *         (DIO_OK if the operation succeeded, DIO_ERROR if the pointer is NULL)
+ */
+EN_DIO_ERROR_T DIO_commitTransaction(const ST_DIO_transaction_t * st_a_transaction)
+{
+    u8 u8_l_port;
+    u8 u8_l_sreg;
+
+    if(st_a_transaction == NULL) return DIO_ERROR;
+
+    for(u8_l_port = 0; u8_l_port < DIO_PORTS_NUMBER; u8_l_port++) {
+        u8 u8_l_set    = st_a_transaction->u8_setMask[u8_l_port];
+        u8 u8_l_clear  = st_a_transaction->u8_clearMask[u8_l_port];
+        u8 u8_l_toggle = st_a_transaction->u8_toggleMask[u8_l_port];
+
+        if((u8_l_set | u8_l_clear | u8_l_toggle) == 0) continue;
+
+        // one read-modify-write of the port, interrupts disabled
+        DIO_ENTER_CRITICAL(u8_l_sreg);
+        *pu8_gs_dioPortRegs[u8_l_port] = (((*pu8_gs_dioPortRegs[u8_l_port]) & ~u8_l_clear) | u8_l_set) ^ u8_l_toggle;
+        DIO_EXIT_CRITICAL(u8_l_sreg);
+    }
+    return DIO_OK;
+}
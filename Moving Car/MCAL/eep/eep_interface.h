@@ -0,0 +1,83 @@
+/*
+ * eep_interface.h
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: This file contains all Internal EEPROM (EEP) functions' prototypes and definitions (Macros) to avoid magic numbers.
+ *  MCU Datasheet: AVR ATmega32 - https://ww1.microchip.com/downloads/en/DeviceDoc/Atmega32A-DataSheet-Complete-DS40002072A.pdf
+ */
+
+#ifndef EEP_INTERFACE_H_
+#define EEP_INTERFACE_H_
+
+/* ***********************************************************************************************/
+/* EEP Includes */
+
+/* LIB */
+#include "../../LIB/std.h"
+#include "../../LIB/bit_math.h"
+
+/* ***********************************************************************************************/
+/* EEP Macros */
+
+/* ATmega32 has 1024 bytes of EEPROM, addressed from 0 to 1023 */
+#define EEP_U16_SIZE				1024
+
+typedef enum {
+	EEP_OK,
+	EEP_ERROR
+}EN_EEP_ERROR_T;
+
+/* ***********************************************************************************************/
+/* EEP Functions' Prototypes */
+
+/**
+ * @brief Reads one byte from the internal EEPROM.
+ *
+ * @param[in]  u16_a_address EEPROM address to read from (0 to EEP_U16_SIZE - 1).
+ * @param[out] u8_a_data     Pointer to where the read byte will be stored.
+ *
+ * @return EEP_OK if the byte was read, EEP_ERROR if the address is out of range or the pointer is NULL.
+ */
+EN_EEP_ERROR_T EEP_readByte  ( u16 u16_a_address, u8 *u8_a_data );
+
+/**
+ * @brief Writes one byte to the internal EEPROM.
+ *
+ * The function waits for any previous write to complete, then starts the new write.
+ * Global interrupts are held off only for the EEMWE/EEWE sequence that must complete within 4 cycles.
+ *
+ * @param[in] u16_a_address EEPROM address to write to (0 to EEP_U16_SIZE - 1).
+ * @param[in] u8_a_data     Byte to be written.
+ *
+ * @return EEP_OK if the write was started, EEP_ERROR if the address is out of range.
+ */
+EN_EEP_ERROR_T EEP_writeByte ( u16 u16_a_address, u8 u8_a_data );
+
+/**
+ * @brief Reads a block of bytes from the internal EEPROM.
+ *
+ * @param[in]  u16_a_address Start address in EEPROM.
+ * @param[out] u8_a_data     Pointer to the destination buffer.
+ * @param[in]  u16_a_length  Number of bytes to read.
+ *
+ * @return EEP_OK if the block was read, EEP_ERROR if the block does not fit in EEPROM or the pointer is NULL.
+ */
+EN_EEP_ERROR_T EEP_readBlock ( u16 u16_a_address, u8 *u8_a_data, u16 u16_a_length );
+
+/**
+ * @brief Writes a block of bytes to the internal EEPROM, skipping bytes that already hold the required value.
+ *
+ * Skipping unchanged bytes saves the ~8.5 ms write time per byte and the EEPROM write endurance.
+ *
+ * @param[in] u16_a_address Start address in EEPROM.
+ * @param[in] u8_a_data     Pointer to the source buffer.
+ * @param[in] u16_a_length  Number of bytes to write.
+ *
+ * @return EEP_OK if the block was written, EEP_ERROR if the block does not fit in EEPROM or the pointer is NULL.
+ */
+EN_EEP_ERROR_T EEP_updateBlock( u16 u16_a_address, const u8 *u8_a_data, u16 u16_a_length );
+
+/* ***********************************************************************************************/
+
+#endif /* EEP_INTERFACE_H_ */
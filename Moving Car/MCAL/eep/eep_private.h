@@ -0,0 +1,39 @@
+/*
+ * eep_private.h
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: This file contains all Internal EEPROM (EEP) registers' locations and description.
+ *  MCU Datasheet: AVR ATmega32 - https://ww1.microchip.com/downloads/en/DeviceDoc/Atmega32A-DataSheet-Complete-DS40002072A.pdf
+ */
+
+#ifndef EEP_PRIVATE_H_
+#define EEP_PRIVATE_H_
+
+/* ***********************************************************************************************/
+/* EEP Registers' Locations */
+
+#define EEP_U8_EEARH_REG		*( ( volatile u8 * ) 0x3F )
+#define EEP_U8_EEARL_REG		*( ( volatile u8 * ) 0x3E )
+/* DataType is u16 * in order to get both registers ( i.e. EEARL and EEARH respectively ) locations in memory */
+#define EEP_U16_EEAR_REG		*( ( volatile u16 * ) 0x3E )
+#define EEP_U8_EEDR_REG			*( ( volatile u8 * ) 0x3D )
+#define EEP_U8_EECR_REG			*( ( volatile u8 * ) 0x3C )
+
+/* ***********************************************************************************************/
+/* EEP Registers' Description */
+
+/* EEPROM Control Register - EECR */
+/* Bit 3 - EERIE: EEPROM Ready Interrupt Enable */
+#define EEP_U8_EERIE_BIT		3
+/* Bit 2 - EEMWE: EEPROM Master Write Enable */
+#define EEP_U8_EEMWE_BIT		2
+/* Bit 1 - EEWE: EEPROM Write Enable */
+#define EEP_U8_EEWE_BIT			1
+/* Bit 0 - EERE: EEPROM Read Enable */
+#define EEP_U8_EERE_BIT			0
+/* End of EECR Register */
+
+/* ***********************************************************************************************/
+
+#endif /* EEP_PRIVATE_H_ */
@@ -0,0 +1,132 @@
+/*
+ * eep_program.c
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: This file contains all Internal EEPROM (EEP) functions' implementation.
+ *  MCU Datasheet: AVR ATmega32 - https://ww1.microchip.com/downloads/en/DeviceDoc/Atmega32A-DataSheet-Complete-DS40002072A.pdf
+ */
+
+/* MCAL */
+#include "eep_private.h"
+#include "eep_interface.h"
+#include "../gli/gli_interface.h"
+
+/* ***********************************************************************************************/
+
+/**
+ * @brief Reads one byte from the internal EEPROM.
+ *
+ * @param[in]  u16_a_address EEPROM address to read from (0 to EEP_U16_SIZE - 1).
+ * @param[out] u8_a_data     Pointer to where the read byte will be stored.
+ *
+ * @return EEP_OK if the byte was read, EEP_ERROR if the address is out of range or the pointer is NULL.
+ */
+EN_EEP_ERROR_T EEP_readByte  ( u16 u16_a_address, u8 *u8_a_data )
+{
+	/* Check 1: Address is in the valid range, and Pointer is not equal to NULL */
+	if ( ( u16_a_address >= EEP_U16_SIZE ) || ( u8_a_data == NULL ) ) return EEP_ERROR;
+
+	/* Step 1: Wait for any ongoing write to complete */
+	while ( GET_BIT( EEP_U8_EECR_REG, EEP_U8_EEWE_BIT ) );
+
+	/* Step 2: Set up the address, then start the read ( data is ready in the next instruction ) */
+	EEP_U16_EEAR_REG = u16_a_address;
+	SET_BIT( EEP_U8_EECR_REG, EEP_U8_EERE_BIT );
+	*u8_a_data = EEP_U8_EEDR_REG;
+
+	return EEP_OK;
+}
+
+/**
+ * @brief Writes one byte to the internal EEPROM.
+ *
+ * The function waits for any previous write to complete, then starts the new write.
+ * Global interrupts are held off only for the EEMWE/EEWE sequence that must complete within 4 cycles ( GLI section ).
+ *
+ * @param[in] u16_a_address EEPROM address to write to (0 to EEP_U16_SIZE - 1).
+ * @param[in] u8_a_data     Byte to be written.
+ *
+ * @return EEP_OK if the write was started, EEP_ERROR if the address is out of range.
+ */
+EN_EEP_ERROR_T EEP_writeByte ( u16 u16_a_address, u8 u8_a_data )
+{
+	u8 u8_l_sreg;
+
+	/* Check 1: Address is in the valid range */
+	if ( u16_a_address >= EEP_U16_SIZE ) return EEP_ERROR;
+
+	/* Step 1: Wait for any ongoing write to complete */
+	while ( GET_BIT( EEP_U8_EECR_REG, EEP_U8_EEWE_BIT ) );
+
+	/* Step 2: Set up the address and data */
+	EEP_U16_EEAR_REG = u16_a_address;
+	EEP_U8_EEDR_REG  = u8_a_data;
+
+	/* Step 3: EEWE must be set within 4 cycles of EEMWE, so no interrupt may run in between */
+	GLI_ENTER_CRITICAL( u8_l_sreg, GLI_U8_SITE_EEP );
+	SET_BIT( EEP_U8_EECR_REG, EEP_U8_EEMWE_BIT );
+	SET_BIT( EEP_U8_EECR_REG, EEP_U8_EEWE_BIT );
+	GLI_EXIT_CRITICAL( u8_l_sreg );
+
+	return EEP_OK;
+}
+
+/**
+ * @brief Reads a block of bytes from the internal EEPROM.
+ *
+ * @param[in]  u16_a_address Start address in EEPROM.
+ * @param[out] u8_a_data     Pointer to the destination buffer.
+ * @param[in]  u16_a_length  Number of bytes to read.
+ *
+ * @return EEP_OK if the block was read, EEP_ERROR if the block does not fit in EEPROM or the pointer is NULL.
+ */
+EN_EEP_ERROR_T EEP_readBlock ( u16 u16_a_address, u8 *u8_a_data, u16 u16_a_length )
+{
+	u16 u16_l_index;
+
+	/* Check 1: Block fits in EEPROM, and Pointer is not equal to NULL */
+	if ( ( u8_a_data == NULL ) || ( u16_a_length > EEP_U16_SIZE ) || ( u16_a_address > ( EEP_U16_SIZE - u16_a_length ) ) ) return EEP_ERROR;
+
+	for ( u16_l_index = 0; u16_l_index < u16_a_length; u16_l_index++ )
+	{
+		EEP_readByte( u16_a_address + u16_l_index, &u8_a_data[u16_l_index] );
+	}
+
+	return EEP_OK;
+}
+
+/**
+ * @brief Writes a block of bytes to the internal EEPROM, skipping bytes that already hold the required value.
+ *
+ * Skipping unchanged bytes saves the ~8.5 ms write time per byte and the EEPROM write endurance.
+ *
+ * @param[in] u16_a_address Start address in EEPROM.
+ * @param[in] u8_a_data     Pointer to the source buffer.
+ * @param[in] u16_a_length  Number of bytes to write.
+ *
+ * @return EEP_OK if the block was written, EEP_ERROR if the block does not fit in EEPROM or the pointer is NULL.
+ */
+EN_EEP_ERROR_T EEP_updateBlock( u16 u16_a_address, const u8 *u8_a_data, u16 u16_a_length )
+{
+	u16 u16_l_index;
+	u8  u8_l_storedByte;
+
+	/* Check 1: Block fits in EEPROM, and Pointer is not equal to NULL */
+	if ( ( u8_a_data == NULL ) || ( u16_a_length > EEP_U16_SIZE ) || ( u16_a_address > ( EEP_U16_SIZE - u16_a_length ) ) ) return EEP_ERROR;
+
+	for ( u16_l_index = 0; u16_l_index < u16_a_length; u16_l_index++ )
+	{
+		EEP_readByte( u16_a_address + u16_l_index, &u8_l_storedByte );
+
+		/* Check 1.1: Stored byte differs from the required one */
+		if ( u8_l_storedByte != u8_a_data[u16_l_index] )
+		{
+			EEP_writeByte( u16_a_address + u16_l_index, u8_a_data[u16_l_index] );
+		}
+	}
+
+	return EEP_OK;
+}
+
+/* ***********************************************************************************************/
@@ -0,0 +1,65 @@
+/*
+ * exi_config.h
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: This file contains all External Interrupt (EXI) pre-build configurations, through which user can configure before using the EXI peripheral.
+ *  MCU Datasheet: AVR ATmega32 - https://ww1.microchip.com/downloads/en/DeviceDoc/Atmega32A-DataSheet-Complete-DS40002072A.pdf
+ */
+
+#ifndef EXI_CONFIG_H_
+#define EXI_CONFIG_H_
+
+/* ***********************************************************************************************/
+/* INT0 Safe State ( Emergency Stop Fast Path ) */
+
+/* When enabled, the INT0 vector clears the pins of EXI_U8_INT0_SAFE_MASK in EXI_U8_INT0_SAFE_PORT as its very first
+ * instructions, before any register is saved or the callback is called. The mask is expanded at build time into one
+ * CBI per set bit: no register, no SREG, nothing the interrupted code can observe.
+ *
+ * Worst-case edge to first pin low, in CPU cycles ( datasheet timings, not measured ):
+ *  - Edge synchronizer and INT0 flag			: 2
+ *  - Completion of the current instruction		: 3	( 4-cycle CALL/RET/RETI, minus the cycle already counted )
+ *  - Interrupt response ( push PC, vector )	: 4	( + 4 more when woken up from Idle sleep )
+ *  - JMP in the vector table					: 3
+ *  - CBI										: 2
+ *  Total: 14 cycles ( 1.75 usec. at 8 MHz ), 18 cycles ( 2.25 usec. ) from Idle sleep, + 2 cycles per further pin.
+ *
+ * On top of that, INT0 waits for the longest section that runs with interrupts disabled: any other ISR, and every
+ * critical section of the application. Tools/estop_bench measures the whole edge to pin low latency on target, its
+ * results section holds the measured figures once a board run is recorded ( none yet ).
+ *
+ * The pins must be the motors' PWM pins ( HAL/dcm/dcm_config.h ), and the code writing them high must do it with
+ * interrupts disabled after checking the shutdown flag, or a read-modify-write interrupted by INT0 could set them back.
+ */
+#define EXI_U8_INT0_SAFE_STATE			STD_OK
+
+/* Options: EXI_U8_SAFE_PORT_A, EXI_U8_SAFE_PORT_B, EXI_U8_SAFE_PORT_C, EXI_U8_SAFE_PORT_D */
+#define EXI_U8_INT0_SAFE_PORT			EXI_U8_SAFE_PORT_C
+
+/* Motor 0 PWM ( PC0 ) and Motor 1 PWM ( PC1 ) */
+#define EXI_U8_INT0_SAFE_MASK			0x03
+
+/* ***********************************************************************************************/
+/* ISR Binding */
+
+/* STD_NOK: every vector calls the function set with EXI_intSetCallBack, through a pointer ( runtime binding ).
+ * STD_OK : a vector whose EXI_INTn_HANDLER() is defined in APP/app_bindings.h runs it directly ( compile-time binding ),
+ *          the others keep the runtime binding. EXI_intSetCallBack still stores its function, but a bound vector
+ *          ignores it.
+ *
+ * A call through a pointer is opaque to the compiler, so the ISR must save all 12 call-clobbered registers and SREG
+ * whatever the callback does, and load and test the pointer first. A handler that is a macro expanding to a few
+ * statements is inlined in the vector: the ISR saves only the registers it uses. A handler that is a function
+ * defined in another file is called directly: the load and the test go, the full register save stays.
+ * Tools/isr_bench measures the ISR cycles of both bindings on target or in simavr, no run is recorded yet.
+ */
+#ifndef EXI_U8_STATIC_BINDING
+#define EXI_U8_STATIC_BINDING			STD_OK
+#endif
+
+/* End of Configurations */
+
+/* ***********************************************************************************************/
+
+#endif /* EXI_CONFIG_H_ */
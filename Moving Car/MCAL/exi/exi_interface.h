@@ -31,6 +31,12 @@
 #define EXI_U8_SENSE_FALLING_EDGE		2
 #define EXI_U8_SENSE_RISING_EDGE		3
 
+/* I/O addresses of the PORT registers, for the INT0 safe state ( CBI reaches I/O addresses 0 to 31 only ) */
+#define EXI_U8_SAFE_PORT_A				0x1B
+#define EXI_U8_SAFE_PORT_B				0x18
+#define EXI_U8_SAFE_PORT_C				0x15
+#define EXI_U8_SAFE_PORT_D				0x12
+
 /* ***********************************************************************************************/
 /* EXI Functions' Prototypes */
 
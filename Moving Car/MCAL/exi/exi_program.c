@@ -11,8 +11,14 @@
  
 /* MCAL */
 #include "exi_private.h"
+#include "exi_config.h"
 #include "exi_interface.h"
 
+/* Compile-time bound handlers, from the application */
+#if ( EXI_U8_STATIC_BINDING == STD_OK )
+#include "../../APP/app_bindings.h"
+#endif
+
 /* Declaration and Initialization */
 
 /* Global Array of 3 Pointers to Functions ( because we have 3 External Interrupts ),
@@ -162,10 +168,19 @@ u8 EXI_intSetCallBack( u8 u8_a_interruptId, void ( *pf_a_interruptAction ) ( voi
 }
 
 
+#if EXI_U8_INT0_SAFE_STATE == STD_OK
+/**
+ * ISR function prototypes for External Interrupt Request 0 ( INT0 ): the naked vector drives the safe state,
+ * then jumps to the tail, which is a regular ISR ( saves the registers, calls back, and returns with RETI )
+ * */
+void __vector_1( void )		__attribute__((naked));
+void __vector_1_tail( void )	__attribute__((signal, used));
+#else
 /**
  * ISR function prototypes for External Interrupt Request 0 ( INT0 )
  * */
 void __vector_1( void )		__attribute__((signal));
+#endif
 
 /**
  * ISR function prototypes for External Interrupt Request 1 ( INT1 )
@@ -178,17 +193,48 @@ void __vector_2( void )		__attribute__((signal));
 void __vector_3( void )		__attribute__((signal));
 
 
+#if EXI_U8_INT0_SAFE_STATE == STD_OK
+/* Naked functions can only hold basic asm: the mask and the port are pasted as text */
+#define EXI_STRING( X )			#X
+#define EXI_TEXT( X )			EXI_STRING( X )
+
+/* One CBI on the safe port if BIT is set in the safe mask, resolved by the assembler */
+#define EXI_SAFE_CBI( BIT )		".if ( " EXI_TEXT( EXI_U8_INT0_SAFE_MASK ) " & ( 1 << " #BIT " ) )"	"\n\t"	\
+								"cbi " EXI_TEXT( EXI_U8_INT0_SAFE_PORT ) ", " #BIT				"\n\t"	\
+								".endif"														"\n\t"
+
+/**
+ * ISR function implementation of INT0, safe state fast path ( see exi_config.h for the worst-case latency )
+ * */
+void __vector_1( void )
+{
+	__asm__ __volatile__ ( EXI_SAFE_CBI( 0 ) EXI_SAFE_CBI( 1 ) EXI_SAFE_CBI( 2 ) EXI_SAFE_CBI( 3 )
+						   EXI_SAFE_CBI( 4 ) EXI_SAFE_CBI( 5 ) EXI_SAFE_CBI( 6 ) EXI_SAFE_CBI( 7 )
+						   "jmp __vector_1_tail" );
+}
+
+/**
+ * ISR function implementation of INT0, after the safe state is driven
+ * */
+void __vector_1_tail( void )
+#else
 /**
  * ISR function implementation of INT0
  * */
 void __vector_1( void )
+#endif
 {
+#if ( EXI_U8_STATIC_BINDING == STD_OK ) && defined( EXI_INT0_HANDLER )
+	/* Compile-time binding ( exi_config.h, APP/app_bindings.h ) */
+	EXI_INT0_HANDLER();
+#else
 	/* Check: INT0 index of the Global Array is not equal to NULL */
 	if ( void_gs_apfInterrupstAction[EXI_U8_INT0] != NULL )
 	{
 		/* Call Back the function ( in APP Layer ), which its address is stored in the Global Array of Pointers to Functions ( INTInterruptsAction ) */
 		void_gs_apfInterrupstAction[EXI_U8_INT0]();
 	}	
+#endif
 }
 
 /**
@@ -196,12 +242,17 @@ void __vector_1( void )
  * */
 void __vector_2( void )
 {
+#if ( EXI_U8_STATIC_BINDING == STD_OK ) && defined( EXI_INT1_HANDLER )
+	/* Compile-time binding ( exi_config.h, APP/app_bindings.h ) */
+	EXI_INT1_HANDLER();
+#else
 	/* Check: INT1 index of the Global Array is not equal to NULL */
 	if( void_gs_apfInterrupstAction[EXI_U8_INT1] != NULL )
 	{
 		/* Call Back the function ( in APP Layer ), which its address is stored in the Global Array of Pointers to Functions ( INTInterruptsAction ) */
 		void_gs_apfInterrupstAction[EXI_U8_INT1]();
 	}	
+#endif
 }
 
 
@@ -210,10 +261,15 @@ void __vector_2( void )
  * */
 void __vector_3( void )
 {
+#if ( EXI_U8_STATIC_BINDING == STD_OK ) && defined( EXI_INT2_HANDLER )
+	/* Compile-time binding ( exi_config.h, APP/app_bindings.h ) */
+	EXI_INT2_HANDLER();
+#else
 	/* Check: INT2 index of the Global Array is not equal to NULL */
 	if( void_gs_apfInterrupstAction[EXI_U8_INT2] != NULL )
 	{
 		/* Call Back the function ( in APP Layer ), which its address is stored in the Global Array of Pointers to Functions ( INTInterruptsAction ) */
 		void_gs_apfInterrupstAction[EXI_U8_INT2]();
 	}	
+#endif
 }
\ No newline at end of file
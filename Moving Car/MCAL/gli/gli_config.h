@@ -0,0 +1,34 @@
+/*
+ * gli_config.h
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: This file contains all Global Interrupt (GLI) pre-build configurations, through which user can configure before using the GLI peripheral.
+ *  MCU Datasheet: AVR ATmega32 - https://ww1.microchip.com/downloads/en/DeviceDoc/Atmega32A-DataSheet-Complete-DS40002072A.pdf
+ */
+
+#ifndef GLI_CONFIG_H_
+#define GLI_CONFIG_H_
+
+/* ***********************************************************************************************/
+/* GLI Configurations */
+
+/* Critical sections call sites, reported with the longest interrupts-disabled span in DEBUG builds */
+#define GLI_U8_SITE_DIO				0		// DIO atomic writes and transactions
+#define GLI_U8_SITE_SCH_DISPATCH	1		// SCH ready bit consumed by the dispatcher
+#define GLI_U8_SITE_SCH_TASKS		2		// SCH task suspended or resumed
+#define GLI_U8_SITE_SCH_IDLE		3		// SCH stretched tick ended after a wake-up
+#define GLI_U8_SITE_DCM_PWM			4		// DCM motors PWM pins written
+#define GLI_U8_SITE_EVG				5		// EVG flags raised, released, or read and released
+#define GLI_U8_SITE_DFR				6		// DFR pending works scanned between two bottom halves
+#define GLI_U8_SITE_KRN				7		// KRN ticks read, or queue item removed
+#define GLI_U8_SITE_EEP				8		// EEP write started ( EEMWE then EEWE within 4 cycles )
+#define GLI_U8_SITE_WDT				9		// WDT stopped ( WDTOE timed sequence )
+/* No span recorded yet */
+#define GLI_U8_SITE_NONE			0xFF
+
+/* End of Configurations */
+
+/* ***********************************************************************************************/
+
+#endif /* GLI_CONFIG_H_ */
@@ -17,12 +17,62 @@
 #include "../../LIB/std.h"
 #include "../../LIB/bit_math.h"
 
+/* MCAL */
+#include "gli_config.h"
+
+/* ***********************************************************************************************/
+/* GLI Macros */
+
+/* Nestable critical section: saves SREG in SREG_COPY ( a u8 local of the caller ), then disables interrupts; the
+ * matching GLI_EXIT_CRITICAL restores it, so only the exit of the outermost section enables interrupts again.
+ * SITE_ID ( GLI_U8_SITE_xxx, gli_config.h ) names the call site, for the interrupts-off time accounting of DEBUG builds */
+#ifdef DEBUG
+#define GLI_ENTER_CRITICAL( SREG_COPY, SITE_ID )	do { GLI_SAVE_AND_DISABLE( SREG_COPY ); GLI_spanStart( SREG_COPY, SITE_ID ); } while ( 0 )
+#define GLI_EXIT_CRITICAL( SREG_COPY )				do { GLI_spanEnd( SREG_COPY ); GLI_RESTORE( SREG_COPY ); } while ( 0 )
+#else
+#define GLI_ENTER_CRITICAL( SREG_COPY, SITE_ID )	GLI_SAVE_AND_DISABLE( SREG_COPY )
+#define GLI_EXIT_CRITICAL( SREG_COPY )				GLI_RESTORE( SREG_COPY )
+#endif
+
+#define GLI_SAVE_AND_DISABLE( SREG_COPY )			__asm__ __volatile__ ( "in %0, __SREG__" "\n\t" "cli" : "=r" ( SREG_COPY ) : : "memory" )
+#define GLI_RESTORE( SREG_COPY )					__asm__ __volatile__ ( "out __SREG__, %0" : : "r" ( SREG_COPY ) : "memory" )
+
 /* ***********************************************************************************************/
 /* GLI Functions' Prototypes */
 
 vd GLI_enableGIE ( void );
 vd GLI_disableGIE( void );
 
+/**
+ * @brief Reads the longest interrupts-disabled span of the outermost GLI critical sections, and its call site.
+ * Spans are timed with Timer1 counts ( 1 usec. with the scheduler tick ), in DEBUG builds only.
+ * The figure is not the worst interrupt latency, it excludes every interrupts-disabled time that is not such a section:
+ *  - ISR bodies, from the interrupt response to the RETI, with their callbacks, the sections they open, and the
+ *    first and last pending works scans of DFR_runFromIsr ( Tools/isr_bench measures ISR cycles on target ).
+ *  - The sleep entry of SCH_idle, from its check of the ready tasks to the SLEEP instruction that enables interrupts.
+ *  - The KRN sections that may switch tasks, in KRN_delay, KRN_semTake, KRN_semGive and KRN_queueSend: they disable
+ *    interrupts through SREG directly, a span there would run on across the other tasks. Also KRN_start, and the
+ *    context switches of the tick ISR. KRN_getTicks and KRN_queueReceive use GLI sections ( GLI_U8_SITE_KRN ).
+ *  - The start-up code before GLI_resetLongestSpan, and any code disabling interrupts outside GLI_ENTER_CRITICAL.
+ *
+ * @param[out] u16_a_span   Pointer to where the span in Timer1 counts will be stored.
+ * @param[out] u8_a_siteId  Pointer to where the call site ( GLI_U8_SITE_xxx ) will be stored.
+ *
+ * @return u8 STD_OK if read, STD_NOK if a pointer is NULL or spans are not recorded ( not a DEBUG build ).
+ */
+u8 GLI_getLongestSpan  ( u16 *u16_a_span, u8 *u8_a_siteId );
+
+/**
+ * @brief Forgets the longest span, to time a new phase ( e.g. once the start-up code is over ).
+ */
+vd GLI_resetLongestSpan( void );
+
+#ifdef DEBUG
+/* Span timing, used by GLI_ENTER_CRITICAL and GLI_EXIT_CRITICAL only */
+vd GLI_spanStart       ( u8 u8_a_sreg, u8 u8_a_siteId );
+vd GLI_spanEnd         ( u8 u8_a_sreg );
+#endif
+
 /* ***********************************************************************************************/
 
 #endif /* GLI_INTERFACE_H_ */
\ No newline at end of file
@@ -15,6 +15,11 @@
 
 #define GLI_U8_SREG_REG		    *( ( volatile u8 * ) 0x5F )
 
+/* Timer1 registers, read by the interrupts-off time accounting of DEBUG builds */
+#define GLI_U8_TIFR_REG		    *( ( volatile u8 * ) 0x58 )
+#define GLI_U16_TCNT1_REG	    *( ( volatile u16 * ) 0x4C )
+#define GLI_U16_OCR1A_REG	    *( ( volatile u16 * ) 0x4A )
+
 /* ***********************************************************************************************/
 /* GLI Registers' Description */
 
@@ -23,6 +28,11 @@
 #define GLI_U8_I_BIT		    7
 /* End of SREG Register */
 
+/* Timer/Counter Interrupt Flag Register - TIFR */
+/* Bit 4 -> OCF1A: Timer/Counter1, Output Compare A Match Flag */
+#define GLI_U8_OCF1A_BIT	    4
+/* End of TIFR Register */
+
 /* ***********************************************************************************************/
 
 #endif /* GLI_PRIVATE_H_ */
\ No newline at end of file
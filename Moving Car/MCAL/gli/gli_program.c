@@ -11,6 +11,20 @@
 #include "gli_private.h"
 #include "gli_interface.h"
 
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+#ifdef DEBUG
+/* Outermost critical section being timed: start count, compare match already pending at start, and call site */
+static u16 u16_gs_gliSpanStart = 0;
+static u8  u8_gs_gliSpanPending = 0;
+static u8  u8_gs_gliSpanSite = GLI_U8_SITE_NONE;
+
+/* Longest span, and its call site */
+static u16 u16_gs_gliLongestSpan = 0;
+static u8  u8_gs_gliLongestSite = GLI_U8_SITE_NONE;
+#endif
+
 /* ***********************************************************************************************/
 /**
  * @brief The function enables the global interrupt enable bit.
@@ -29,4 +43,107 @@ vd GLI_disableGIE( void )
 	CLR_BIT( GLI_U8_SREG_REG, GLI_U8_I_BIT );
 }
 
-/* ***********************************************************************************************/
\ No newline at end of file
+/* ***********************************************************************************************/
+/**
+ * @brief Reads the longest interrupts-disabled span of the outermost GLI critical sections, and its call site.
+ * Spans are timed with Timer1 counts ( 1 usec. with the scheduler tick ), in DEBUG builds only
+ * ( gli_interface.h lists the interrupts-disabled times it excludes ).
+ *
+ * @param[out] u16_a_span   Pointer to where the span in Timer1 counts will be stored.
+ * @param[out] u8_a_siteId  Pointer to where the call site ( GLI_U8_SITE_xxx ) will be stored.
+ *
+ * @return u8 STD_OK if read, STD_NOK if a pointer is NULL or spans are not recorded ( not a DEBUG build ).
+ */
+u8 GLI_getLongestSpan  ( u16 *u16_a_span, u8 *u8_a_siteId )
+{
+#ifdef DEBUG
+	u8 u8_l_sreg;
+
+	if ( ( u16_a_span == NULL ) || ( u8_a_siteId == NULL ) ) return STD_NOK;
+
+	/* Also updated by the sections of ISR bottom halves, which run with interrupts enabled: read both at once */
+	GLI_SAVE_AND_DISABLE( u8_l_sreg );
+	*u16_a_span  = u16_gs_gliLongestSpan;
+	*u8_a_siteId = u8_gs_gliLongestSite;
+	GLI_RESTORE( u8_l_sreg );
+
+	return STD_OK;
+#else
+	( void ) u16_a_span;
+	( void ) u8_a_siteId;
+
+	return STD_NOK;
+#endif
+}
+
+/* ***********************************************************************************************/
+/**
+ * @brief Forgets the longest span, to time a new phase ( e.g. once the start-up code is over ).
+ */
+vd GLI_resetLongestSpan( void )
+{
+#ifdef DEBUG
+	u8 u8_l_sreg;
+
+	GLI_SAVE_AND_DISABLE( u8_l_sreg );
+	u16_gs_gliLongestSpan = 0;
+	u8_gs_gliLongestSite = GLI_U8_SITE_NONE;
+	GLI_RESTORE( u8_l_sreg );
+#endif
+}
+
+#ifdef DEBUG
+/* ***********************************************************************************************/
+/**
+ * @brief Starts timing a critical section, right after interrupts were disabled.
+ * Only an outermost section is timed: nested ones ( and sections in ISRs ) saved an SREG with interrupts disabled.
+ *
+ * @param[in] u8_a_sreg   SREG saved by GLI_ENTER_CRITICAL.
+ * @param[in] u8_a_siteId Call site ( GLI_U8_SITE_xxx ).
+ */
+vd GLI_spanStart       ( u8 u8_a_sreg, u8 u8_a_siteId )
+{
+	if ( GET_BIT( u8_a_sreg, GLI_U8_I_BIT ) == 0 ) return;
+
+	u16_gs_gliSpanStart  = GLI_U16_TCNT1_REG;
+	u8_gs_gliSpanPending = GET_BIT( GLI_U8_TIFR_REG, GLI_U8_OCF1A_BIT );
+	u8_gs_gliSpanSite    = u8_a_siteId;
+}
+
+/* ***********************************************************************************************/
+/**
+ * @brief Ends timing a critical section, right before interrupts are enabled again, and keeps the longest span.
+ * Timer1 restarts from 0 at its compare match A ( the tick ): a span crossing it is counted up to the end of the
+ * period then from 0, whether the counter is already past the start count again or not.
+ *
+ * @param[in] u8_a_sreg SREG saved by GLI_ENTER_CRITICAL.
+ */
+vd GLI_spanEnd         ( u8 u8_a_sreg )
+{
+	u16 u16_l_now;
+	u16 u16_l_span;
+	u8  u8_l_crossedTick;
+
+	if ( GET_BIT( u8_a_sreg, GLI_U8_I_BIT ) == 0 ) return;
+
+	u16_l_now = GLI_U16_TCNT1_REG;
+
+	/* Check 1: Counter restarted, it is below the start count, or the compare match raised its flag during the
+	 * section ( and the counter is not still on the compare value, about to restart ) */
+	u8_l_crossedTick = ( u16_l_now < u16_gs_gliSpanStart ) ||
+					   ( ( u8_gs_gliSpanPending == 0 ) && ( GET_BIT( GLI_U8_TIFR_REG, GLI_U8_OCF1A_BIT ) == 1 ) &&
+						 ( u16_l_now != GLI_U16_OCR1A_REG ) );
+
+	if ( u8_l_crossedTick ) u16_l_span = ( GLI_U16_OCR1A_REG + 1 ) - u16_gs_gliSpanStart + u16_l_now;
+	else                    u16_l_span = u16_l_now - u16_gs_gliSpanStart;
+
+	/* Step 1: Keep the longest */
+	if ( u16_l_span > u16_gs_gliLongestSpan )
+	{
+		u16_gs_gliLongestSpan = u16_l_span;
+		u8_gs_gliLongestSite  = u8_gs_gliSpanSite;
+	}
+}
+#endif
+
+/* ***********************************************************************************************/
@@ -0,0 +1,64 @@
+/*
+ * slp_interface.h
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: This file contains all Sleep Modes (SLP) functions' prototypes and definitions (Macros) to avoid magic numbers.
+ *  MCU Datasheet: AVR ATmega32 - https://ww1.microchip.com/downloads/en/DeviceDoc/Atmega32A-DataSheet-Complete-DS40002072A.pdf
+ */
+
+#ifndef SLP_INTERFACE_H_
+#define SLP_INTERFACE_H_
+
+/* ***********************************************************************************************/
+/* SLP Includes */
+
+/* LIB */
+#include "../../LIB/std.h"
+#include "../../LIB/bit_math.h"
+
+/* ***********************************************************************************************/
+/* SLP Macros */
+
+/* SLP Sleep Modes ( SM2:0 values ), from the lightest to the deepest */
+#define SLP_U8_IDLE					0
+#define SLP_U8_ADC_NOISE_REDUCTION	1
+#define SLP_U8_POWER_SAVE			3
+#define SLP_U8_POWER_DOWN			2
+
+typedef enum {
+	SLP_OK,
+	SLP_ERROR
+}EN_SLP_ERROR_T;
+
+/* ***********************************************************************************************/
+/* SLP Functions' Prototypes */
+
+/**
+ * @brief Finds the deepest sleep mode from which every enabled wake-up source can still wake the MCU up.
+ *  - A running synchronous timer with an enabled interrupt, or INT0/INT1 enabled on an edge, need the I/O clock: Idle.
+ *  - Timer2 running from its asynchronous crystal with an enabled interrupt: Power-save.
+ *  - Otherwise ( INT0/INT1 on low level, INT2, or nothing ): Power-down.
+ *
+ * @param[out] u8_a_sleepMode Pointer to where the sleep mode will be stored.
+ *
+ * @return EN_SLP_ERROR_T SLP_OK if found, SLP_ERROR if the pointer is NULL.
+ */
+EN_SLP_ERROR_T SLP_getDeepestMode( u8 *u8_a_sleepMode );
+
+/**
+ * @brief Puts the MCU to sleep until an interrupt wakes it up, then runs that interrupt and returns.
+ * Must be called with global interrupts disabled, right after checking there is nothing left to do:
+ * interrupts are enabled just before the SLEEP instruction, and the AVR always runs the instruction
+ * following SEI before any pending interrupt, so a wake-up event raised after the check is never lost.
+ * Global interrupts are enabled on return.
+ *
+ * @param[in] u8_a_sleepMode Sleep mode ( SLP_U8_IDLE, SLP_U8_ADC_NOISE_REDUCTION, SLP_U8_POWER_SAVE, SLP_U8_POWER_DOWN ).
+ *
+ * @return EN_SLP_ERROR_T SLP_OK if the MCU slept, SLP_ERROR if the sleep mode is invalid ( interrupts are enabled anyway ).
+ */
+EN_SLP_ERROR_T SLP_sleep         ( u8 u8_a_sleepMode );
+
+/* ***********************************************************************************************/
+
+#endif /* SLP_INTERFACE_H_ */
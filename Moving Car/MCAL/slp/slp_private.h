@@ -0,0 +1,68 @@
+/*
+ * slp_private.h
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: This file contains all Sleep Modes (SLP) registers' locations and description.
+ *  MCU Datasheet: AVR ATmega32 - https://ww1.microchip.com/downloads/en/DeviceDoc/Atmega32A-DataSheet-Complete-DS40002072A.pdf
+ */
+
+#ifndef SLP_PRIVATE_H_
+#define SLP_PRIVATE_H_
+
+/* ***********************************************************************************************/
+/* SLP Registers' Locations */
+
+#define SLP_U8_MCUCR_REG		*( ( volatile u8 * ) 0x55 )
+
+/* Read only, to find the enabled wake-up sources */
+#define SLP_U8_GICR_REG			*( ( volatile u8 * ) 0x5B )
+#define SLP_U8_TIMSK_REG		*( ( volatile u8 * ) 0x59 )
+#define SLP_U8_TCCR0_REG		*( ( volatile u8 * ) 0x53 )
+#define SLP_U8_TCCR1B_REG		*( ( volatile u8 * ) 0x4E )
+#define SLP_U8_TCCR2_REG		*( ( volatile u8 * ) 0x45 )
+#define SLP_U8_ASSR_REG			*( ( volatile u8 * ) 0x42 )
+
+/* ***********************************************************************************************/
+/* SLP Registers' Description */
+
+/* MCU Control Register - MCUCR */
+/* Bit 7 -> SE: Sleep Enable */
+#define SLP_U8_SE_BIT			7
+/* Bit 6, 5, 4 -> SM2, SM1, SM0: Sleep Mode Select */
+#define SLP_U8_SM_MASK			0x70
+#define SLP_U8_SM_SHIFT			4
+/* Bit 3, 2 -> ISC11, ISC10: Interrupt 1 Sense Control ( 00 = low level ) */
+#define SLP_U8_ISC1_MASK		0x0C
+/* Bit 1, 0 -> ISC01, ISC00: Interrupt 0 Sense Control ( 00 = low level ) */
+#define SLP_U8_ISC0_MASK		0x03
+/* End of MCUCR Register */
+
+/* General Interrupt Control Register - GICR */
+/* Bit 7 -> INT1, Bit 6 -> INT0: External Interrupt Request Enable */
+#define SLP_U8_INT1_BIT			7
+#define SLP_U8_INT0_BIT			6
+/* End of GICR Register */
+
+/* Timer/Counter Interrupt Mask Register - TIMSK */
+/* Bit 7, 6 -> OCIE2, TOIE2: Timer2 interrupts */
+#define SLP_U8_TIMER2_INT_MASK	0xC0
+/* Bit 5 -> 2 -> TICIE1, OCIE1A, OCIE1B, TOIE1: Timer1 interrupts */
+#define SLP_U8_TIMER1_INT_MASK	0x3C
+/* Bit 1, 0 -> OCIE0, TOIE0: Timer0 interrupts */
+#define SLP_U8_TIMER0_INT_MASK	0x03
+/* End of TIMSK Register */
+
+/* Timers Control Registers - TCCR0, TCCR1B, TCCR2 */
+/* Bit 2, 1, 0 -> CSn2, CSn1, CSn0: Clock Select ( 000 = timer stopped ) */
+#define SLP_U8_CS_MASK			0x07
+/* End of TCCR Registers */
+
+/* Asynchronous Status Register - ASSR */
+/* Bit 3 -> AS2: Timer2 clocked from the TOSC1 crystal */
+#define SLP_U8_AS2_BIT			3
+/* End of ASSR Register */
+
+/* ***********************************************************************************************/
+
+#endif /* SLP_PRIVATE_H_ */
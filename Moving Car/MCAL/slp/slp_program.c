@@ -0,0 +1,94 @@
+/*
+ * slp_program.c
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: This file contains all Sleep Modes (SLP) functions' implementation.
+ *  MCU Datasheet: AVR ATmega32 - https://ww1.microchip.com/downloads/en/DeviceDoc/Atmega32A-DataSheet-Complete-DS40002072A.pdf
+ */
+
+/* MCAL */
+#include "slp_private.h"
+#include "slp_interface.h"
+
+/* ***********************************************************************************************/
+
+/**
+ * @brief Finds the deepest sleep mode from which every enabled wake-up source can still wake the MCU up.
+ *  - A running synchronous timer with an enabled interrupt, or INT0/INT1 enabled on an edge, need the I/O clock: Idle.
+ *  - Timer2 running from its asynchronous crystal with an enabled interrupt: Power-save.
+ *  - Otherwise ( INT0/INT1 on low level, INT2, or nothing ): Power-down.
+ *
+ * @param[out] u8_a_sleepMode Pointer to where the sleep mode will be stored.
+ *
+ * @return EN_SLP_ERROR_T SLP_OK if found, SLP_ERROR if the pointer is NULL.
+ */
+EN_SLP_ERROR_T SLP_getDeepestMode( u8 *u8_a_sleepMode )
+{
+	if ( u8_a_sleepMode == NULL ) return SLP_ERROR;
+
+	/* Check 1: Timer0 or Timer1 interrupt can fire, their clock is the I/O clock */
+	if ( ( ( ( SLP_U8_TIMSK_REG & SLP_U8_TIMER0_INT_MASK ) != 0 ) && ( ( SLP_U8_TCCR0_REG  & SLP_U8_CS_MASK ) != 0 ) ) ||
+		 ( ( ( SLP_U8_TIMSK_REG & SLP_U8_TIMER1_INT_MASK ) != 0 ) && ( ( SLP_U8_TCCR1B_REG & SLP_U8_CS_MASK ) != 0 ) ) )
+	{
+		*u8_a_sleepMode = SLP_U8_IDLE;
+		return SLP_OK;
+	}
+
+	/* Check 2: INT0 or INT1 enabled on an edge, edges are detected with the I/O clock */
+	if ( ( ( GET_BIT( SLP_U8_GICR_REG, SLP_U8_INT0_BIT ) == 1 ) && ( ( SLP_U8_MCUCR_REG & SLP_U8_ISC0_MASK ) != 0 ) ) ||
+		 ( ( GET_BIT( SLP_U8_GICR_REG, SLP_U8_INT1_BIT ) == 1 ) && ( ( SLP_U8_MCUCR_REG & SLP_U8_ISC1_MASK ) != 0 ) ) )
+	{
+		*u8_a_sleepMode = SLP_U8_IDLE;
+		return SLP_OK;
+	}
+
+	/* Check 3: Timer2 interrupt can fire */
+	if ( ( ( SLP_U8_TIMSK_REG & SLP_U8_TIMER2_INT_MASK ) != 0 ) && ( ( SLP_U8_TCCR2_REG & SLP_U8_CS_MASK ) != 0 ) )
+	{
+		/* Check 3.1: Asynchronous crystal keeps running in Power-save, the I/O clock does not */
+		*u8_a_sleepMode = ( GET_BIT( SLP_U8_ASSR_REG, SLP_U8_AS2_BIT ) == 1 ) ? SLP_U8_POWER_SAVE : SLP_U8_IDLE;
+		return SLP_OK;
+	}
+
+	*u8_a_sleepMode = SLP_U8_POWER_DOWN;
+
+	return SLP_OK;
+}
+
+/**
+ * @brief Puts the MCU to sleep until an interrupt wakes it up, then runs that interrupt and returns.
+ * Must be called with global interrupts disabled, right after checking there is nothing left to do:
+ * interrupts are enabled just before the SLEEP instruction, and the AVR always runs the instruction
+ * following SEI before any pending interrupt, so a wake-up event raised after the check is never lost.
+ * Global interrupts are enabled on return.
+ *
+ * @param[in] u8_a_sleepMode Sleep mode ( SLP_U8_IDLE, SLP_U8_ADC_NOISE_REDUCTION, SLP_U8_POWER_SAVE, SLP_U8_POWER_DOWN ).
+ *
+ * @return EN_SLP_ERROR_T SLP_OK if the MCU slept, SLP_ERROR if the sleep mode is invalid ( interrupts are enabled anyway ).
+ */
+EN_SLP_ERROR_T SLP_sleep         ( u8 u8_a_sleepMode )
+{
+	/* Check 1: Sleep mode is valid */
+	if ( ( u8_a_sleepMode != SLP_U8_IDLE ) && ( u8_a_sleepMode != SLP_U8_ADC_NOISE_REDUCTION ) &&
+		 ( u8_a_sleepMode != SLP_U8_POWER_SAVE ) && ( u8_a_sleepMode != SLP_U8_POWER_DOWN ) )
+	{
+		__asm__ __volatile__ ( "sei" ::: "memory" );
+		return SLP_ERROR;
+	}
+
+	/* Step 1: Select the mode, and arm the SLEEP instruction */
+	SLP_U8_MCUCR_REG = ( SLP_U8_MCUCR_REG & ~SLP_U8_SM_MASK ) | ( u8_a_sleepMode << SLP_U8_SM_SHIFT );
+	SET_BIT( SLP_U8_MCUCR_REG, SLP_U8_SE_BIT );
+
+	/* Step 2: SEI then SLEEP, no interrupt can run in between */
+	__asm__ __volatile__ ( "sei"   "\n\t"
+						   "sleep" ::: "memory" );
+
+	/* Step 3: Woken up, and the waking ISR already ran, disarm the SLEEP instruction */
+	CLR_BIT( SLP_U8_MCUCR_REG, SLP_U8_SE_BIT );
+
+	return SLP_OK;
+}
+
+/* ***********************************************************************************************/
@@ -316,6 +316,13 @@ void INT_VECT(void)*/
 #define TIMER_U8_FLAG_DOWN                    0
 #define TIMER_U8_FLAG_UP                        1
 
+/* ISR Binding of the Timer2 overflow and Timer0 compare match vectors, as in MCAL/exi/exi_config.h:
+ * STD_OK with TIMER_TIMER_n_xxx_HANDLER() defined in APP/app_bindings.h runs the handler directly in the vector ( compile-time binding ),
+ * STD_NOK calls the function set with TIMER_ovfSetCallback / TIMER_timer0CompSetCallback through a pointer ( runtime binding ). */
+#ifndef TIMER_U8_STATIC_BINDING
+#define TIMER_U8_STATIC_BINDING                STD_OK
+#endif
+
 /* End of Configurations */
 
 /* ***********************************************************************************************/
@@ -20,6 +20,7 @@
 /* LIB */
 #include "../../LIB/std.h"
 #include "../../LIB/bit_math.h"
+#include "../../LIB/evg.h"
 
 /* ****************************************************************/
 /* TIMER Macros */
@@ -76,21 +77,22 @@ typedef enum {
  *
  * This function initializes/selects the timer_0 normal mode for the timer, and enable the ISR for this timer.
  * @param[in] EN_TIMER_INTERRPUT_T en_a_interrputEnable value to set the interrupt bit for timer_0 in the TIMSK reg.
- * @param[in] **u8_a_shutdownFlag double pointer, acts as a main switch for timer 0 operations.
+ * @param[in] u8 u8_a_stopFlags system flags ( EVG_U8_xxx ) that act as a main switch for timer 0 operations, 0 for none.
  *
  * @return An EN_TIMER_ERROR_T value indicating the success or failure of the operation
  *         (TIMER_OK if the operation succeeded, TIMER_ERROR otherwise)
  */
-EN_TIMER_ERROR_T TIMER_timer0NormalModeInit(EN_TIMER_INTERRPUT_T en_a_interrputEnable, u8 ** u8_a_shutdownFlag);
+EN_TIMER_ERROR_T TIMER_timer0NormalModeInit(EN_TIMER_INTERRPUT_T en_a_interrputEnable, u8 u8_a_stopFlags);
 
 /**
  * @brief Creates a delay using timer_0 in overflow mode
  *
  * This function Creates the desired delay on timer_0 normal mode.
+ * A raised stop flag ( TIMER_timer0NormalModeInit ) skips the delay, or ends it early.
  * @param[in] u16 u16_a_interval value to set the desired delay.
  *
  * @return An EN_TIMER_ERROR_T value indicating the success or failure of the operation
- *         (TIMER_OK if the operation succeeded, TIMER_ERROR otherwise)
+ *         (TIMER_OK if the whole delay elapsed, TIMER_ERROR if it is too long or a stop flag skipped or cut it)
  */
 EN_TIMER_ERROR_T TIMER_timer0Delay(u16 u16_a_interval);
 
@@ -127,6 +129,37 @@ void TIMER_timer0Stop(void);
  */
 //EN_TIMER_ERROR_T TIMER_timer0CleareCompMatInit(u8 u8_a_outCompValue );
 
+/**
+ * @brief Initializes timer0 at CTC mode ( TOP = OCR0 ) with the compare match interrupt enabled.
+ *
+ * This function prepares timer_0 as a variable period interrupt source, the timer is not started yet.
+ * Every compare match ISR loads the value returned by its handler as the next compare value, so each period
+ * may have its own length ( e.g. bit-weighted time slices ).
+ * TIMER_timer0Delay must not be used until TIMER_timer0CtcDeInit.
+ * @param[in] u8 u8_a_compareValue value of OCR0, the first period is ( u8_a_compareValue + 1 ) timer counts.
+ *
+ * @return An EN_TIMER_ERROR_T value indicating the success or failure of the operation
+ *         (TIMER_OK if the operation succeeded, TIMER_ERROR otherwise)
+ */
+EN_TIMER_ERROR_T TIMER_timer0CtcInit(u8 u8_a_compareValue);
+
+/**
+ * @brief Stops timer0, disables its compare match interrupt, and selects the normal mode back ( for TIMER_timer0Delay ).
+ *
+ * @return void
+ */
+void TIMER_timer0CtcDeInit(void);
+
+/**
+ * @brief Set callback function for timer_0 compare match interrupt
+ *
+ * @param u8_a_pfCompInterruptAction Pointer to the function to be called on every timer_0 compare match, it returns
+ *        the next compare value ( length of the period that just started - 1 ). The period that just started is
+ *        shortened or lengthened right away, so the handler must return before the timer counts past the value.
+ * @return EN_TIMER_ERROR_T Returns TIMER_OK if callback function is set successfully, else returns TIMER_ERROR
+ */
+EN_TIMER_ERROR_T TIMER_timer0CompSetCallback(u8 (*u8_a_pfCompInterruptAction)(void));
+
 
 
 
@@ -135,12 +168,12 @@ void TIMER_timer0Stop(void);
  *
  * This function initializes/selects the timer_2 normal mode for the timer, and enable the ISR for this timer.
  * @param[in] EN_TIMER_INTERRPUT_T en_a_interrputEnable value to set the interrupt bit for timer_2 in the TIMSK reg.
- * @param[in] **u8_a_shutdownFlag double pointer, acts as a main switch for timer 2 operations.
+ * @param[in] u8 u8_a_stopFlags system flags ( EVG_U8_xxx ) that act as a main switch for timer 2 operations, 0 for none.
  *
  * @return An EN_TIMER_ERROR_T value indicating the success or failure of the operation
  *         (TIMER_OK if the operation succeeded, TIMER_ERROR otherwise)
  */
-EN_TIMER_ERROR_T TIMER_timer2NormalModeInit(EN_TIMER_INTERRPUT_T en_a_interrputEnable, u8 ** u8_a_shutdownFlag);
+EN_TIMER_ERROR_T TIMER_timer2NormalModeInit(EN_TIMER_INTERRPUT_T en_a_interrputEnable, u8 u8_a_stopFlags);
 
 /**
  * @brief Stop the timer by setting the prescaler to be 000--> timer is stopped.
@@ -184,9 +217,87 @@ EN_TIMER_ERROR_T TIMER_ovfSetCallback(void (*void_a_pfOvfInterruptAction)(void))
 
 //EN_TIMER_ERROR_T TIMER_timer2CleareCompMatInit(u8 u8_a_outCompValue );
 
-//EN_TIMER_ERROR_T TIMER_tmr1NormalModeInit(EN_TIMER_INTERRPUT_T en_a_interrputEnable);
-//EN_TIMER_ERROR_T TIMER_tmr1Start(u16 u16_a_prescaler);
-//void TIMER_tmr1Stop(void);
+/**
+ * @brief Initializes timer1 at CTC mode ( TOP = OCR1A ) with the compare match A interrupt enabled.
+ *
+ * This function prepares timer_1 as a periodic tick source, the timer is not started yet.
+ * @param[in] u16 u16_a_compareValue value of OCR1A, the tick period is ( u16_a_compareValue + 1 ) timer counts.
+ *
+ * @return An EN_TIMER_ERROR_T value indicating the success or failure of the operation
+ *         (TIMER_OK if the operation succeeded, TIMER_ERROR otherwise)
+ */
+EN_TIMER_ERROR_T TIMER_timer1CtcInit(u16 u16_a_compareValue);
+
+/**
+ * @brief Start the timer by setting the desired prescaler.
+ *
+ * This function set the prescaler for timer_1.
+ * @param[in] u16 u16_a_prescaler value to set the desired prescaler.
+ *
+ * @return An EN_TIMER_ERROR_T value indicating the success or failure of the operation
+ *         (TIMER_OK if the operation succeeded, TIMER_ERROR otherwise)
+ */
+EN_TIMER_ERROR_T TIMER_timer1Start(u16 u16_a_prescaler);
+
+/**
+ * @brief Stop the timer by setting the prescaler to be 000--> timer is stopped.
+ *
+ * This function Clear the prescaler for timer_1.
+ * @param[in] void.
+ *
+ * @return void
+ */
+void TIMER_timer1Stop(void);
+
+/**
+ * @brief Reads the current timer_1 counter value ( TCNT1 ).
+ *
+ * @return u16 current count, from 0 up to the CTC compare value.
+ */
+u16 TIMER_timer1GetCounter(void);
+
+/**
+ * @brief Set callback function for timer_1 compare match A interrupt
+ *
+ * @param void_a_pfCompAInterruptAction Pointer to the function to be called on every timer_1 compare match A
+ * @return EN_TIMER_ERROR_T Returns TIMER_OK if callback function is set successfully, else returns TIMER_ERROR
+ */
+EN_TIMER_ERROR_T TIMER_compASetCallback(void (*void_a_pfCompAInterruptAction)(void));
+
+/**
+ * @brief Changes the timer1 CTC compare value ( TOP ) while the timer runs.
+ *
+ * In CTC mode OCR1A is not double buffered, the new value is used right away: a value below
+ * the current count is only matched after the counter wraps at 0xFFFF.
+ *
+ * @param[in] u16 u16_a_compareValue new CTC compare value.
+ *
+ * @return An EN_TIMER_ERROR_T value indicating the success or failure of the operation
+ *         (TIMER_OK if the operation succeeded, TIMER_ERROR otherwise)
+ */
+EN_TIMER_ERROR_T TIMER_timer1SetCompareValue(u16 u16_a_compareValue);
+
+/**
+ * @brief Checks whether a timer1 compare match A interrupt is pending ( OCF1A flag set ).
+ *
+ * @return u8 1 if pending, 0 otherwise.
+ */
+u8 TIMER_timer1IsCompAPending(void);
+
+/**
+ * @brief Moves the timer1 CTC period interrupt from compare match A to compare match B.
+ *
+ * Compare match B fires once per CTC period when OCR1B equals the CTC compare value.
+ * The compare match B ISR is not defined by this driver, it is owned by the caller
+ * ( e.g. a kernel that switches contexts in it ). Call it after TIMER_timer1CtcInit.
+ *
+ * @param[in] u16 u16_a_compareValue same value given to TIMER_timer1CtcInit.
+ *
+ * @return An EN_TIMER_ERROR_T value indicating the success or failure of the operation
+ *         (TIMER_OK if the operation succeeded, TIMER_ERROR otherwise)
+ */
+EN_TIMER_ERROR_T TIMER_timer1CompBTickInit(u16 u16_a_compareValue);
+
 //EN_TIMER_ERROR_T TIMER_tmr1CreatePWM(u8 u8_a_dutyCycle);
 
 /* ***********************************************************************************************/
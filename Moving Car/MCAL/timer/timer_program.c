@@ -14,6 +14,11 @@
 #include "timer_interface.h"
 #include <math.h>
 
+/* Compile-time bound handlers, from the application */
+#if (TIMER_U8_STATIC_BINDING == STD_OK)
+#include "../../APP/app_bindings.h"
+#endif
+
 /* ***********************************************************************************************/
 /* Declaration and Initialization */
 
@@ -23,10 +28,16 @@ u16 u16_g_overflowTicks = 0;
 u16 u16_g_overflow2Ticks = 0;
 u16 u16_g_overflow2Numbers = 0;
 
-u8 * u8_g_timerShutdownFlag = NULL;
+/* Subscribed system flags ( EVG_U8_xxx ) that end timer 0 and timer 2 operations */
+static u8 u8_gs_timer0StopFlags = 0;
+static u8 u8_gs_timer2StopFlags = 0;
 
 void (*void_g_pfOvfInterruptAction)(void) = NULL;
 
+void (*void_g_pfCompAInterruptAction)(void) = NULL;
+
+u8 (*u8_g_pfCompInterruptAction)(void) = NULL;
+
 /* ***********************************************************************************************/
 
 
@@ -35,13 +46,13 @@ void (*void_g_pfOvfInterruptAction)(void) = NULL;
  *
  * This function initializes/selects the timer_0 normal mode for the timer, and enable the ISR for this timer.
  * @param[in] EN_TIMER_INTERRPUT_T en_a_interrputEnable value to set the interrupt bit for timer_0 in the TIMSK reg.
- * @param[in] **u8_a_shutdownFlag double pointer, acts as a main switch for timer 0 operations.
+ * @param[in] u8 u8_a_stopFlags system flags ( EVG_U8_xxx ) that act as a main switch for timer 0 operations, 0 for none.
  *
  * @return An EN_TIMER_ERROR_T value indicating the success or failure of the operation
  *         (TIMER_OK if the operation succeeded, TIMER_ERROR otherwise)
  */
-EN_TIMER_ERROR_T TIMER_timer0NormalModeInit(EN_TIMER_INTERRPUT_T en_a_interrputEnable, u8 ** u8_a_shutdownFlag) {
-    u8_g_timerShutdownFlag = *u8_a_shutdownFlag;
+EN_TIMER_ERROR_T TIMER_timer0NormalModeInit(EN_TIMER_INTERRPUT_T en_a_interrputEnable, u8 u8_a_stopFlags) {
+    u8_gs_timer0StopFlags = u8_a_stopFlags;
 
     switch (en_a_interrputEnable) {
         case ENABLED:
@@ -69,13 +80,14 @@ EN_TIMER_ERROR_T TIMER_timer0NormalModeInit(EN_TIMER_INTERRPUT_T en_a_interrputE
  * @brief Creates a delay using timer_0 in overflow mode
  *
  * This function Creates the desired delay on timer_0 normal mode.
+ * A raised stop flag ( TIMER_timer0NormalModeInit ) skips the delay, or ends it early.
  * @param[in] u16 u16_a_interval value to set the desired delay.
  *
  * @return An EN_TIMER_ERROR_T value indicating the success or failure of the operation
- *         (TIMER_OK if the operation succeeded, TIMER_ERROR otherwise)
+ *         (TIMER_OK if the whole delay elapsed, TIMER_ERROR if it is too long or a stop flag skipped or cut it)
  */
 EN_TIMER_ERROR_T TIMER_timer0Delay(u16 u16_a_interval) {
-    if((u8_g_timerShutdownFlag != NULL && *u8_g_timerShutdownFlag == 1)) return TIMER_ERROR; // sudden break flag
+    if(EVG_TEST_ANY(u8_gs_timer0StopFlags)) return TIMER_ERROR; // sudden break flag
     if ( ( u16_a_interval / SECOND_OPERATOR ) > ( MAX_TIMER_DELAY ) ) {
 	    return TIMER_ERROR;
     }
@@ -101,7 +113,7 @@ EN_TIMER_ERROR_T TIMER_timer0Delay(u16 u16_a_interval) {
         u16_g_overflowTicks = 0;
         TIMER_timer0Start(1024);
         /*Polling the overflowNumbers and the overflow flag bit*/
-        while (u16_g_overflowNumbers > u16_g_overflowTicks && (u8_g_timerShutdownFlag == NULL || *u8_g_timerShutdownFlag == 0))
+        while (u16_g_overflowNumbers > u16_g_overflowTicks && !EVG_TEST_ANY(u8_gs_timer0StopFlags))
         {
             while ((TIMER_U8_TIFR_REG & (1 << 0)) == 0);
             TIMER_U8_TIFR_REG |= (1 << 0);
@@ -109,6 +121,8 @@ EN_TIMER_ERROR_T TIMER_timer0Delay(u16 u16_a_interval) {
         }
         /*stop the timer*/
         TIMER_timer0Stop();
+        /*cut short by a stop flag*/
+        if (u16_g_overflowTicks < u16_g_overflowNumbers) return TIMER_ERROR;
     }
     return TIMER_OK;
 }
@@ -204,6 +218,102 @@ void TIMER_timer0Stop(void) {
 
 }*/
 
+/**
+ * @brief Initializes timer0 at CTC mode ( TOP = OCR0 ) with the compare match interrupt enabled.
+ *
+ * This function prepares timer_0 as a variable period interrupt source, the timer is not started yet.
+ * Every compare match ISR loads the value returned by its handler as the next compare value, so each period
+ * may have its own length ( e.g. bit-weighted time slices ).
+ * TIMER_timer0Delay must not be used until TIMER_timer0CtcDeInit.
+ * @param[in] u8 u8_a_compareValue value of OCR0, the first period is ( u8_a_compareValue + 1 ) timer counts.
+ *
+ * @return An EN_TIMER_ERROR_T value indicating the success or failure of the operation
+ *         (TIMER_OK if the operation succeeded, TIMER_ERROR otherwise)
+ */
+EN_TIMER_ERROR_T TIMER_timer0CtcInit(u8 u8_a_compareValue) {
+    /* Clear the TCCR Register, timer is not start yet.*/
+    TIMER_U8_TCCR0_REG = 0x00;
+    /* select the CTC mode, WGM01:0 = 10 */
+    SET_BIT(TIMER_U8_TCCR0_REG, TIMER_U8_WGM01_BIT);
+    /* load the compare value, then count from 0 */
+    TIMER_U8_OCR0_REG = u8_a_compareValue;
+    TIMER_U8_TCNT0_REG = 0x00;
+    /* clear any pending compare match flag ( written as 1 ), then enable the compare match interrupt */
+    TIMER_U8_TIFR_REG = (1 << TIMER_U8_OCF0_BIT);
+    SET_BIT(TIMER_U8_TIMSK_REG, TIMER_U8_OCIE0_BIT);
+    return TIMER_OK;
+}
+
+/**
+ * @brief Stops timer0, disables its compare match interrupt, and selects the normal mode back ( for TIMER_timer0Delay ).
+ *
+ * @return void
+ */
+void TIMER_timer0CtcDeInit(void) {
+    TIMER_timer0Stop();
+    CLR_BIT(TIMER_U8_TIMSK_REG, TIMER_U8_OCIE0_BIT);
+    TIMER_U8_TIFR_REG = (1 << TIMER_U8_OCF0_BIT);
+    TIMER_U8_TCCR0_REG = 0x00;
+}
+
+/**
+ * @brief Set callback function for timer_0 compare match interrupt
+ *
+ * @param u8_a_pfCompInterruptAction Pointer to the function to be called on every timer_0 compare match, it returns
+ *        the next compare value ( length of the period that just started - 1 ). The period that just started is
+ *        shortened or lengthened right away, so the handler must return before the timer counts past the value.
+ * @return EN_TIMER_ERROR_T Returns TIMER_OK if callback function is set successfully, else returns TIMER_ERROR
+ */
+EN_TIMER_ERROR_T TIMER_timer0CompSetCallback(u8 (*u8_a_pfCompInterruptAction)(void)) {
+    if (u8_a_pfCompInterruptAction != NULL) {
+        u8_g_pfCompInterruptAction = u8_a_pfCompInterruptAction;
+        return TIMER_OK;
+    } else {
+        return TIMER_ERROR;
+    }
+}
+
+#if (TIMER_U8_STATIC_BINDING == STD_OK) && defined(TIMER_TIMER_0_COMP_HANDLER)
+/* Compile-time binding ( timer_config.h, APP/app_bindings.h ) */
+#define TIMER_TIMER_0_NEXT_COMPARE()		TIMER_TIMER_0_COMP_HANDLER()
+#else
+#define TIMER_TIMER_0_NEXT_COMPARE()		u8_g_pfCompInterruptAction()
+#endif
+
+/**
+ * @brief Interrupt Service Routine for Timer0 Compare Match.
+ *        This function is executed at the end of every timer_0 CTC period, the counter already restarted from 0:
+ *        OCR0 is not double buffered in CTC mode, so the compare value returned by the handler sets the length
+ *        of the period that just started.
+ *        A late ISR may find the counter already past the new compare value: the match would then only come after
+ *        the counter wraps at 0xFF, a 256 counts period. The period is then over already, so the next one is
+ *        folded in: its length is added to the compare value ( up to 0xFF ), until the counter is behind it.
+ *        With the compile-time binding ( timer_config.h, APP/app_bindings.h ), it runs TIMER_TIMER_0_COMP_HANDLER instead of the callback.
+ *
+ * @return void
+ */
+void __vector_10(void) __attribute__((signal));
+void __vector_10(void)
+{
+	u8  u8_l_compare;
+	u16 u16_l_nextCompare;
+
+#if (TIMER_U8_STATIC_BINDING != STD_OK) || !defined(TIMER_TIMER_0_COMP_HANDLER)
+	if (u8_g_pfCompInterruptAction == NULL) return;
+#endif
+
+	u8_l_compare = TIMER_TIMER_0_NEXT_COMPARE();
+	TIMER_U8_OCR0_REG = u8_l_compare;
+
+	/* A match still comes while the counter is not past the compare value */
+	while (TIMER_U8_TCNT0_REG > u8_l_compare)
+	{
+		u16_l_nextCompare = (u16) u8_l_compare + 1 + TIMER_TIMER_0_NEXT_COMPARE();
+		u8_l_compare = (u16_l_nextCompare > 0xFF) ? 0xFF : (u8) u16_l_nextCompare;
+		TIMER_U8_OCR0_REG = u8_l_compare;
+	}
+}
+
 /* ***********************************************************************************************/
 
 /**
@@ -211,13 +321,13 @@ void TIMER_timer0Stop(void) {
  *
  * This function initializes/selects the timer_2 normal mode for the timer, and enable the ISR for this timer.
  * @param[in] EN_TIMER_INTERRPUT_T en_a_interrputEnable value to set the interrupt bit for timer_2 in the TIMSK reg.
- * @param[in] **u8_a_shutdownFlag double pointer, acts as a main switch for timer 2 operations.
+ * @param[in] u8 u8_a_stopFlags system flags ( EVG_U8_xxx ) that act as a main switch for timer 2 operations, 0 for none.
  *
  * @return An EN_TIMER_ERROR_T value indicating the success or failure of the operation
  *         (TIMER_OK if the operation succeeded, TIMER_ERROR otherwise)
  */
-EN_TIMER_ERROR_T TIMER_timer2NormalModeInit(EN_TIMER_INTERRPUT_T en_a_interrputEnable, u8 ** u8_a_shutdownFlag) {
-    u8_g_timerShutdownFlag = *u8_a_shutdownFlag;
+EN_TIMER_ERROR_T TIMER_timer2NormalModeInit(EN_TIMER_INTERRPUT_T en_a_interrputEnable, u8 u8_a_stopFlags) {
+    u8_gs_timer2StopFlags = u8_a_stopFlags;
 
     switch (en_a_interrputEnable) {
         case ENABLED:
@@ -548,6 +658,7 @@ EN_TIMER_ERROR_T TIMER_ovfSetCallback(void (*void_a_pfOvfInterruptAction)(void))
  *        If true, it resets u16_g_overflow2Ticks and stops Timer2.
  *        It then checks whether void_g_pfOvfInterruptAction is not null.
  *        If true, it calls the function pointed to by void_g_pfOvfInterruptAction.
+ *        With the compile-time binding ( timer_config.h, APP/app_bindings.h ), it runs TIMER_TIMER_2_OVF_HANDLER instead.
  *
  * @return void
  */
@@ -558,11 +669,197 @@ void __vector_5(void) __attribute__((signal));
 void __vector_5(void)
 {
 	u16_g_overflow2Ticks++;
-	if (u16_g_overflow2Ticks >= u16_g_overflow2Numbers || (u8_g_timerShutdownFlag != NULL && *u8_g_timerShutdownFlag == 1))
+	if (u16_g_overflow2Ticks >= u16_g_overflow2Numbers || EVG_TEST_ANY(u8_gs_timer2StopFlags))
 	{
 		u16_g_overflow2Ticks = 0;
 		TIMER_timer2Stop();
+#if (TIMER_U8_STATIC_BINDING == STD_OK) && defined(TIMER_TIMER_2_OVF_HANDLER)
+		/* Compile-time binding ( timer_config.h, APP/app_bindings.h ) */
+		TIMER_TIMER_2_OVF_HANDLER();
+#else
 		if (void_g_pfOvfInterruptAction != NULL)
 			void_g_pfOvfInterruptAction();
+#endif
 	}
 }
+
+
+/* ************************************************************************************************/
+
+/**
+ * @brief Initializes timer1 at CTC mode ( TOP = OCR1A ) with the compare match A interrupt enabled.
+ *
+ * This function prepares timer_1 as a periodic tick source, the timer is not started yet.
+ * @param[in] u16 u16_a_compareValue value of OCR1A, the tick period is ( u16_a_compareValue + 1 ) timer counts.
+ *
+ * @return An EN_TIMER_ERROR_T value indicating the success or failure of the operation
+ *         (TIMER_OK if the operation succeeded, TIMER_ERROR otherwise)
+ */
+EN_TIMER_ERROR_T TIMER_timer1CtcInit(u16 u16_a_compareValue) {
+    if (u16_a_compareValue == 0) {
+        return TIMER_ERROR;
+    }
+    /* Clear the TCCR Registers, timer is not start yet.*/
+    TIMER_U8_TCCR1A_REG = 0x00;
+    TIMER_U8_TCCR1B_REG = 0x00;
+    /* select the CTC mode with OCR1A as TOP, WGM13:0 = 0100 */
+    SET_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_WGM12_BIT);
+    /* load the compare value, then count from 0 */
+    TIMER_U16_OCR1A_REG = u16_a_compareValue;
+    TIMER_U16_TCNT1_REG = 0x0000;
+    /* clear any pending compare match flag ( written as 1 ), then enable the compare match A interrupt */
+    TIMER_U8_TIFR_REG = (1 << TIMER_U8_OCF1A_BIT);
+    SET_BIT(TIMER_U8_TIMSK_REG, TIMER_U8_OCIE1A_BIT);
+    return TIMER_OK;
+}
+
+/* ************************************************************************************************/
+/**
+ * @brief Start the timer by setting the desired prescaler.
+ *
+ * This function set the prescaler for timer_1.
+ * @param[in] u16 u16_a_prescaler value to set the desired prescaler.
+ *
+ * @return An EN_TIMER_ERROR_T value indicating the success or failure of the operation
+ *         (TIMER_OK if the operation succeeded, TIMER_ERROR otherwise)
+ */
+EN_TIMER_ERROR_T TIMER_timer1Start(u16 u16_a_prescaler) {
+    switch (u16_a_prescaler) {
+        case 1:
+            CLR_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS11_BIT);
+            CLR_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS12_BIT);
+            SET_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS10_BIT);
+            break;
+        case 8:
+            CLR_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS10_BIT);
+            CLR_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS12_BIT);
+            SET_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS11_BIT);
+            break;
+        case 64:
+            CLR_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS12_BIT);
+            SET_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS11_BIT);
+            SET_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS10_BIT);
+            break;
+        case 256:
+            CLR_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS11_BIT);
+            CLR_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS10_BIT);
+            SET_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS12_BIT);
+            break;
+        case 1024:
+            CLR_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS11_BIT);
+            SET_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS12_BIT);
+            SET_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS10_BIT);
+            break;
+        default:
+            return TIMER_ERROR;
+    }
+    return TIMER_OK;
+}
+
+/* ************************************************************************************************/
+/**
+ * @brief Stop the timer by setting the prescaler to be 000--> timer is stopped.
+ *
+ * This function Clear the prescaler for timer_1.
+ * @param[in] void.
+ *
+ * @return void
+ */
+void TIMER_timer1Stop(void) {
+    /* Stop the timer by clearing the prescaler*/
+    CLR_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS10_BIT);
+    CLR_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS11_BIT);
+    CLR_BIT(TIMER_U8_TCCR1B_REG, TIMER_U8_CS12_BIT);
+}
+
+/**
+ * @brief Reads the current timer_1 counter value ( TCNT1 ).
+ *
+ * @return u16 current count, from 0 up to the CTC compare value.
+ */
+u16 TIMER_timer1GetCounter(void) {
+    return TIMER_U16_TCNT1_REG;
+}
+
+/**
+ * @brief Set callback function for timer_1 compare match A interrupt
+ *
+ * @param void_a_pfCompAInterruptAction Pointer to the function to be called on every timer_1 compare match A
+ * @return EN_TIMER_ERROR_T Returns TIMER_OK if callback function is set successfully, else returns TIMER_ERROR
+ */
+EN_TIMER_ERROR_T TIMER_compASetCallback(void (*void_a_pfCompAInterruptAction)(void)) {
+    if (void_a_pfCompAInterruptAction != NULL) {
+        void_g_pfCompAInterruptAction = void_a_pfCompAInterruptAction;
+        return TIMER_OK;
+    } else {
+        return TIMER_ERROR;
+    }
+}
+
+/**
+ * @brief Changes the timer1 CTC compare value ( TOP ) while the timer runs.
+ *
+ * In CTC mode OCR1A is not double buffered, the new value is used right away: a value below
+ * the current count is only matched after the counter wraps at 0xFFFF.
+ *
+ * @param[in] u16 u16_a_compareValue new CTC compare value.
+ *
+ * @return An EN_TIMER_ERROR_T value indicating the success or failure of the operation
+ *         (TIMER_OK if the operation succeeded, TIMER_ERROR otherwise)
+ */
+EN_TIMER_ERROR_T TIMER_timer1SetCompareValue(u16 u16_a_compareValue) {
+    if (u16_a_compareValue == 0) {
+        return TIMER_ERROR;
+    }
+    TIMER_U16_OCR1A_REG = u16_a_compareValue;
+    return TIMER_OK;
+}
+
+/**
+ * @brief Checks whether a timer1 compare match A interrupt is pending ( OCF1A flag set ).
+ *
+ * @return u8 1 if pending, 0 otherwise.
+ */
+u8 TIMER_timer1IsCompAPending(void) {
+    return GET_BIT(TIMER_U8_TIFR_REG, TIMER_U8_OCF1A_BIT);
+}
+
+/**
+ * @brief Interrupt Service Routine for Timer1 Compare Match A.
+ *        This function is executed on every timer_1 CTC period ( system tick ),
+ *        and calls the function pointed to by void_g_pfCompAInterruptAction if it is not null.
+ *
+ * @return void
+ */
+void __vector_7(void) __attribute__((signal));
+void __vector_7(void)
+{
+	if (void_g_pfCompAInterruptAction != NULL)
+		void_g_pfCompAInterruptAction();
+}
+
+/* ************************************************************************************************/
+/**
+ * @brief Moves the timer1 CTC period interrupt from compare match A to compare match B.
+ *
+ * Compare match B fires once per CTC period when OCR1B equals the CTC compare value.
+ * The compare match B ISR is not defined by this driver, it is owned by the caller
+ * ( e.g. a kernel that switches contexts in it ). Call it after TIMER_timer1CtcInit.
+ *
+ * @param[in] u16 u16_a_compareValue same value given to TIMER_timer1CtcInit.
+ *
+ * @return An EN_TIMER_ERROR_T value indicating the success or failure of the operation
+ *         (TIMER_OK if the operation succeeded, TIMER_ERROR otherwise)
+ */
+EN_TIMER_ERROR_T TIMER_timer1CompBTickInit(u16 u16_a_compareValue) {
+    if (u16_a_compareValue != TIMER_U16_OCR1A_REG) {
+        return TIMER_ERROR;
+    }
+    TIMER_U16_OCR1B_REG = u16_a_compareValue;
+    /* compare match A interrupt is not needed anymore */
+    CLR_BIT(TIMER_U8_TIMSK_REG, TIMER_U8_OCIE1A_BIT);
+    /* clear any pending compare match flag ( written as 1 ), then enable the compare match B interrupt */
+    TIMER_U8_TIFR_REG = (1 << TIMER_U8_OCF1B_BIT);
+    SET_BIT(TIMER_U8_TIMSK_REG, TIMER_U8_OCIE1B_BIT);
+    return TIMER_OK;
+}
\ No newline at end of file
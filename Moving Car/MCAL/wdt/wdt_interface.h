@@ -0,0 +1,80 @@
+/*
+ * wdt_interface.h
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: This file contains all Watchdog Timer (WDT) functions' prototypes and definitions (Macros) to avoid magic numbers.
+ *  MCU Datasheet: AVR ATmega32 - https://ww1.microchip.com/downloads/en/DeviceDoc/Atmega32A-DataSheet-Complete-DS40002072A.pdf
+ */
+
+#ifndef WDT_INTERFACE_H_
+#define WDT_INTERFACE_H_
+
+/* ***********************************************************************************************/
+/* WDT Includes */
+
+/* LIB */
+#include "../../LIB/std.h"
+#include "../../LIB/bit_math.h"
+
+/* ***********************************************************************************************/
+/* WDT Macros */
+
+/* WDT Timeouts ( WDP2:0 values ), typical at VCC = 5V, from the 1 MHz watchdog oscillator */
+#define WDT_U8_TIMEOUT_16MS			0
+#define WDT_U8_TIMEOUT_32MS			1
+#define WDT_U8_TIMEOUT_65MS			2
+#define WDT_U8_TIMEOUT_130MS		3
+#define WDT_U8_TIMEOUT_260MS		4
+#define WDT_U8_TIMEOUT_520MS		5
+#define WDT_U8_TIMEOUT_1S			6
+#define WDT_U8_TIMEOUT_2S			7
+
+/* WDT Reset Causes ( MCUCSR flags ), more than one can be set after power-up */
+#define WDT_U8_RESET_POWER_ON		0x01
+#define WDT_U8_RESET_EXTERNAL		0x02
+#define WDT_U8_RESET_BROWN_OUT		0x04
+#define WDT_U8_RESET_WATCHDOG		0x08
+#define WDT_U8_RESET_JTAG			0x10
+
+typedef enum {
+	WDT_OK,
+	WDT_ERROR
+}EN_WDT_ERROR_T;
+
+/* ***********************************************************************************************/
+/* WDT Functions' Prototypes */
+
+/**
+ * @brief Starts the watchdog: the MCU is reset if WDT_feed is not called within the timeout.
+ * Also used to change the timeout of a running watchdog, which is fed first.
+ *
+ * @param[in] u8_a_timeout Timeout ( WDT_U8_TIMEOUT_16MS to WDT_U8_TIMEOUT_2S ).
+ *
+ * @return EN_WDT_ERROR_T WDT_OK if started, WDT_ERROR if the timeout is invalid.
+ */
+EN_WDT_ERROR_T WDT_enable       ( u8 u8_a_timeout );
+
+/**
+ * @brief Stops the watchdog, with the timed WDTOE sequence and interrupts disabled.
+ */
+void           WDT_disable      ( void );
+
+/**
+ * @brief Restarts the watchdog timeout ( WDR instruction ).
+ */
+void           WDT_feed         ( void );
+
+/**
+ * @brief Reads the causes of the last reset, then clears them so the next reset reports its own causes.
+ * Call it once, early at start-up.
+ *
+ * @param[out] u8_a_resetCause Pointer to where the causes ( WDT_U8_RESET_xxx flags ) will be stored.
+ *
+ * @return EN_WDT_ERROR_T WDT_OK if read, WDT_ERROR if the pointer is NULL.
+ */
+EN_WDT_ERROR_T WDT_getResetCause( u8 *u8_a_resetCause );
+
+/* ***********************************************************************************************/
+
+#endif /* WDT_INTERFACE_H_ */
@@ -0,0 +1,38 @@
+/*
+ * wdt_private.h
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: This file contains all Watchdog Timer (WDT) registers' locations and description.
+ *  MCU Datasheet: AVR ATmega32 - https://ww1.microchip.com/downloads/en/DeviceDoc/Atmega32A-DataSheet-Complete-DS40002072A.pdf
+ */
+
+#ifndef WDT_PRIVATE_H_
+#define WDT_PRIVATE_H_
+
+/* ***********************************************************************************************/
+/* WDT Registers' Locations */
+
+#define WDT_U8_WDTCR_REG		*( ( volatile u8 * ) 0x41 )
+#define WDT_U8_MCUCSR_REG		*( ( volatile u8 * ) 0x54 )
+
+/* ***********************************************************************************************/
+/* WDT Registers' Description */
+
+/* Watchdog Timer Control Register - WDTCR */
+/* Bit 4 -> WDTOE: Watchdog Turn-off Enable, WDE can be cleared within 4 cycles after it is set */
+#define WDT_U8_WDTOE_BIT		4
+/* Bit 3 -> WDE: Watchdog Enable */
+#define WDT_U8_WDE_BIT			3
+/* Bit 2, 1, 0 -> WDP2, WDP1, WDP0: Watchdog Timer Prescaler */
+#define WDT_U8_WDP_MASK			0x07
+/* End of WDTCR Register */
+
+/* MCU Control and Status Register - MCUCSR: Reset flags, cleared by writing 0 */
+/* Bit 4 -> JTRF, Bit 3 -> WDRF, Bit 2 -> BORF, Bit 1 -> EXTRF, Bit 0 -> PORF */
+#define WDT_U8_RESET_FLAGS_MASK	0x1F
+/* End of MCUCSR Register */
+
+/* ***********************************************************************************************/
+
+#endif /* WDT_PRIVATE_H_ */
@@ -0,0 +1,85 @@
+/*
+ * wdt_program.c
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: This file contains all Watchdog Timer (WDT) functions' implementation.
+ *  MCU Datasheet: AVR ATmega32 - https://ww1.microchip.com/downloads/en/DeviceDoc/Atmega32A-DataSheet-Complete-DS40002072A.pdf
+ */
+
+/* MCAL */
+#include "wdt_private.h"
+#include "wdt_interface.h"
+#include "../gli/gli_interface.h"
+
+/* ***********************************************************************************************/
+
+/**
+ * @brief Starts the watchdog: the MCU is reset if WDT_feed is not called within the timeout.
+ * Also used to change the timeout of a running watchdog, which is fed first.
+ *
+ * @param[in] u8_a_timeout Timeout ( WDT_U8_TIMEOUT_16MS to WDT_U8_TIMEOUT_2S ).
+ *
+ * @return EN_WDT_ERROR_T WDT_OK if started, WDT_ERROR if the timeout is invalid.
+ */
+EN_WDT_ERROR_T WDT_enable       ( u8 u8_a_timeout )
+{
+	if ( u8_a_timeout > WDT_U8_TIMEOUT_2S ) return WDT_ERROR;
+
+	/* Step 1: Feed first, a shorter timeout must not expire on the current count */
+	WDT_feed();
+
+	/* Step 2: Enable and select the timeout in one write */
+	WDT_U8_WDTCR_REG = ( 1 << WDT_U8_WDE_BIT ) | u8_a_timeout;
+
+	return WDT_OK;
+}
+
+/**
+ * @brief Stops the watchdog, with the timed WDTOE sequence and interrupts disabled.
+ */
+void           WDT_disable      ( void )
+{
+	u8 u8_l_sreg;
+
+	/* Nestable section, it may be called with interrupts disabled */
+	GLI_ENTER_CRITICAL( u8_l_sreg, GLI_U8_SITE_WDT );
+
+	WDT_feed();
+
+	/* Step 1: WDTOE and WDE written to one, then WDE written to zero within 4 cycles */
+	WDT_U8_WDTCR_REG = ( 1 << WDT_U8_WDTOE_BIT ) | ( 1 << WDT_U8_WDE_BIT );
+	WDT_U8_WDTCR_REG = 0x00;
+
+	GLI_EXIT_CRITICAL( u8_l_sreg );
+}
+
+/**
+ * @brief Restarts the watchdog timeout ( WDR instruction ).
+ */
+void           WDT_feed         ( void )
+{
+	__asm__ __volatile__ ( "wdr" );
+}
+
+/**
+ * @brief Reads the causes of the last reset, then clears them so the next reset reports its own causes.
+ * Call it once, early at start-up.
+ *
+ * @param[out] u8_a_resetCause Pointer to where the causes ( WDT_U8_RESET_xxx flags ) will be stored.
+ *
+ * @return EN_WDT_ERROR_T WDT_OK if read, WDT_ERROR if the pointer is NULL.
+ */
+EN_WDT_ERROR_T WDT_getResetCause( u8 *u8_a_resetCause )
+{
+	if ( u8_a_resetCause == NULL ) return WDT_ERROR;
+
+	*u8_a_resetCause = WDT_U8_MCUCSR_REG & WDT_U8_RESET_FLAGS_MASK;
+
+	/* JTD and ISC2 share the register, only the reset flags are cleared */
+	WDT_U8_MCUCSR_REG &= ~WDT_U8_RESET_FLAGS_MASK;
+
+	return WDT_OK;
+}
+
+/* ***********************************************************************************************/
@@ -0,0 +1,22 @@
+/*
+ * dfr_config.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Deferred Work (DFR) pre-build configurations, through which user can configure before using the DFR service.
+ */
+
+#ifndef DFR_CONFIG_H_
+#define DFR_CONFIG_H_
+
+/* ***********************************************************************************************/
+/* DFR Configurations */
+
+/* Maximum number of works, pending bits are kept in one byte ( 1 -> 8 ) */
+#define DFR_U8_MAX_WORKS				8
+
+/* End of Configurations */
+
+/* ***********************************************************************************************/
+
+#endif /* DFR_CONFIG_H_ */
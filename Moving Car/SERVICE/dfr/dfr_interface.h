@@ -0,0 +1,71 @@
+/*
+ * dfr_interface.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Deferred Work (DFR) functions' prototypes and definitions (Macros) to avoid magic numbers.
+ *               DFR splits an ISR callback in two halves: the top half does the minimum with interrupts disabled,
+ *               posts a work, and calls DFR_runFromIsr last; the posted works ( bottom halves ) then run in priority
+ *               order with interrupts enabled, before the vector returns. Any interrupt, INT0 first, can preempt a
+ *               bottom half, so its latency only grows by the top halves, whatever the bottom halves do.
+ *               Works do not nest: a work posted while works are running is run by the same run, in priority order.
+ */
+
+#ifndef DFR_INTERFACE_H_
+#define DFR_INTERFACE_H_
+
+/* ***********************************************************************************************/
+/* DFR Includes */
+
+/* LIB */
+#include "../../LIB/std.h"
+#include "../../LIB/bit_math.h"
+
+/* MCAL */
+#include "../../MCAL/gli/gli_interface.h"
+
+/* SERVICE */
+#include "dfr_config.h"
+
+/* ***********************************************************************************************/
+/* DFR Macros */
+
+#if ( ( DFR_U8_MAX_WORKS < 1 ) || ( DFR_U8_MAX_WORKS > 8 ) )
+#error "DFR_U8_MAX_WORKS must be from 1 to 8"
+#endif
+
+/* Pending works, bit n is the work of index n in the works table, written only with interrupts disabled */
+extern volatile u8 u8_g_dfrPending;
+
+/* Posts a work from a top half ( interrupts disabled ), the index in the works table is its priority ( 0 is the highest ) */
+#define DFR_POST_FROM_ISR( WORK_ID )	( u8_g_dfrPending |= ( u8 ) ( 1 << ( WORK_ID ) ) )
+
+typedef enum {
+	DFR_OK,
+	DFR_ERROR
+}EN_DFR_ERROR_T;
+
+/* ***********************************************************************************************/
+/* DFR Functions' Prototypes */
+
+/**
+ * @brief Initializes the deferred works with a constant works table, no work pending.
+ * Must be called before any interrupt that posts a work is enabled.
+ *
+ * @param[in] pf_a_works      Pointer to the works table, sorted by priority ( index 0 is the highest ).
+ * @param[in] u8_a_worksNumber Number of works in the table ( 1 to DFR_U8_MAX_WORKS ).
+ *
+ * @return EN_DFR_ERROR_T DFR_OK if the table is valid, DFR_ERROR otherwise.
+ */
+EN_DFR_ERROR_T DFR_init      ( void ( * const *pf_a_works ) ( void ), u8 u8_a_worksNumber );
+
+/**
+ * @brief Runs the pending works, highest priority first, with interrupts enabled between them.
+ * Call it as the last statement of a top half, with interrupts disabled; interrupts are disabled on return.
+ * If works are already running ( this ISR preempted a bottom half ), returns at once: the running works run the new one.
+ */
+void           DFR_runFromIsr( void );
+
+/* ***********************************************************************************************/
+
+#endif /* DFR_INTERFACE_H_ */
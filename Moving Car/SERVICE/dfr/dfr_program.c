@@ -0,0 +1,94 @@
+/*
+ * dfr_program.c
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Deferred Work (DFR) functions' implementation.
+ */
+
+/* SERVICE */
+#include "dfr_config.h"
+#include "dfr_interface.h"
+
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+volatile u8 u8_g_dfrPending = 0;
+
+/* Works table, and the run in progress flag, read and written only with interrupts disabled */
+static void ( * const *pf_gs_dfrWorks ) ( void ) = NULL;
+static u8 u8_gs_dfrWorksNumber = 0;
+static u8 u8_gs_dfrRunning = STD_NOK;
+
+/* ***********************************************************************************************/
+
+/**
+ * @brief Initializes the deferred works with a constant works table, no work pending.
+ * Must be called before any interrupt that posts a work is enabled.
+ *
+ * @param[in] pf_a_works      Pointer to the works table, sorted by priority ( index 0 is the highest ).
+ * @param[in] u8_a_worksNumber Number of works in the table ( 1 to DFR_U8_MAX_WORKS ).
+ *
+ * @return EN_DFR_ERROR_T DFR_OK if the table is valid, DFR_ERROR otherwise.
+ */
+EN_DFR_ERROR_T DFR_init      ( void ( * const *pf_a_works ) ( void ), u8 u8_a_worksNumber )
+{
+	u8 u8_l_workId;
+
+	/* Check 1: Table and size are valid */
+	if ( ( pf_a_works == NULL ) || ( u8_a_worksNumber == 0 ) || ( u8_a_worksNumber > DFR_U8_MAX_WORKS ) ) return DFR_ERROR;
+
+	/* Check 2: Every work has a body */
+	for ( u8_l_workId = 0; u8_l_workId < u8_a_worksNumber; u8_l_workId++ )
+	{
+		if ( pf_a_works[u8_l_workId] == NULL ) return DFR_ERROR;
+	}
+
+	pf_gs_dfrWorks       = pf_a_works;
+	u8_gs_dfrWorksNumber = u8_a_worksNumber;
+	u8_gs_dfrRunning     = STD_NOK;
+	u8_g_dfrPending      = 0;
+
+	return DFR_OK;
+}
+
+/**
+ * @brief Runs the pending works, highest priority first, with interrupts enabled between them.
+ * Call it as the last statement of a top half, with interrupts disabled; interrupts are disabled on return.
+ * If works are already running ( this ISR preempted a bottom half ), returns at once: the running works run the new one.
+ */
+void           DFR_runFromIsr( void )
+{
+	u8 u8_l_workId;
+	u8 u8_l_sreg;
+
+	/* Check 1: Works already running below this ISR, or none pending */
+	if ( ( u8_gs_dfrRunning == STD_OK ) || ( u8_g_dfrPending == 0 ) ) return;
+
+	u8_gs_dfrRunning = STD_OK;
+
+	/* Step 1: The top half is over, the scans of the pending works are critical sections of their own from here
+	 * ( the last one ends with the RETI of the top half, untimed like the ISR bodies ) */
+	GLI_enableGIE();
+	GLI_ENTER_CRITICAL( u8_l_sreg, GLI_U8_SITE_DFR );
+
+	/* Step 2: Highest priority pending work first, then look again from the highest: a work posted meanwhile may come first */
+	while ( u8_g_dfrPending != 0 )
+	{
+		for ( u8_l_workId = 0; GET_BIT( u8_g_dfrPending, u8_l_workId ) == 0; u8_l_workId++ );
+
+		CLR_BIT( u8_g_dfrPending, u8_l_workId );
+
+		/* Check 2.1: Posted work is in the table, it runs with interrupts enabled */
+		if ( u8_l_workId < u8_gs_dfrWorksNumber )
+		{
+			GLI_EXIT_CRITICAL( u8_l_sreg );
+			pf_gs_dfrWorks[u8_l_workId]();
+			GLI_ENTER_CRITICAL( u8_l_sreg, GLI_U8_SITE_DFR );
+		}
+	}
+
+	u8_gs_dfrRunning = STD_NOK;
+}
+
+/* ***********************************************************************************************/
@@ -0,0 +1,61 @@
+/*
+ * evg_interface.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all System Event Group (EVG) functions' prototypes.
+ *               The flags, the group byte and the _FROM_ISR macros are in LIB/evg.h, so the lower layers can
+ *               subscribe to flags without depending on this service. Set, clear and test-and-clear are atomic.
+ */
+
+#ifndef EVG_INTERFACE_H_
+#define EVG_INTERFACE_H_
+
+/* ***********************************************************************************************/
+/* EVG Includes */
+
+/* LIB */
+#include "../../LIB/std.h"
+#include "../../LIB/evg.h"
+
+/* MCAL */
+#include "../../MCAL/gli/gli_interface.h"
+
+/* ***********************************************************************************************/
+/* EVG Functions' Prototypes */
+
+/**
+ * @brief Raises flags, atomically.
+ *
+ * @param[in] u8_a_mask Flags to raise ( EVG_U8_xxx ).
+ */
+void EVG_set          ( u8 u8_a_mask );
+
+/**
+ * @brief Releases flags, atomically.
+ *
+ * @param[in] u8_a_mask Flags to release ( EVG_U8_xxx ).
+ */
+void EVG_clear        ( u8 u8_a_mask );
+
+/**
+ * @brief Reads then releases flags, atomically, so a flag raised by an ISR in between is never lost.
+ *
+ * @param[in] u8_a_mask Flags to read and release ( EVG_U8_xxx ).
+ *
+ * @return u8 Flags of the mask that were raised.
+ */
+u8   EVG_testAndClear ( u8 u8_a_mask );
+
+/**
+ * @brief Waits until one flag of the mask is raised ( by an ISR ). Must not be called with interrupts disabled.
+ *
+ * @param[in] u8_a_mask Flags to wait for ( EVG_U8_xxx ).
+ *
+ * @return u8 Flags of the mask that are raised.
+ */
+u8   EVG_waitAny      ( u8 u8_a_mask );
+
+/* ***********************************************************************************************/
+
+#endif /* EVG_INTERFACE_H_ */
@@ -0,0 +1,88 @@
+/*
+ * evg_program.c
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all System Event Group (EVG) functions' implementation.
+ */
+
+/* SERVICE */
+#include "evg_interface.h"
+
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+volatile u8 u8_g_evgFlags = 0;
+
+/* ***********************************************************************************************/
+
+/**
+ * @brief Raises flags, atomically.
+ *
+ * @param[in] u8_a_mask Flags to raise ( EVG_U8_xxx ).
+ */
+void EVG_set          ( u8 u8_a_mask )
+{
+	u8 u8_l_sreg;
+
+	GLI_ENTER_CRITICAL( u8_l_sreg, GLI_U8_SITE_EVG );
+	u8_g_evgFlags |= u8_a_mask;
+	GLI_EXIT_CRITICAL( u8_l_sreg );
+}
+
+/**
+ * @brief Releases flags, atomically.
+ *
+ * @param[in] u8_a_mask Flags to release ( EVG_U8_xxx ).
+ */
+void EVG_clear        ( u8 u8_a_mask )
+{
+	u8 u8_l_sreg;
+
+	GLI_ENTER_CRITICAL( u8_l_sreg, GLI_U8_SITE_EVG );
+	u8_g_evgFlags &= ( u8 ) ~u8_a_mask;
+	GLI_EXIT_CRITICAL( u8_l_sreg );
+}
+
+/**
+ * @brief Reads then releases flags, atomically, so a flag raised by an ISR in between is never lost.
+ *
+ * @param[in] u8_a_mask Flags to read and release ( EVG_U8_xxx ).
+ *
+ * @return u8 Flags of the mask that were raised.
+ */
+u8   EVG_testAndClear ( u8 u8_a_mask )
+{
+	u8 u8_l_sreg;
+	u8 u8_l_flags;
+
+	GLI_ENTER_CRITICAL( u8_l_sreg, GLI_U8_SITE_EVG );
+	u8_l_flags = u8_g_evgFlags & u8_a_mask;
+	u8_g_evgFlags &= ( u8 ) ~u8_a_mask;
+	GLI_EXIT_CRITICAL( u8_l_sreg );
+
+	return u8_l_flags;
+}
+
+/**
+ * @brief Waits until one flag of the mask is raised ( by an ISR ). Must not be called with interrupts disabled.
+ *
+ * @param[in] u8_a_mask Flags to wait for ( EVG_U8_xxx ).
+ *
+ * @return u8 Flags of the mask that are raised.
+ */
+u8   EVG_waitAny      ( u8 u8_a_mask )
+{
+	u8 u8_l_flags;
+
+	/* Step 1: One byte read per loop, the group byte is volatile */
+	do
+	{
+		u8_l_flags = u8_g_evgFlags & u8_a_mask;
+	}
+	while ( u8_l_flags == 0 );
+
+	return u8_l_flags;
+}
+
+/* ***********************************************************************************************/
@@ -0,0 +1,22 @@
+/*
+ * evq_config.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Event Queue (EVQ) pre-build configurations, through which user can configure before using the EVQ service.
+ */
+
+#ifndef EVQ_CONFIG_H_
+#define EVQ_CONFIG_H_
+
+/* ***********************************************************************************************/
+/* EVQ Configurations */
+
+/* Events per queue, must be a power of two ( 2 -> 128 ), so indices wrap with a mask */
+#define EVQ_U8_SIZE				16
+
+/* End of Configurations */
+
+/* ***********************************************************************************************/
+
+#endif /* EVQ_CONFIG_H_ */
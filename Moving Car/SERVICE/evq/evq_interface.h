@@ -0,0 +1,103 @@
+/*
+ * evq_interface.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Event Queue (EVQ) functions' prototypes and definitions (Macros) to avoid magic numbers.
+ *               EVQ is a lock-free single-producer/single-consumer ring buffer of timestamped events: ISR callbacks push,
+ *               the main loop pops. Each side only writes its own index, so no side disables interrupts.
+ *               ISRs do not nest on the AVR, so all ISR callbacks together act as one producer.
+ */
+
+#ifndef EVQ_INTERFACE_H_
+#define EVQ_INTERFACE_H_
+
+/* ***********************************************************************************************/
+/* EVQ Includes */
+
+/* LIB */
+#include "../../LIB/std.h"
+#include "../../LIB/bit_math.h"
+
+/* SERVICE */
+#include "evq_config.h"
+
+/* ***********************************************************************************************/
+/* EVQ Macros */
+
+#if ( ( EVQ_U8_SIZE < 2 ) || ( EVQ_U8_SIZE > 128 ) || ( ( EVQ_U8_SIZE & ( EVQ_U8_SIZE - 1 ) ) != 0 ) )
+#error "EVQ_U8_SIZE must be a power of two from 2 to 128"
+#endif
+
+/**
+ * @brief Timestamped event.
+ */
+typedef struct {
+	u8  u8_event;			/* Event identifier, defined by the user */
+	u32 u32_timestamp;		/* Time the event was raised, in the producer's time base */
+}ST_EVQ_event_t;
+
+/**
+ * @brief Event queue. Indices run freely from 0 to 255, and are masked on access.
+ */
+typedef struct {
+	volatile ST_EVQ_event_t st_events[EVQ_U8_SIZE];
+	volatile u8  u8_head;		/* Next event to pop, written by the consumer only */
+	volatile u8  u8_tail;		/* Next free slot, written by the producer only */
+	volatile u16 u16_overflows;	/* Events lost on a full queue, written by the producer only */
+}ST_EVQ_queue_t;
+
+typedef enum {
+	EVQ_OK,
+	EVQ_ERROR
+}EN_EVQ_ERROR_T;
+
+/* ***********************************************************************************************/
+/* EVQ Functions' Prototypes */
+
+/**
+ * @brief Initializes an event queue as empty. Must be called before the producer is enabled.
+ *
+ * @param[in] st_a_queue Pointer to the queue.
+ *
+ * @return EN_EVQ_ERROR_T EVQ_OK if initialized, EVQ_ERROR if the pointer is NULL.
+ */
+EN_EVQ_ERROR_T EVQ_init        ( ST_EVQ_queue_t *st_a_queue );
+
+/**
+ * @brief Pushes an event. Producer side ( ISR callbacks ) only.
+ * On a full queue the event is dropped, and the overflow counter is incremented.
+ *
+ * @param[in] st_a_queue      Pointer to the queue.
+ * @param[in] u8_a_event      Event identifier.
+ * @param[in] u32_a_timestamp Time the event was raised.
+ *
+ * @return EN_EVQ_ERROR_T EVQ_OK if pushed, EVQ_ERROR if the queue is full or the pointer is NULL.
+ */
+EN_EVQ_ERROR_T EVQ_push        ( ST_EVQ_queue_t *st_a_queue, u8 u8_a_event, u32 u32_a_timestamp );
+
+/**
+ * @brief Pops up to a number of events, oldest first, then frees their slots at once. Consumer side ( main loop ) only.
+ *
+ * @param[in]  st_a_queue      Pointer to the queue.
+ * @param[out] st_a_events     Array where the events will be copied.
+ * @param[in]  u8_a_maxEvents  Array size in events.
+ * @param[out] u8_a_eventsCount Pointer to where the number of popped events will be stored ( 0 if the queue is empty ).
+ *
+ * @return EN_EVQ_ERROR_T EVQ_OK if popped, EVQ_ERROR if a pointer is NULL.
+ */
+EN_EVQ_ERROR_T EVQ_popBatch    ( ST_EVQ_queue_t *st_a_queue, ST_EVQ_event_t *st_a_events, u8 u8_a_maxEvents, u8 *u8_a_eventsCount );
+
+/**
+ * @brief Reads the number of events lost on a full queue since it was initialized ( saturates at 0xFFFF ).
+ *
+ * @param[in]  st_a_queue       Pointer to the queue.
+ * @param[out] u16_a_overflows  Pointer to where the counter will be stored.
+ *
+ * @return EN_EVQ_ERROR_T EVQ_OK if read, EVQ_ERROR if a pointer is NULL.
+ */
+EN_EVQ_ERROR_T EVQ_getOverflows( ST_EVQ_queue_t *st_a_queue, u16 *u16_a_overflows );
+
+/* ***********************************************************************************************/
+
+#endif /* EVQ_INTERFACE_H_ */
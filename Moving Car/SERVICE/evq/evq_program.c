@@ -0,0 +1,135 @@
+/*
+ * evq_program.c
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Event Queue (EVQ) functions' implementation.
+ */
+
+/* SERVICE */
+#include "evq_config.h"
+#include "evq_interface.h"
+
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+/* Slot of a free running index */
+#define EVQ_U8_INDEX_MASK		( EVQ_U8_SIZE - 1 )
+
+/* ***********************************************************************************************/
+
+/**
+ * @brief Initializes an event queue as empty. Must be called before the producer is enabled.
+ *
+ * @param[in] st_a_queue Pointer to the queue.
+ *
+ * @return EN_EVQ_ERROR_T EVQ_OK if initialized, EVQ_ERROR if the pointer is NULL.
+ */
+EN_EVQ_ERROR_T EVQ_init        ( ST_EVQ_queue_t *st_a_queue )
+{
+	if ( st_a_queue == NULL ) return EVQ_ERROR;
+
+	st_a_queue->u8_head       = 0;
+	st_a_queue->u8_tail       = 0;
+	st_a_queue->u16_overflows = 0;
+
+	return EVQ_OK;
+}
+
+/**
+ * @brief Pushes an event. Producer side ( ISR callbacks ) only.
+ * On a full queue the event is dropped, and the overflow counter is incremented.
+ *
+ * @param[in] st_a_queue      Pointer to the queue.
+ * @param[in] u8_a_event      Event identifier.
+ * @param[in] u32_a_timestamp Time the event was raised.
+ *
+ * @return EN_EVQ_ERROR_T EVQ_OK if pushed, EVQ_ERROR if the queue is full or the pointer is NULL.
+ */
+EN_EVQ_ERROR_T EVQ_push        ( ST_EVQ_queue_t *st_a_queue, u8 u8_a_event, u32 u32_a_timestamp )
+{
+	u8 u8_l_tail;
+
+	if ( st_a_queue == NULL ) return EVQ_ERROR;
+
+	u8_l_tail = st_a_queue->u8_tail;
+
+	/* Check 1: Queue is full ( free running indices, the difference is the number of events ) */
+	if ( ( u8 ) ( u8_l_tail - st_a_queue->u8_head ) == EVQ_U8_SIZE )
+	{
+		if ( st_a_queue->u16_overflows != 0xFFFF ) st_a_queue->u16_overflows++;
+		return EVQ_ERROR;
+	}
+
+	/* Step 1: Fill the slot, then publish it by moving the tail ( single byte write, atomic ) */
+	st_a_queue->st_events[u8_l_tail & EVQ_U8_INDEX_MASK].u8_event      = u8_a_event;
+	st_a_queue->st_events[u8_l_tail & EVQ_U8_INDEX_MASK].u32_timestamp = u32_a_timestamp;
+	st_a_queue->u8_tail = u8_l_tail + 1;
+
+	return EVQ_OK;
+}
+
+/**
+ * @brief Pops up to a number of events, oldest first, then frees their slots at once. Consumer side ( main loop ) only.
+ *
+ * @param[in]  st_a_queue      Pointer to the queue.
+ * @param[out] st_a_events     Array where the events will be copied.
+ * @param[in]  u8_a_maxEvents  Array size in events.
+ * @param[out] u8_a_eventsCount Pointer to where the number of popped events will be stored ( 0 if the queue is empty ).
+ *
+ * @return EN_EVQ_ERROR_T EVQ_OK if popped, EVQ_ERROR if a pointer is NULL.
+ */
+EN_EVQ_ERROR_T EVQ_popBatch    ( ST_EVQ_queue_t *st_a_queue, ST_EVQ_event_t *st_a_events, u8 u8_a_maxEvents, u8 *u8_a_eventsCount )
+{
+	u8 u8_l_head;
+	u8 u8_l_available;
+	u8 u8_l_index;
+
+	if ( ( st_a_queue == NULL ) || ( st_a_events == NULL ) || ( u8_a_eventsCount == NULL ) ) return EVQ_ERROR;
+
+	/* Step 1: Events published so far, the tail is read once for the whole batch */
+	u8_l_head      = st_a_queue->u8_head;
+	u8_l_available = ( u8 ) ( st_a_queue->u8_tail - u8_l_head );
+	if ( u8_l_available > u8_a_maxEvents ) u8_l_available = u8_a_maxEvents;
+
+	/* Step 2: Copy them out */
+	for ( u8_l_index = 0; u8_l_index < u8_l_available; u8_l_index++ )
+	{
+		st_a_events[u8_l_index].u8_event      = st_a_queue->st_events[( u8 ) ( u8_l_head + u8_l_index ) & EVQ_U8_INDEX_MASK].u8_event;
+		st_a_events[u8_l_index].u32_timestamp = st_a_queue->st_events[( u8 ) ( u8_l_head + u8_l_index ) & EVQ_U8_INDEX_MASK].u32_timestamp;
+	}
+
+	/* Step 3: Free the slots at once by moving the head ( single byte write, atomic ) */
+	st_a_queue->u8_head = u8_l_head + u8_l_available;
+	*u8_a_eventsCount   = u8_l_available;
+
+	return EVQ_OK;
+}
+
+/**
+ * @brief Reads the number of events lost on a full queue since it was initialized ( saturates at 0xFFFF ).
+ *
+ * @param[in]  st_a_queue       Pointer to the queue.
+ * @param[out] u16_a_overflows  Pointer to where the counter will be stored.
+ *
+ * @return EN_EVQ_ERROR_T EVQ_OK if read, EVQ_ERROR if a pointer is NULL.
+ */
+EN_EVQ_ERROR_T EVQ_getOverflows( ST_EVQ_queue_t *st_a_queue, u16 *u16_a_overflows )
+{
+	u16 u16_l_overflows;
+
+	if ( ( st_a_queue == NULL ) || ( u16_a_overflows == NULL ) ) return EVQ_ERROR;
+
+	/* The 2 bytes are updated from ISRs, read again until the value is stable */
+	do
+	{
+		u16_l_overflows = st_a_queue->u16_overflows;
+	}
+	while ( u16_l_overflows != st_a_queue->u16_overflows );
+
+	*u16_a_overflows = u16_l_overflows;
+
+	return EVQ_OK;
+}
+
+/* ***********************************************************************************************/
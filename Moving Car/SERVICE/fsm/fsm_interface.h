@@ -0,0 +1,100 @@
+/*
+ * fsm_interface.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Finite State Machine (FSM) functions' prototypes and definitions (Macros) to avoid magic numbers.
+ *               FSM is a table-driven event-based state machine engine: a constant ( state, event ) -> ( action, next state )
+ *               table in flash, with entry/exit actions per state, and O(1) dispatch of an event.
+ */
+
+#ifndef FSM_INTERFACE_H_
+#define FSM_INTERFACE_H_
+
+/* ***********************************************************************************************/
+/* FSM Includes */
+
+/* LIB */
+#include "../../LIB/std.h"
+#include "../../LIB/bit_math.h"
+#include "../../LIB/pgm.h"
+
+/* ***********************************************************************************************/
+/* FSM Macros */
+
+/* Next state values with a special meaning */
+/* Event is ignored in this state: no action, no state change */
+#define FSM_U8_NO_TRANSITION	0xFF
+/* Internal transition: the action runs, the state is kept, and no exit/entry actions run */
+#define FSM_U8_INTERNAL			0xFE
+
+/**
+ * @brief One cell of the transition table, placed in flash ( PGM_MEM ).
+ */
+typedef struct {
+	u8   u8_nextState;				/* Next state, FSM_U8_NO_TRANSITION or FSM_U8_INTERNAL */
+	void ( *pf_action ) ( void );	/* Transition action, NULL if none */
+}ST_FSM_transition_t;
+
+/**
+ * @brief Constant machine description. The tables it points to are placed in flash ( PGM_MEM ).
+ */
+typedef struct {
+	const ST_FSM_transition_t *pst_transitions;		/* [states][events] table, row = state */
+	void ( * const *pf_entryActions ) ( void );		/* Entry action per state, NULL if none */
+	void ( * const *pf_exitActions ) ( void );		/* Exit action per state, NULL if none */
+	u8 u8_statesNumber;
+	u8 u8_eventsNumber;
+}ST_FSM_machine_t;
+
+/**
+ * @brief State machine instance.
+ */
+typedef struct {
+	const ST_FSM_machine_t *pst_machine;
+	u8 u8_state;
+}ST_FSM_t;
+
+typedef enum {
+	FSM_OK,
+	FSM_ERROR
+}EN_FSM_ERROR_T;
+
+/* ***********************************************************************************************/
+/* FSM Functions' Prototypes */
+
+/**
+ * @brief Initializes a state machine instance in its initial state, and runs the initial state entry action.
+ *
+ * @param[in] st_a_fsm          Pointer to the instance.
+ * @param[in] st_a_machine      Pointer to the constant machine description.
+ * @param[in] u8_a_initialState Initial state.
+ *
+ * @return EN_FSM_ERROR_T FSM_OK if initialized, FSM_ERROR if a pointer is NULL or the state is invalid.
+ */
+EN_FSM_ERROR_T FSM_init    ( ST_FSM_t *st_a_fsm, const ST_FSM_machine_t *st_a_machine, u8 u8_a_initialState );
+
+/**
+ * @brief Dispatches an event: looks up the ( current state, event ) cell, then runs
+ * the current state exit action, the transition action, and the next state entry action.
+ *
+ * @param[in] st_a_fsm   Pointer to the instance.
+ * @param[in] u8_a_event Event.
+ *
+ * @return EN_FSM_ERROR_T FSM_OK if dispatched ( or ignored by the current state ), FSM_ERROR if the pointer is NULL or the event is invalid.
+ */
+EN_FSM_ERROR_T FSM_dispatch( ST_FSM_t *st_a_fsm, u8 u8_a_event );
+
+/**
+ * @brief Reads the current state of a state machine instance.
+ *
+ * @param[in]  st_a_fsm   Pointer to the instance.
+ * @param[out] u8_a_state Pointer to where the current state will be stored.
+ *
+ * @return EN_FSM_ERROR_T FSM_OK if read, FSM_ERROR if a pointer is NULL.
+ */
+EN_FSM_ERROR_T FSM_getState( const ST_FSM_t *st_a_fsm, u8 *u8_a_state );
+
+/* ***********************************************************************************************/
+
+#endif /* FSM_INTERFACE_H_ */
@@ -0,0 +1,118 @@
+/*
+ * fsm_program.c
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Finite State Machine (FSM) functions' implementation.
+ */
+
+/* SERVICE */
+#include "fsm_interface.h"
+
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+/* Run the action stored at a flash address, if any */
+static void FSM_runAction( void ( * const *pf_a_action ) ( void ) );
+
+/* ***********************************************************************************************/
+
+/**
+ * @brief Initializes a state machine instance in its initial state, and runs the initial state entry action.
+ *
+ * @param[in] st_a_fsm          Pointer to the instance.
+ * @param[in] st_a_machine      Pointer to the constant machine description.
+ * @param[in] u8_a_initialState Initial state.
+ *
+ * @return EN_FSM_ERROR_T FSM_OK if initialized, FSM_ERROR if a pointer is NULL or the state is invalid.
+ */
+EN_FSM_ERROR_T FSM_init    ( ST_FSM_t *st_a_fsm, const ST_FSM_machine_t *st_a_machine, u8 u8_a_initialState )
+{
+	/* Check 1: Pointers exist, and the state is valid */
+	if ( ( st_a_fsm == NULL ) || ( st_a_machine == NULL ) || ( st_a_machine->pst_transitions == NULL ) ||
+		 ( u8_a_initialState >= st_a_machine->u8_statesNumber ) ) return FSM_ERROR;
+
+	st_a_fsm->pst_machine = st_a_machine;
+	st_a_fsm->u8_state    = u8_a_initialState;
+
+	if ( st_a_machine->pf_entryActions != NULL ) FSM_runAction( &st_a_machine->pf_entryActions[u8_a_initialState] );
+
+	return FSM_OK;
+}
+
+/**
+ * @brief Dispatches an event: looks up the ( current state, event ) cell, then runs
+ * the current state exit action, the transition action, and the next state entry action.
+ *
+ * @param[in] st_a_fsm   Pointer to the instance.
+ * @param[in] u8_a_event Event.
+ *
+ * @return EN_FSM_ERROR_T FSM_OK if dispatched ( or ignored by the current state ), FSM_ERROR if the pointer is NULL or the event is invalid.
+ */
+EN_FSM_ERROR_T FSM_dispatch( ST_FSM_t *st_a_fsm, u8 u8_a_event )
+{
+	const ST_FSM_machine_t    *st_l_machine;
+	const ST_FSM_transition_t *st_l_cell;
+	u8 u8_l_nextState;
+
+	/* Check 1: Instance is initialized, and the event is valid */
+	if ( ( st_a_fsm == NULL ) || ( st_a_fsm->pst_machine == NULL ) ) return FSM_ERROR;
+
+	st_l_machine = st_a_fsm->pst_machine;
+
+	if ( u8_a_event >= st_l_machine->u8_eventsNumber ) return FSM_ERROR;
+
+	/* Step 1: O(1) lookup of the ( state, event ) cell in flash */
+	st_l_cell      = &st_l_machine->pst_transitions[( u16 ) st_a_fsm->u8_state * st_l_machine->u8_eventsNumber + u8_a_event];
+	u8_l_nextState = PGM_READ_BYTE( &st_l_cell->u8_nextState );
+
+	/* Check 2: Event is ignored in this state */
+	if ( u8_l_nextState == FSM_U8_NO_TRANSITION ) return FSM_OK;
+
+	/* Check 3: Internal transition, only the action runs */
+	if ( u8_l_nextState == FSM_U8_INTERNAL )
+	{
+		FSM_runAction( &st_l_cell->pf_action );
+		return FSM_OK;
+	}
+
+	/* Step 2: Exit, transition action, then entry */
+	if ( st_l_machine->pf_exitActions != NULL ) FSM_runAction( &st_l_machine->pf_exitActions[st_a_fsm->u8_state] );
+
+	FSM_runAction( &st_l_cell->pf_action );
+
+	st_a_fsm->u8_state = u8_l_nextState;
+
+	if ( st_l_machine->pf_entryActions != NULL ) FSM_runAction( &st_l_machine->pf_entryActions[u8_l_nextState] );
+
+	return FSM_OK;
+}
+
+/**
+ * @brief Reads the current state of a state machine instance.
+ *
+ * @param[in]  st_a_fsm   Pointer to the instance.
+ * @param[out] u8_a_state Pointer to where the current state will be stored.
+ *
+ * @return EN_FSM_ERROR_T FSM_OK if read, FSM_ERROR if a pointer is NULL.
+ */
+EN_FSM_ERROR_T FSM_getState( const ST_FSM_t *st_a_fsm, u8 *u8_a_state )
+{
+	if ( ( st_a_fsm == NULL ) || ( u8_a_state == NULL ) ) return FSM_ERROR;
+
+	*u8_a_state = st_a_fsm->u8_state;
+
+	return FSM_OK;
+}
+
+/* ***********************************************************************************************/
+
+/* Run the action stored at a flash address, if any */
+static void FSM_runAction( void ( * const *pf_a_action ) ( void ) )
+{
+	void ( *pf_l_action ) ( void ) = ( void ( * ) ( void ) ) PGM_READ_WORD( pf_a_action );
+
+	if ( pf_l_action != NULL ) pf_l_action();
+}
+
+/* ***********************************************************************************************/
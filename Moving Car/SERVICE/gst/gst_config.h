@@ -0,0 +1,30 @@
+/*
+ * gst_config.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Gesture (GST) pre-build configurations, through which user can configure before using the GST service.
+ */
+
+#ifndef GST_CONFIG_H_
+#define GST_CONFIG_H_
+
+/* ***********************************************************************************************/
+/* GST Configurations */
+
+/* All thresholds are in GST_task calls ( ticks ), e.g. 10 msec. each when it runs from a 10 msec. task */
+
+/* Press held for this long is a long press, instead of a click */
+#define GST_U16_LONG_PRESS_TICKS	100
+
+/* Second press this soon after a click is a double click */
+#define GST_U16_DOUBLE_CLICK_TICKS	30
+
+/* Once a long press is reported, one auto-repeat every this long while the button is held */
+#define GST_U16_REPEAT_TICKS		20
+
+/* End of Configurations */
+
+/* ***********************************************************************************************/
+
+#endif /* GST_CONFIG_H_ */
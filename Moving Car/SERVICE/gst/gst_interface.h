@@ -0,0 +1,78 @@
+/*
+ * gst_interface.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Gesture (GST) functions' prototypes and definitions (Macros) to avoid magic numbers.
+ *               GST turns the debounced press and release edges of up to 8 buttons ( HAL/btn ) into gestures, and
+ *               reports each one to a user callback. Each call costs a fixed, small amount of work per button:
+ *               one state and one tick counter per button, no queue and no search.
+ *               All functions are for the main loop ( scheduler tasks ) only.
+ */
+
+#ifndef GST_INTERFACE_H_
+#define GST_INTERFACE_H_
+
+/* ***********************************************************************************************/
+/* GST Includes */
+
+/* LIB */
+#include "../../LIB/std.h"
+#include "../../LIB/bit_math.h"
+
+/* SERVICE */
+#include "gst_config.h"
+
+/* ***********************************************************************************************/
+/* GST Macros */
+
+#if ( ( GST_U16_LONG_PRESS_TICKS == 0 ) || ( GST_U16_DOUBLE_CLICK_TICKS == 0 ) || ( GST_U16_REPEAT_TICKS == 0 ) )
+#error "GST thresholds must not be 0"
+#endif
+
+/* Buttons, bit n is pin n of the debounced port, as in the HAL/btn bitmaps */
+#define GST_U8_BTNS_NUMBER		8
+
+/* Gestures, in the order they can be reported for one button:
+ *  - PRESS:        debounced press, reported at once, before any other gesture of that press.
+ *  - CLICK:        press released before GST_U16_LONG_PRESS_TICKS.
+ *  - DOUBLE_CLICK: press within GST_U16_DOUBLE_CLICK_TICKS after a click, its release is not one more click.
+ *  - LONG_PRESS:   press held for GST_U16_LONG_PRESS_TICKS, its release is not a click.
+ *  - REPEAT:       every GST_U16_REPEAT_TICKS after the long press, while the button is held.
+ * A click is reported on release without waiting for the double click window, so a double click always follows a click. */
+#define GST_U8_PRESS			0
+#define GST_U8_CLICK			1
+#define GST_U8_DOUBLE_CLICK		2
+#define GST_U8_LONG_PRESS		3
+#define GST_U8_REPEAT			4
+
+typedef enum {
+	GST_OK,
+	GST_ERROR
+}EN_GST_ERROR_T;
+
+/* ***********************************************************************************************/
+/* GST Functions' Prototypes */
+
+/**
+ * @brief Initializes the gestures of a set of buttons, all released.
+ *
+ * @param[in] u8_a_btnsMask    Buttons to recognize gestures of ( BTN_U8_MASK ).
+ * @param[in] pf_a_gestureAction Function called with the button pin and the gesture ( GST_U8_xxx ) for each gesture.
+ *
+ * @return EN_GST_ERROR_T GST_OK if initialized, GST_ERROR if the function pointer is NULL.
+ */
+EN_GST_ERROR_T GST_init( u8 u8_a_btnsMask, void ( *pf_a_gestureAction ) ( u8 u8_a_btnPin, u8 u8_a_gesture ) );
+
+/**
+ * @brief Advances the gestures by one tick, with the debounced edges seen since the last call ( BTN_getEdges ).
+ * Gestures are reported from here, in the caller's context.
+ *
+ * @param[in] u8_a_pressedBtns  Bitmap of the buttons pressed since the last call.
+ * @param[in] u8_a_releasedBtns Bitmap of the buttons released since the last call.
+ */
+void           GST_task( u8 u8_a_pressedBtns, u8 u8_a_releasedBtns );
+
+/* ***********************************************************************************************/
+
+#endif /* GST_INTERFACE_H_ */
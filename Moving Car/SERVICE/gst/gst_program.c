@@ -0,0 +1,195 @@
+/*
+ * gst_program.c
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Gesture (GST) functions' implementation.
+ */
+
+/* SERVICE */
+#include "gst_config.h"
+#include "gst_interface.h"
+
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+/* Button phases */
+#define GST_U8_IDLE				0	/* Released, no click to pair */
+#define GST_U8_HELD				1	/* Pressed, may become a click or a long press */
+#define GST_U8_HELD_SECOND		2	/* Second press of a double click, may still become a long press */
+#define GST_U8_HELD_LONG		3	/* Long press reported, auto-repeating */
+#define GST_U8_CLICKED			4	/* Released after a click, the double click window is open */
+
+/* Recognized buttons, and the user callback */
+static u8 u8_gs_gstBtnsMask = 0;
+static void ( *pf_gs_gstGestureAction ) ( u8 u8_a_btnPin, u8 u8_a_gesture ) = NULL;
+
+/* Phase of each button, and ticks spent in it */
+static u8  u8_gs_gstPhases[GST_U8_BTNS_NUMBER];
+static u16 u16_gs_gstTicks[GST_U8_BTNS_NUMBER];
+
+/* GST private functions */
+static void GST_press  ( u8 u8_a_btnPin );
+static void GST_release( u8 u8_a_btnPin );
+static void GST_tick   ( u8 u8_a_btnPin );
+
+/* ***********************************************************************************************/
+
+/**
+ * @brief Initializes the gestures of a set of buttons, all released.
+ *
+ * @param[in] u8_a_btnsMask    Buttons to recognize gestures of ( BTN_U8_MASK ).
+ * @param[in] pf_a_gestureAction Function called with the button pin and the gesture ( GST_U8_xxx ) for each gesture.
+ *
+ * @return EN_GST_ERROR_T GST_OK if initialized, GST_ERROR if the function pointer is NULL.
+ */
+EN_GST_ERROR_T GST_init( u8 u8_a_btnsMask, void ( *pf_a_gestureAction ) ( u8 u8_a_btnPin, u8 u8_a_gesture ) )
+{
+	u8 u8_l_btnPin;
+
+	if ( pf_a_gestureAction == NULL ) return GST_ERROR;
+
+	for ( u8_l_btnPin = 0; u8_l_btnPin < GST_U8_BTNS_NUMBER; u8_l_btnPin++ )
+	{
+		u8_gs_gstPhases[u8_l_btnPin] = GST_U8_IDLE;
+		u16_gs_gstTicks[u8_l_btnPin] = 0;
+	}
+
+	u8_gs_gstBtnsMask      = u8_a_btnsMask;
+	pf_gs_gstGestureAction = pf_a_gestureAction;
+
+	return GST_OK;
+}
+
+/**
+ * @brief Advances the gestures by one tick, with the debounced edges seen since the last call ( BTN_getEdges ).
+ * Gestures are reported from here, in the caller's context.
+ *
+ * @param[in] u8_a_pressedBtns  Bitmap of the buttons pressed since the last call.
+ * @param[in] u8_a_releasedBtns Bitmap of the buttons released since the last call.
+ */
+void           GST_task( u8 u8_a_pressedBtns, u8 u8_a_releasedBtns )
+{
+	u8 u8_l_btnPin;
+	u8 u8_l_btnMask;
+
+	for ( u8_l_btnPin = 0, u8_l_btnMask = 1; u8_l_btnPin < GST_U8_BTNS_NUMBER; u8_l_btnPin++, u8_l_btnMask <<= 1 )
+	{
+		/* Check 1: Not a recognized button */
+		if ( ( u8_gs_gstBtnsMask & u8_l_btnMask ) == 0 ) continue;
+
+		/* Check 2: Both edges since the last call, then apply them in the order they happened:
+		 * a held button was released then pressed again, a released one was pressed then released */
+		if ( ( u8_a_pressedBtns & u8_a_releasedBtns & u8_l_btnMask ) != 0 )
+		{
+			if ( ( u8_gs_gstPhases[u8_l_btnPin] == GST_U8_IDLE ) || ( u8_gs_gstPhases[u8_l_btnPin] == GST_U8_CLICKED ) )
+			{
+				GST_press  ( u8_l_btnPin );
+				GST_release( u8_l_btnPin );
+			}
+			else
+			{
+				GST_release( u8_l_btnPin );
+				GST_press  ( u8_l_btnPin );
+			}
+		}
+		/* Check 3: One edge */
+		else if ( ( u8_a_pressedBtns  & u8_l_btnMask ) != 0 ) GST_press  ( u8_l_btnPin );
+		else if ( ( u8_a_releasedBtns & u8_l_btnMask ) != 0 ) GST_release( u8_l_btnPin );
+		/* Check 4: No edge, then time runs */
+		else                                                  GST_tick   ( u8_l_btnPin );
+	}
+}
+
+/* ***********************************************************************************************/
+/* GST Private Functions */
+
+/**
+ * @brief Debounced press of a button: PRESS, and DOUBLE_CLICK if a click is waiting for its pair.
+ *
+ * @param[in] u8_a_btnPin Button pin.
+ */
+static void GST_press  ( u8 u8_a_btnPin )
+{
+	u8 u8_l_phase = u8_gs_gstPhases[u8_a_btnPin];
+
+	u16_gs_gstTicks[u8_a_btnPin] = 0;
+	pf_gs_gstGestureAction( u8_a_btnPin, GST_U8_PRESS );
+
+	/* Check 1: Click waiting for its pair, then double click */
+	if ( u8_l_phase == GST_U8_CLICKED )
+	{
+		u8_gs_gstPhases[u8_a_btnPin] = GST_U8_HELD_SECOND;
+		pf_gs_gstGestureAction( u8_a_btnPin, GST_U8_DOUBLE_CLICK );
+	}
+	else
+	{
+		u8_gs_gstPhases[u8_a_btnPin] = GST_U8_HELD;
+	}
+}
+
+/**
+ * @brief Debounced release of a button: CLICK if it was a short first press.
+ *
+ * @param[in] u8_a_btnPin Button pin.
+ */
+static void GST_release( u8 u8_a_btnPin )
+{
+	u16_gs_gstTicks[u8_a_btnPin] = 0;
+
+	/* Check 1: Short first press, then click, and open the double click window */
+	if ( u8_gs_gstPhases[u8_a_btnPin] == GST_U8_HELD )
+	{
+		u8_gs_gstPhases[u8_a_btnPin] = GST_U8_CLICKED;
+		pf_gs_gstGestureAction( u8_a_btnPin, GST_U8_CLICK );
+	}
+	else
+	{
+		u8_gs_gstPhases[u8_a_btnPin] = GST_U8_IDLE;
+	}
+}
+
+/**
+ * @brief One tick without edge: LONG_PRESS and REPEAT of a held button, end of the double click window of a released one.
+ *
+ * @param[in] u8_a_btnPin Button pin.
+ */
+static void GST_tick   ( u8 u8_a_btnPin )
+{
+	u8  u8_l_phase = u8_gs_gstPhases[u8_a_btnPin];
+	u16 u16_l_ticks;
+
+	if ( u8_l_phase == GST_U8_IDLE ) return;
+
+	u16_l_ticks = ++u16_gs_gstTicks[u8_a_btnPin];
+
+	switch ( u8_l_phase )
+	{
+		case GST_U8_HELD:
+		case GST_U8_HELD_SECOND:
+			if ( u16_l_ticks >= GST_U16_LONG_PRESS_TICKS )
+			{
+				u8_gs_gstPhases[u8_a_btnPin] = GST_U8_HELD_LONG;
+				u16_gs_gstTicks[u8_a_btnPin] = 0;
+				pf_gs_gstGestureAction( u8_a_btnPin, GST_U8_LONG_PRESS );
+			}
+			break;
+
+		case GST_U8_HELD_LONG:
+			if ( u16_l_ticks >= GST_U16_REPEAT_TICKS )
+			{
+				u16_gs_gstTicks[u8_a_btnPin] = 0;
+				pf_gs_gstGestureAction( u8_a_btnPin, GST_U8_REPEAT );
+			}
+			break;
+
+		case GST_U8_CLICKED:
+			if ( u16_l_ticks >= GST_U16_DOUBLE_CLICK_TICKS ) u8_gs_gstPhases[u8_a_btnPin] = GST_U8_IDLE;
+			break;
+
+		default:
+			break;
+	}
+}
+
+/* ***********************************************************************************************/
@@ -0,0 +1,45 @@
+/*
+ * krn_config.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Kernel (KRN) pre-build configurations, through which user can configure before using the KRN service.
+ */
+
+#ifndef KRN_CONFIG_H_
+#define KRN_CONFIG_H_
+
+/* ***********************************************************************************************/
+/* KRN Configurations */
+
+/* Kernel build: STD_OK builds the kernel, its stacks, TCBs and Timer1 compare match B ISR into the image.
+ * The car runs on the cooperative scheduler ( SERVICE/sch ) and never starts the kernel, so it is left out by default:
+ * the stacks and TCBs below would take about 560 bytes of the 2 KB SRAM, from the scheduler's stack */
+/* Options: STD_OK, STD_NOK */
+#ifndef KRN_U8_ENABLE
+#define KRN_U8_ENABLE					STD_NOK
+#endif
+
+/* Number of application tasks, one per priority, ready bits are kept in one byte with the idle task ( 1 -> 7 ) */
+#define KRN_U8_MAX_TASKS				4
+
+/* Static stack of each task in bytes, one line per priority ( 0 is the highest )
+ * Each stack holds the task's own calls, plus the saved context and the tick ISR calls ( ~48 bytes ) */
+#define KRN_U16_TASK0_STACK_SIZE		128
+#define KRN_U16_TASK1_STACK_SIZE		128
+#define KRN_U16_TASK2_STACK_SIZE		96
+#define KRN_U16_TASK3_STACK_SIZE		96
+/* Idle task stack, runs when no task is ready */
+#define KRN_U16_IDLE_STACK_SIZE			64
+
+/* System tick source: Timer1 CTC mode, F_CPU = 8 MHz */
+/* Timer1 prescaler, 8 MHz / 8 = 1 timer count per usec. */
+#define KRN_U16_TICK_PRESCALER			8
+/* Timer1 counts per tick - 1, ( 999 + 1 ) usec. = 1 msec. tick */
+#define KRN_U16_TICK_COMPARE_VALUE		999
+
+/* End of Configurations */
+
+/* ***********************************************************************************************/
+
+#endif /* KRN_CONFIG_H_ */
@@ -0,0 +1,199 @@
+/*
+ * krn_interface.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Kernel (KRN) functions' prototypes and definitions (Macros) to avoid magic numbers.
+ *               KRN is a minimal preemptive kernel: one task per fixed priority, each with its own static stack.
+ *               The highest priority ready task always runs, the context is switched in the tick ISR and when a task blocks.
+ *               KRN and SCH both use Timer1 as system tick, only one of them may be started.
+ *               The kernel is only built with KRN_U8_ENABLE ( krn_config.h ) set to STD_OK.
+ */
+
+#ifndef KRN_INTERFACE_H_
+#define KRN_INTERFACE_H_
+
+/* ***********************************************************************************************/
+/* KRN Includes */
+
+/* LIB */
+#include "../../LIB/std.h"
+#include "../../LIB/bit_math.h"
+
+/* MCAL */
+#include "../../MCAL/timer/timer_interface.h"
+#include "../../MCAL/gli/gli_interface.h"
+
+/* ***********************************************************************************************/
+/* KRN Macros */
+
+/* Timeouts in ticks ( msec. ) */
+#define KRN_U16_NO_WAIT			0
+#define KRN_U16_WAIT_FOREVER	0xFFFF
+
+/**
+ * @brief Counting semaphore, usable from tasks and ISR callbacks ( e.g. EXI callbacks ).
+ */
+typedef struct {
+	volatile u8 u8_count;		/* Available units */
+	volatile u8 u8_waitBits;	/* One bit per task blocked on the semaphore, bit number = priority */
+}ST_KRN_sem_t;
+
+/**
+ * @brief Bytes queue on a caller-provided buffer, items can be sent from tasks and ISR callbacks.
+ */
+typedef struct {
+	u8 *pu8_buffer;				/* Items storage */
+	u8  u8_size;				/* Storage size in items */
+	volatile u8 u8_head;		/* Next item to receive */
+	volatile u8 u8_used;		/* Items in storage */
+	ST_KRN_sem_t st_items;		/* Items not yet taken by a receiver */
+}ST_KRN_queue_t;
+
+typedef enum {
+	KRN_OK,
+	KRN_ERROR
+}EN_KRN_ERROR_T;
+
+/* ***********************************************************************************************/
+/* KRN Functions' Prototypes */
+
+/**
+ * @brief Initializes the kernel: creates the idle task, and prepares the system tick timer.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK.
+ */
+EN_KRN_ERROR_T KRN_init            ( void );
+
+/**
+ * @brief Creates a task on its priority's static stack ( sized in krn_config.h ).
+ * A task is a function that never returns, it blocks through KRN_delay, KRN_semTake or KRN_queueReceive.
+ *
+ * @param[in] u8_a_priority Task priority ( 0 is the highest, up to KRN_U8_MAX_TASKS - 1 ), one task per priority.
+ * @param[in] pf_a_task     Task body.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if the task is created, KRN_ERROR if the priority is invalid or taken, or the body is NULL.
+ */
+EN_KRN_ERROR_T KRN_createTask      ( u8 u8_a_priority, void ( *pf_a_task ) ( void ) );
+
+/**
+ * @brief Starts the system tick, and switches to the highest priority ready task.
+ * Global interrupts are enabled once the first task runs.
+ *
+ * @return This function never returns.
+ */
+void           KRN_start           ( void );
+
+/**
+ * @brief Blocks the calling task for a number of ticks. Tasks only.
+ *
+ * @param[in] u16_a_ticks Ticks ( msec. ) to wait, 0 only gives the CPU to a ready task of higher priority.
+ */
+void           KRN_delay           ( u16 u16_a_ticks );
+
+/**
+ * @brief Reads the number of system ticks ( msec. ) since the kernel was started.
+ *
+ * @param[out] u32_a_ticks Pointer to where the ticks will be stored.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if the ticks were read, KRN_ERROR if the pointer is NULL.
+ */
+EN_KRN_ERROR_T KRN_getTicks        ( u32 *u32_a_ticks );
+
+/**
+ * @brief Initializes a counting semaphore.
+ *
+ * @param[in] st_a_sem         Pointer to the semaphore.
+ * @param[in] u8_a_initialCount Initial available units.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if initialized, KRN_ERROR if the pointer is NULL.
+ */
+EN_KRN_ERROR_T KRN_semInit         ( ST_KRN_sem_t *st_a_sem, u8 u8_a_initialCount );
+
+/**
+ * @brief Takes one unit of a semaphore, blocks the calling task until a unit is available or the timeout elapses. Tasks only.
+ *
+ * @param[in] st_a_sem     Pointer to the semaphore.
+ * @param[in] u16_a_timeout Ticks to wait ( KRN_U16_NO_WAIT, 1 -> 65534, or KRN_U16_WAIT_FOREVER ).
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if a unit was taken, KRN_ERROR on timeout or NULL pointer.
+ */
+EN_KRN_ERROR_T KRN_semTake         ( ST_KRN_sem_t *st_a_sem, u16 u16_a_timeout );
+
+/**
+ * @brief Gives one unit of a semaphore, the highest priority waiting task takes it.
+ * If that task has a higher priority than the caller, it runs immediately. Tasks only.
+ *
+ * @param[in] st_a_sem Pointer to the semaphore.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if given, KRN_ERROR if the pointer is NULL or the count is full.
+ */
+EN_KRN_ERROR_T KRN_semGive         ( ST_KRN_sem_t *st_a_sem );
+
+/**
+ * @brief Gives one unit of a semaphore from an ISR callback ( e.g. EXI callbacks ).
+ * A woken task of higher priority than the interrupted one runs at the latest on the next tick.
+ *
+ * @param[in] st_a_sem Pointer to the semaphore.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if given, KRN_ERROR if the pointer is NULL or the count is full.
+ */
+EN_KRN_ERROR_T KRN_semGiveFromIsr  ( ST_KRN_sem_t *st_a_sem );
+
+/**
+ * @brief Initializes a queue on a caller-provided buffer.
+ *
+ * @param[in] st_a_queue  Pointer to the queue.
+ * @param[in] pu8_a_buffer Items storage.
+ * @param[in] u8_a_size    Storage size in items ( 1 -> 255 ).
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if initialized, KRN_ERROR if a pointer is NULL or the size is 0.
+ */
+EN_KRN_ERROR_T KRN_queueInit       ( ST_KRN_queue_t *st_a_queue, u8 *pu8_a_buffer, u8 u8_a_size );
+
+/**
+ * @brief Sends an item to a queue without blocking. Tasks only.
+ * If a higher priority task is waiting for an item, it runs immediately.
+ *
+ * @param[in] st_a_queue Pointer to the queue.
+ * @param[in] u8_a_item  Item to send.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if sent, KRN_ERROR if the pointer is NULL or the queue is full.
+ */
+EN_KRN_ERROR_T KRN_queueSend       ( ST_KRN_queue_t *st_a_queue, u8 u8_a_item );
+
+/**
+ * @brief Sends an item to a queue from an ISR callback ( e.g. EXI callbacks ).
+ * A woken task of higher priority than the interrupted one runs at the latest on the next tick.
+ *
+ * @param[in] st_a_queue Pointer to the queue.
+ * @param[in] u8_a_item  Item to send.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if sent, KRN_ERROR if the pointer is NULL or the queue is full.
+ */
+EN_KRN_ERROR_T KRN_queueSendFromIsr( ST_KRN_queue_t *st_a_queue, u8 u8_a_item );
+
+/**
+ * @brief Receives the oldest item of a queue, blocks the calling task until an item arrives or the timeout elapses. Tasks only.
+ *
+ * @param[in]  st_a_queue   Pointer to the queue.
+ * @param[out] pu8_a_item   Pointer to where the item will be stored.
+ * @param[in]  u16_a_timeout Ticks to wait ( KRN_U16_NO_WAIT, 1 -> 65534, or KRN_U16_WAIT_FOREVER ).
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if an item was received, KRN_ERROR on timeout or NULL pointer.
+ */
+EN_KRN_ERROR_T KRN_queueReceive    ( ST_KRN_queue_t *st_a_queue, u8 *pu8_a_item, u16 u16_a_timeout );
+
+/**
+ * @brief Reads the stack bytes a task never used since it was created ( stack high-water mark ).
+ *
+ * @param[in]  u8_a_priority  Task priority, KRN_U8_MAX_TASKS for the idle task.
+ * @param[out] u16_a_freeBytes Pointer to where the never used bytes will be stored.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if read, KRN_ERROR if the priority is invalid or the pointer is NULL.
+ */
+EN_KRN_ERROR_T KRN_getStackFree    ( u8 u8_a_priority, u16 *u16_a_freeBytes );
+
+/* ***********************************************************************************************/
+
+#endif /* KRN_INTERFACE_H_ */
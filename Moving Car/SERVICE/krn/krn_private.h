@@ -0,0 +1,172 @@
+/*
+ * krn_private.h
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: This file contains the Kernel (KRN) private definitions: task control block, registers' locations, and context switch macros.
+ *  MCU Datasheet: AVR ATmega32 - https://ww1.microchip.com/downloads/en/DeviceDoc/Atmega32A-DataSheet-Complete-DS40002072A.pdf
+ */
+
+#ifndef KRN_PRIVATE_H_
+#define KRN_PRIVATE_H_
+
+/* ***********************************************************************************************/
+/* KRN Registers' Locations */
+
+/* Used by the sections that may switch tasks, not GLI sections: a span timed there would run across other tasks
+ * ( excluded from GLI_getLongestSpan ) */
+#define KRN_U8_SREG_REG			*( ( volatile u8 * ) 0x5F )
+
+/* The AVR Status Register - SREG */
+/* Bit 7 -> I: Global Interrupt Enable */
+#define KRN_U8_I_BIT			7
+/* End of SREG Register */
+
+/* ***********************************************************************************************/
+/* KRN Private Macros */
+
+/* Idle task priority, lower than every application task */
+#define KRN_U8_IDLE_PRIORITY	KRN_U8_MAX_TASKS
+
+/* Value painted on the stacks, to measure the never used bytes */
+#define KRN_U8_STACK_PAINT		0xA5
+
+/* Initial SREG of a task, global interrupts enabled */
+#define KRN_U8_INITIAL_SREG		0x80
+
+/* Why a blocked task was made ready again */
+#define KRN_U8_WAKE_TIMEOUT		0
+#define KRN_U8_WAKE_EVENT		1
+
+/**
+ * @brief Task Control Block. The saved stack pointer must stay the first member, it is accessed by the context switch code.
+ */
+typedef struct {
+	volatile u16 u16_stackPointer;	/* Stack pointer saved by the last context switch */
+	volatile u16 u16_delay;			/* Ticks left before timeout, 0 if none, KRN_U16_WAIT_FOREVER if blocked without timeout */
+	ST_KRN_sem_t *volatile pst_waitSem;	/* Semaphore the task is blocked on, NULL if none */
+	volatile u8  u8_wakeReason;		/* KRN_U8_WAKE_TIMEOUT or KRN_U8_WAKE_EVENT */
+	u8  *pu8_stack;					/* Stack lowest address */
+	u16 u16_stackSize;				/* Stack size in bytes */
+}ST_KRN_tcb_t;
+
+/*
+ * Context save and restore ( all 32 registers and SREG, on the task's own stack ).
+ * The saved stack pointer is stored in / loaded from the first member of the running task's TCB.
+ *
+ * Static cycle counts ( ATmega32 instruction timings, no emulator run ):
+ *  - KRN_SAVE_CONTEXT    : 79 cycles
+ *  - KRN_RESTORE_CONTEXT : 77 cycles
+ *  - Tick ISR overhead around both: interrupt response 4, vector jmp 3, call 4, ret 4, reti 4 = 19 cycles
+ *  - A preemptive switch is then 175 cycles ( ~22 usec. at 8 MHz ) plus KRN_tickHandler.
+ */
+#define KRN_SAVE_CONTEXT()							\
+	__asm__ __volatile__ (							\
+		"push r0                        \n\t"	\
+		"in   r0, __SREG__              \n\t"	\
+		"cli                            \n\t"	\
+		"push r0                        \n\t"	\
+		"push r1                        \n\t"	\
+		"clr  r1                        \n\t"	\
+		"push r2                        \n\t"	\
+		"push r3                        \n\t"	\
+		"push r4                        \n\t"	\
+		"push r5                        \n\t"	\
+		"push r6                        \n\t"	\
+		"push r7                        \n\t"	\
+		"push r8                        \n\t"	\
+		"push r9                        \n\t"	\
+		"push r10                       \n\t"	\
+		"push r11                       \n\t"	\
+		"push r12                       \n\t"	\
+		"push r13                       \n\t"	\
+		"push r14                       \n\t"	\
+		"push r15                       \n\t"	\
+		"push r16                       \n\t"	\
+		"push r17                       \n\t"	\
+		"push r18                       \n\t"	\
+		"push r19                       \n\t"	\
+		"push r20                       \n\t"	\
+		"push r21                       \n\t"	\
+		"push r22                       \n\t"	\
+		"push r23                       \n\t"	\
+		"push r24                       \n\t"	\
+		"push r25                       \n\t"	\
+		"push r26                       \n\t"	\
+		"push r27                       \n\t"	\
+		"push r28                       \n\t"	\
+		"push r29                       \n\t"	\
+		"push r30                       \n\t"	\
+		"push r31                       \n\t"	\
+		"lds  r26, pst_g_krnCurrentTcb  \n\t"	\
+		"lds  r27, pst_g_krnCurrentTcb+1\n\t"	\
+		"in   r0, __SP_L__              \n\t"	\
+		"st   x+, r0                    \n\t"	\
+		"in   r0, __SP_H__              \n\t"	\
+		"st   x+, r0                    \n\t"	\
+	)
+
+#define KRN_RESTORE_CONTEXT()						\
+	__asm__ __volatile__ (							\
+		"lds  r26, pst_g_krnCurrentTcb  \n\t"	\
+		"lds  r27, pst_g_krnCurrentTcb+1\n\t"	\
+		"ld   r28, x+                   \n\t"	\
+		"out  __SP_L__, r28             \n\t"	\
+		"ld   r29, x+                   \n\t"	\
+		"out  __SP_H__, r29             \n\t"	\
+		"pop  r31                       \n\t"	\
+		"pop  r30                       \n\t"	\
+		"pop  r29                       \n\t"	\
+		"pop  r28                       \n\t"	\
+		"pop  r27                       \n\t"	\
+		"pop  r26                       \n\t"	\
+		"pop  r25                       \n\t"	\
+		"pop  r24                       \n\t"	\
+		"pop  r23                       \n\t"	\
+		"pop  r22                       \n\t"	\
+		"pop  r21                       \n\t"	\
+		"pop  r20                       \n\t"	\
+		"pop  r19                       \n\t"	\
+		"pop  r18                       \n\t"	\
+		"pop  r17                       \n\t"	\
+		"pop  r16                       \n\t"	\
+		"pop  r15                       \n\t"	\
+		"pop  r14                       \n\t"	\
+		"pop  r13                       \n\t"	\
+		"pop  r12                       \n\t"	\
+		"pop  r11                       \n\t"	\
+		"pop  r10                       \n\t"	\
+		"pop  r9                        \n\t"	\
+		"pop  r8                        \n\t"	\
+		"pop  r7                        \n\t"	\
+		"pop  r6                        \n\t"	\
+		"pop  r5                        \n\t"	\
+		"pop  r4                        \n\t"	\
+		"pop  r3                        \n\t"	\
+		"pop  r2                        \n\t"	\
+		"pop  r1                        \n\t"	\
+		"pop  r0                        \n\t"	\
+		"out  __SREG__, r0              \n\t"	\
+		"pop  r0                        \n\t"	\
+	)
+
+/* ***********************************************************************************************/
+/* KRN Private Functions' Prototypes */
+
+/* Not static: called by name from the context switch assembly */
+
+/* Count the tick, release the delayed tasks whose timeout elapsed, then select the task to run */
+void KRN_tickHandler  ( void );
+
+/* Select the highest priority ready task as the running task */
+void KRN_selectTask   ( void );
+
+/* Save the running task, select the task to run, and restore it ( naked ) */
+void KRN_yield        ( void ) __attribute__ ( ( naked, noinline ) );
+
+/* Same as KRN_yield, with the tick handling in between, called from the tick ISR ( naked ) */
+void KRN_yieldFromTick( void ) __attribute__ ( ( naked, noinline ) );
+
+/* ***********************************************************************************************/
+
+#endif /* KRN_PRIVATE_H_ */
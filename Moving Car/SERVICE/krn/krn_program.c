@@ -0,0 +1,589 @@
+/*
+ * krn_program.c
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Kernel (KRN) functions' implementation, and the Timer1 compare match B ISR ( system tick ).
+ */
+
+/* SERVICE */
+#include "krn_config.h"
+#include "krn_interface.h"
+#include "krn_private.h"
+
+/* Left out of the image unless enabled ( krn_config.h ) */
+#if ( KRN_U8_ENABLE == STD_OK )
+
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+/* Static stacks, one per priority, sized in krn_config.h */
+static u8 u8_gs_krnStack0[KRN_U16_TASK0_STACK_SIZE];
+static u8 u8_gs_krnStack1[KRN_U16_TASK1_STACK_SIZE];
+static u8 u8_gs_krnStack2[KRN_U16_TASK2_STACK_SIZE];
+static u8 u8_gs_krnStack3[KRN_U16_TASK3_STACK_SIZE];
+static u8 u8_gs_krnIdleStack[KRN_U16_IDLE_STACK_SIZE];
+
+/* Task Control Blocks, index = priority, the idle task is last */
+static ST_KRN_tcb_t st_gs_krnTcbs[KRN_U8_MAX_TASKS + 1] =
+{
+	{ 0, 0, NULL, KRN_U8_WAKE_TIMEOUT, u8_gs_krnStack0,    KRN_U16_TASK0_STACK_SIZE },
+	{ 0, 0, NULL, KRN_U8_WAKE_TIMEOUT, u8_gs_krnStack1,    KRN_U16_TASK1_STACK_SIZE },
+	{ 0, 0, NULL, KRN_U8_WAKE_TIMEOUT, u8_gs_krnStack2,    KRN_U16_TASK2_STACK_SIZE },
+	{ 0, 0, NULL, KRN_U8_WAKE_TIMEOUT, u8_gs_krnStack3,    KRN_U16_TASK3_STACK_SIZE },
+	{ 0, 0, NULL, KRN_U8_WAKE_TIMEOUT, u8_gs_krnIdleStack, KRN_U16_IDLE_STACK_SIZE  }
+};
+
+/* Running task, accessed by name from the context switch assembly */
+ST_KRN_tcb_t *volatile pst_g_krnCurrentTcb = NULL;
+
+/* One ready bit per task, bit number = priority, the idle task is always ready */
+static volatile u8 u8_gs_krnReadyBits = 0;
+
+/* One bit per created task */
+static u8 u8_gs_krnCreatedBits = 0;
+
+/* System ticks since the kernel was started */
+static volatile u32 u32_gs_krnTicks = 0;
+
+/* Idle task body */
+static void KRN_idleTask     ( void );
+
+/* Build the initial context of a task on its stack, as if it was saved by a context switch */
+static void KRN_initContext  ( ST_KRN_tcb_t *st_a_tcb, void ( *pf_a_task ) ( void ) );
+
+/* Give one unit of a semaphore, return the priority of the woken task, or KRN_U8_IDLE_PRIORITY if none */
+static u8   KRN_semRelease   ( ST_KRN_sem_t *st_a_sem, EN_KRN_ERROR_T *en_a_error );
+
+/* Store an item in a queue, KRN_ERROR if full */
+static EN_KRN_ERROR_T KRN_queuePut( ST_KRN_queue_t *st_a_queue, u8 u8_a_item );
+
+/* Kernel build checks */
+#if ( KRN_U8_MAX_TASKS != 4 )
+#error "KRN: one stack size per task must be configured, update the stacks and TCBs tables"
+#endif
+
+/* ***********************************************************************************************/
+
+/**
+ * @brief Initializes the kernel: creates the idle task, and prepares the system tick timer.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK.
+ */
+EN_KRN_ERROR_T KRN_init            ( void )
+{
+	u8 u8_l_priority;
+
+	u8_gs_krnCreatedBits = 0;
+	u32_gs_krnTicks      = 0;
+
+	/* Paint all stacks, to measure the never used bytes later */
+	for ( u8_l_priority = 0; u8_l_priority <= KRN_U8_IDLE_PRIORITY; u8_l_priority++ )
+	{
+		u16 u16_l_index;
+
+		for ( u16_l_index = 0; u16_l_index < st_gs_krnTcbs[u8_l_priority].u16_stackSize; u16_l_index++ )
+		{
+			st_gs_krnTcbs[u8_l_priority].pu8_stack[u16_l_index] = KRN_U8_STACK_PAINT;
+		}
+	}
+
+	/* Idle task runs when no task is ready */
+	KRN_initContext( &st_gs_krnTcbs[KRN_U8_IDLE_PRIORITY], &KRN_idleTask );
+	u8_gs_krnReadyBits = ( 1 << KRN_U8_IDLE_PRIORITY );
+
+	/* System tick: Timer1 CTC, compare match B interrupt owned by the kernel, started by KRN_start */
+	TIMER_timer1CtcInit( KRN_U16_TICK_COMPARE_VALUE );
+	TIMER_timer1CompBTickInit( KRN_U16_TICK_COMPARE_VALUE );
+
+	return KRN_OK;
+}
+
+/**
+ * @brief Creates a task on its priority's static stack ( sized in krn_config.h ).
+ * A task is a function that never returns, it blocks through KRN_delay, KRN_semTake or KRN_queueReceive.
+ *
+ * @param[in] u8_a_priority Task priority ( 0 is the highest, up to KRN_U8_MAX_TASKS - 1 ), one task per priority.
+ * @param[in] pf_a_task     Task body.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if the task is created, KRN_ERROR if the priority is invalid or taken, or the body is NULL.
+ */
+EN_KRN_ERROR_T KRN_createTask      ( u8 u8_a_priority, void ( *pf_a_task ) ( void ) )
+{
+	/* Check 1: Priority is valid and free, and the body exists */
+	if ( ( u8_a_priority >= KRN_U8_MAX_TASKS ) || ( GET_BIT( u8_gs_krnCreatedBits, u8_a_priority ) == 1 ) || ( pf_a_task == NULL ) ) return KRN_ERROR;
+
+	KRN_initContext( &st_gs_krnTcbs[u8_a_priority], pf_a_task );
+
+	SET_BIT( u8_gs_krnCreatedBits, u8_a_priority );
+	SET_BIT( u8_gs_krnReadyBits, u8_a_priority );
+
+	return KRN_OK;
+}
+
+/**
+ * @brief Starts the system tick, and switches to the highest priority ready task.
+ * Global interrupts are enabled once the first task runs.
+ *
+ * @return This function never returns.
+ */
+void           KRN_start           ( void )
+{
+	/* Interrupts stay disabled until the first task context sets SREG */
+	CLR_BIT( KRN_U8_SREG_REG, KRN_U8_I_BIT );
+
+	KRN_selectTask();
+	TIMER_timer1Start( KRN_U16_TICK_PRESCALER );
+
+	/* Step 1: Load the first task context, the return address on its stack is the task body */
+	KRN_RESTORE_CONTEXT();
+	__asm__ __volatile__ ( "ret" );
+
+	while ( 1 );
+}
+
+/**
+ * @brief Blocks the calling task for a number of ticks. Tasks only.
+ *
+ * @param[in] u16_a_ticks Ticks ( msec. ) to wait, 0 only gives the CPU to a ready task of higher priority.
+ */
+void           KRN_delay           ( u16 u16_a_ticks )
+{
+	u8 u8_l_sreg = KRN_U8_SREG_REG;
+
+	CLR_BIT( KRN_U8_SREG_REG, KRN_U8_I_BIT );
+
+	if ( u16_a_ticks != 0 )
+	{
+		/* A delay never waits forever */
+		if ( u16_a_ticks == KRN_U16_WAIT_FOREVER ) u16_a_ticks--;
+
+		pst_g_krnCurrentTcb->u16_delay = u16_a_ticks;
+		CLR_BIT( u8_gs_krnReadyBits, ( u8 ) ( pst_g_krnCurrentTcb - st_gs_krnTcbs ) );
+	}
+
+	KRN_yield();
+
+	KRN_U8_SREG_REG = u8_l_sreg;
+}
+
+/**
+ * @brief Reads the number of system ticks ( msec. ) since the kernel was started.
+ *
+ * @param[out] u32_a_ticks Pointer to where the ticks will be stored.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if the ticks were read, KRN_ERROR if the pointer is NULL.
+ */
+EN_KRN_ERROR_T KRN_getTicks        ( u32 *u32_a_ticks )
+{
+	u8 u8_l_sreg;
+
+	if ( u32_a_ticks == NULL ) return KRN_ERROR;
+
+	GLI_ENTER_CRITICAL( u8_l_sreg, GLI_U8_SITE_KRN );
+	*u32_a_ticks = u32_gs_krnTicks;
+	GLI_EXIT_CRITICAL( u8_l_sreg );
+
+	return KRN_OK;
+}
+
+/**
+ * @brief Initializes a counting semaphore.
+ *
+ * @param[in] st_a_sem         Pointer to the semaphore.
+ * @param[in] u8_a_initialCount Initial available units.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if initialized, KRN_ERROR if the pointer is NULL.
+ */
+EN_KRN_ERROR_T KRN_semInit         ( ST_KRN_sem_t *st_a_sem, u8 u8_a_initialCount )
+{
+	if ( st_a_sem == NULL ) return KRN_ERROR;
+
+	st_a_sem->u8_count    = u8_a_initialCount;
+	st_a_sem->u8_waitBits = 0;
+
+	return KRN_OK;
+}
+
+/**
+ * @brief Takes one unit of a semaphore, blocks the calling task until a unit is available or the timeout elapses. Tasks only.
+ *
+ * @param[in] st_a_sem     Pointer to the semaphore.
+ * @param[in] u16_a_timeout Ticks to wait ( KRN_U16_NO_WAIT, 1 -> 65534, or KRN_U16_WAIT_FOREVER ).
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if a unit was taken, KRN_ERROR on timeout or NULL pointer.
+ */
+EN_KRN_ERROR_T KRN_semTake         ( ST_KRN_sem_t *st_a_sem, u16 u16_a_timeout )
+{
+	EN_KRN_ERROR_T en_l_error = KRN_OK;
+	u8 u8_l_priority;
+	u8 u8_l_sreg;
+
+	if ( st_a_sem == NULL ) return KRN_ERROR;
+
+	u8_l_sreg = KRN_U8_SREG_REG;
+	CLR_BIT( KRN_U8_SREG_REG, KRN_U8_I_BIT );
+
+	/* Check 1: A unit is available */
+	if ( st_a_sem->u8_count > 0 )
+	{
+		st_a_sem->u8_count--;
+	}
+	/* Check 2: Caller does not wait */
+	else if ( u16_a_timeout == KRN_U16_NO_WAIT )
+	{
+		en_l_error = KRN_ERROR;
+	}
+	else
+	{
+		/* Step 1: Block on the semaphore, KRN_semRelease or the tick wakes the task up */
+		u8_l_priority = ( u8 ) ( pst_g_krnCurrentTcb - st_gs_krnTcbs );
+
+		pst_g_krnCurrentTcb->pst_waitSem   = st_a_sem;
+		pst_g_krnCurrentTcb->u16_delay     = u16_a_timeout;
+		pst_g_krnCurrentTcb->u8_wakeReason = KRN_U8_WAKE_TIMEOUT;
+		SET_BIT( st_a_sem->u8_waitBits, u8_l_priority );
+		CLR_BIT( u8_gs_krnReadyBits, u8_l_priority );
+
+		KRN_yield();
+
+		/* Step 2: Running again, the unit was handed over, or the timeout elapsed */
+		if ( pst_g_krnCurrentTcb->u8_wakeReason != KRN_U8_WAKE_EVENT ) en_l_error = KRN_ERROR;
+	}
+
+	KRN_U8_SREG_REG = u8_l_sreg;
+
+	return en_l_error;
+}
+
+/**
+ * @brief Gives one unit of a semaphore, the highest priority waiting task takes it.
+ * If that task has a higher priority than the caller, it runs immediately. Tasks only.
+ *
+ * @param[in] st_a_sem Pointer to the semaphore.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if given, KRN_ERROR if the pointer is NULL or the count is full.
+ */
+EN_KRN_ERROR_T KRN_semGive         ( ST_KRN_sem_t *st_a_sem )
+{
+	EN_KRN_ERROR_T en_l_error;
+	u8 u8_l_sreg;
+
+	if ( st_a_sem == NULL ) return KRN_ERROR;
+
+	u8_l_sreg = KRN_U8_SREG_REG;
+	CLR_BIT( KRN_U8_SREG_REG, KRN_U8_I_BIT );
+
+	/* Check 1: Woken task preempts the caller */
+	if ( KRN_semRelease( st_a_sem, &en_l_error ) < ( u8 ) ( pst_g_krnCurrentTcb - st_gs_krnTcbs ) ) KRN_yield();
+
+	KRN_U8_SREG_REG = u8_l_sreg;
+
+	return en_l_error;
+}
+
+/**
+ * @brief Gives one unit of a semaphore from an ISR callback ( e.g. EXI callbacks ).
+ * A woken task of higher priority than the interrupted one runs at the latest on the next tick.
+ *
+ * @param[in] st_a_sem Pointer to the semaphore.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if given, KRN_ERROR if the pointer is NULL or the count is full.
+ */
+EN_KRN_ERROR_T KRN_semGiveFromIsr  ( ST_KRN_sem_t *st_a_sem )
+{
+	EN_KRN_ERROR_T en_l_error;
+
+	if ( st_a_sem == NULL ) return KRN_ERROR;
+
+	/* Interrupts are already disabled in an ISR */
+	KRN_semRelease( st_a_sem, &en_l_error );
+
+	return en_l_error;
+}
+
+/**
+ * @brief Initializes a queue on a caller-provided buffer.
+ *
+ * @param[in] st_a_queue  Pointer to the queue.
+ * @param[in] pu8_a_buffer Items storage.
+ * @param[in] u8_a_size    Storage size in items ( 1 -> 255 ).
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if initialized, KRN_ERROR if a pointer is NULL or the size is 0.
+ */
+EN_KRN_ERROR_T KRN_queueInit       ( ST_KRN_queue_t *st_a_queue, u8 *pu8_a_buffer, u8 u8_a_size )
+{
+	if ( ( st_a_queue == NULL ) || ( pu8_a_buffer == NULL ) || ( u8_a_size == 0 ) ) return KRN_ERROR;
+
+	st_a_queue->pu8_buffer = pu8_a_buffer;
+	st_a_queue->u8_size    = u8_a_size;
+	st_a_queue->u8_head    = 0;
+	st_a_queue->u8_used    = 0;
+
+	return KRN_semInit( &st_a_queue->st_items, 0 );
+}
+
+/**
+ * @brief Sends an item to a queue without blocking. Tasks only.
+ * If a higher priority task is waiting for an item, it runs immediately.
+ *
+ * @param[in] st_a_queue Pointer to the queue.
+ * @param[in] u8_a_item  Item to send.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if sent, KRN_ERROR if the pointer is NULL or the queue is full.
+ */
+EN_KRN_ERROR_T KRN_queueSend       ( ST_KRN_queue_t *st_a_queue, u8 u8_a_item )
+{
+	EN_KRN_ERROR_T en_l_error;
+	u8 u8_l_sreg;
+
+	if ( st_a_queue == NULL ) return KRN_ERROR;
+
+	u8_l_sreg = KRN_U8_SREG_REG;
+	CLR_BIT( KRN_U8_SREG_REG, KRN_U8_I_BIT );
+
+	en_l_error = KRN_queuePut( st_a_queue, u8_a_item );
+
+	/* Check 1: Item stored, then announce it, a woken receiver may preempt the caller */
+	if ( en_l_error == KRN_OK )
+	{
+		if ( KRN_semRelease( &st_a_queue->st_items, &en_l_error ) < ( u8 ) ( pst_g_krnCurrentTcb - st_gs_krnTcbs ) ) KRN_yield();
+	}
+
+	KRN_U8_SREG_REG = u8_l_sreg;
+
+	return en_l_error;
+}
+
+/**
+ * @brief Sends an item to a queue from an ISR callback ( e.g. EXI callbacks ).
+ * A woken task of higher priority than the interrupted one runs at the latest on the next tick.
+ *
+ * @param[in] st_a_queue Pointer to the queue.
+ * @param[in] u8_a_item  Item to send.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if sent, KRN_ERROR if the pointer is NULL or the queue is full.
+ */
+EN_KRN_ERROR_T KRN_queueSendFromIsr( ST_KRN_queue_t *st_a_queue, u8 u8_a_item )
+{
+	EN_KRN_ERROR_T en_l_error;
+
+	if ( st_a_queue == NULL ) return KRN_ERROR;
+
+	/* Interrupts are already disabled in an ISR */
+	en_l_error = KRN_queuePut( st_a_queue, u8_a_item );
+
+	if ( en_l_error == KRN_OK ) KRN_semRelease( &st_a_queue->st_items, &en_l_error );
+
+	return en_l_error;
+}
+
+/**
+ * @brief Receives the oldest item of a queue, blocks the calling task until an item arrives or the timeout elapses. Tasks only.
+ *
+ * @param[in]  st_a_queue   Pointer to the queue.
+ * @param[out] pu8_a_item   Pointer to where the item will be stored.
+ * @param[in]  u16_a_timeout Ticks to wait ( KRN_U16_NO_WAIT, 1 -> 65534, or KRN_U16_WAIT_FOREVER ).
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if an item was received, KRN_ERROR on timeout or NULL pointer.
+ */
+EN_KRN_ERROR_T KRN_queueReceive    ( ST_KRN_queue_t *st_a_queue, u8 *pu8_a_item, u16 u16_a_timeout )
+{
+	u8 u8_l_sreg;
+
+	if ( ( st_a_queue == NULL ) || ( pu8_a_item == NULL ) ) return KRN_ERROR;
+
+	/* Check 1: An item is reserved for the caller */
+	if ( KRN_semTake( &st_a_queue->st_items, u16_a_timeout ) != KRN_OK ) return KRN_ERROR;
+
+	GLI_ENTER_CRITICAL( u8_l_sreg, GLI_U8_SITE_KRN );
+
+	*pu8_a_item = st_a_queue->pu8_buffer[st_a_queue->u8_head];
+	st_a_queue->u8_head = ( st_a_queue->u8_head + 1 == st_a_queue->u8_size ) ? 0 : st_a_queue->u8_head + 1;
+	st_a_queue->u8_used--;
+
+	GLI_EXIT_CRITICAL( u8_l_sreg );
+
+	return KRN_OK;
+}
+
+/**
+ * @brief Reads the stack bytes a task never used since it was created ( stack high-water mark ).
+ *
+ * @param[in]  u8_a_priority  Task priority, KRN_U8_MAX_TASKS for the idle task.
+ * @param[out] u16_a_freeBytes Pointer to where the never used bytes will be stored.
+ *
+ * @return EN_KRN_ERROR_T KRN_OK if read, KRN_ERROR if the priority is invalid or the pointer is NULL.
+ */
+EN_KRN_ERROR_T KRN_getStackFree    ( u8 u8_a_priority, u16 *u16_a_freeBytes )
+{
+	u16 u16_l_free = 0;
+
+	if ( ( u8_a_priority > KRN_U8_IDLE_PRIORITY ) || ( u16_a_freeBytes == NULL ) ) return KRN_ERROR;
+
+	/* Stacks grow down, untouched paint is at the lowest addresses */
+	while ( ( u16_l_free < st_gs_krnTcbs[u8_a_priority].u16_stackSize ) &&
+			( st_gs_krnTcbs[u8_a_priority].pu8_stack[u16_l_free] == KRN_U8_STACK_PAINT ) )
+	{
+		u16_l_free++;
+	}
+
+	*u16_a_freeBytes = u16_l_free;
+
+	return KRN_OK;
+}
+
+/* ***********************************************************************************************/
+/* Context Switch */
+
+/* Count the tick, release the delayed tasks whose timeout elapsed, then select the task to run */
+void KRN_tickHandler  ( void )
+{
+	u8 u8_l_priority;
+
+	u32_gs_krnTicks++;
+
+	for ( u8_l_priority = 0; u8_l_priority < KRN_U8_MAX_TASKS; u8_l_priority++ )
+	{
+		ST_KRN_tcb_t *st_l_tcb = &st_gs_krnTcbs[u8_l_priority];
+
+		/* Check 1: Task waits with a timeout */
+		if ( ( st_l_tcb->u16_delay == 0 ) || ( st_l_tcb->u16_delay == KRN_U16_WAIT_FOREVER ) ) continue;
+
+		if ( --st_l_tcb->u16_delay == 0 )
+		{
+			/* Check 1.1: Timeout of a semaphore wait, leave the semaphore */
+			if ( st_l_tcb->pst_waitSem != NULL )
+			{
+				CLR_BIT( st_l_tcb->pst_waitSem->u8_waitBits, u8_l_priority );
+				st_l_tcb->pst_waitSem = NULL;
+			}
+			st_l_tcb->u8_wakeReason = KRN_U8_WAKE_TIMEOUT;
+			SET_BIT( u8_gs_krnReadyBits, u8_l_priority );
+		}
+	}
+
+	KRN_selectTask();
+}
+
+/* Select the highest priority ready task as the running task */
+void KRN_selectTask   ( void )
+{
+	u8 u8_l_priority;
+
+	/* Lowest set bit, the idle bit is always set */
+	for ( u8_l_priority = 0; GET_BIT( u8_gs_krnReadyBits, u8_l_priority ) == 0; u8_l_priority++ );
+
+	pst_g_krnCurrentTcb = &st_gs_krnTcbs[u8_l_priority];
+}
+
+/* Save the running task, select the task to run, and restore it ( naked ) */
+void KRN_yield        ( void )
+{
+	KRN_SAVE_CONTEXT();
+	__asm__ __volatile__ ( "call KRN_selectTask" );
+	KRN_RESTORE_CONTEXT();
+	__asm__ __volatile__ ( "ret" );
+}
+
+/* Same as KRN_yield, with the tick handling in between, called from the tick ISR ( naked ) */
+void KRN_yieldFromTick( void )
+{
+	KRN_SAVE_CONTEXT();
+	__asm__ __volatile__ ( "call KRN_tickHandler" );
+	KRN_RESTORE_CONTEXT();
+	__asm__ __volatile__ ( "ret" );
+}
+
+/**
+ * @brief Interrupt Service Routine for Timer1 Compare Match B ( system tick ).
+ *        The whole context is saved by KRN_yieldFromTick, so the ISR has no prologue of its own,
+ *        and returns to the task selected by the tick.
+ */
+void __vector_8( void ) __attribute__ ( ( signal, naked ) );
+void __vector_8( void )
+{
+	__asm__ __volatile__ ( "call KRN_yieldFromTick" );
+	__asm__ __volatile__ ( "reti" );
+}
+
+/* ***********************************************************************************************/
+
+/* Idle task body */
+static void KRN_idleTask     ( void )
+{
+	while ( 1 );
+}
+
+/* Build the initial context of a task on its stack, as if it was saved by a context switch */
+static void KRN_initContext  ( ST_KRN_tcb_t *st_a_tcb, void ( *pf_a_task ) ( void ) )
+{
+	u8 *pu8_l_top = &st_a_tcb->pu8_stack[st_a_tcb->u16_stackSize - 1];
+	u16 u16_l_address = ( u16 ) pf_a_task;
+	u8  u8_l_register;
+
+	/* Step 1: Return address, popped by the "ret" of the context switch ( high byte first ) */
+	*pu8_l_top-- = ( u8 ) ( u16_l_address & 0xFF );
+	*pu8_l_top-- = ( u8 ) ( u16_l_address >> 8 );
+
+	/* Step 2: r0, SREG, then r1 ( zero register ) to r31 */
+	*pu8_l_top-- = 0x00;
+	*pu8_l_top-- = KRN_U8_INITIAL_SREG;
+	for ( u8_l_register = 1; u8_l_register <= 31; u8_l_register++ )
+	{
+		*pu8_l_top-- = 0x00;
+	}
+
+	/* Step 3: AVR stack pointer points to the next free byte */
+	st_a_tcb->u16_stackPointer = ( u16 ) pu8_l_top;
+	st_a_tcb->u16_delay        = 0;
+	st_a_tcb->pst_waitSem      = NULL;
+}
+
+/* Give one unit of a semaphore, return the priority of the woken task, or KRN_U8_IDLE_PRIORITY if none */
+static u8   KRN_semRelease   ( ST_KRN_sem_t *st_a_sem, EN_KRN_ERROR_T *en_a_error )
+{
+	u8 u8_l_priority;
+
+	*en_a_error = KRN_OK;
+
+	/* Check 1: No task waits, then keep the unit */
+	if ( st_a_sem->u8_waitBits == 0 )
+	{
+		if ( st_a_sem->u8_count == 0xFF ) *en_a_error = KRN_ERROR;
+		else                              st_a_sem->u8_count++;
+
+		return KRN_U8_IDLE_PRIORITY;
+	}
+
+	/* Step 1: Hand the unit over to the highest priority waiting task */
+	for ( u8_l_priority = 0; GET_BIT( st_a_sem->u8_waitBits, u8_l_priority ) == 0; u8_l_priority++ );
+
+	CLR_BIT( st_a_sem->u8_waitBits, u8_l_priority );
+	st_gs_krnTcbs[u8_l_priority].pst_waitSem   = NULL;
+	st_gs_krnTcbs[u8_l_priority].u16_delay     = 0;
+	st_gs_krnTcbs[u8_l_priority].u8_wakeReason = KRN_U8_WAKE_EVENT;
+	SET_BIT( u8_gs_krnReadyBits, u8_l_priority );
+
+	return u8_l_priority;
+}
+
+/* Store an item in a queue, KRN_ERROR if full */
+static EN_KRN_ERROR_T KRN_queuePut( ST_KRN_queue_t *st_a_queue, u8 u8_a_item )
+{
+	u16 u16_l_tail;
+
+	if ( st_a_queue->u8_used == st_a_queue->u8_size ) return KRN_ERROR;
+
+	u16_l_tail = ( u16 ) st_a_queue->u8_head + st_a_queue->u8_used;
+	if ( u16_l_tail >= st_a_queue->u8_size ) u16_l_tail -= st_a_queue->u8_size;
+
+	st_a_queue->pu8_buffer[u16_l_tail] = u8_a_item;
+	st_a_queue->u8_used++;
+
+	return KRN_OK;
+}
+
+/* ***********************************************************************************************/
+
+#endif /* KRN_U8_ENABLE */
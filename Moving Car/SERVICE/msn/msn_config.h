@@ -0,0 +1,22 @@
+/*
+ * msn_config.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Mission Interpreter (MSN) pre-build configurations, through which user can configure before using the MSN service.
+ */
+
+#ifndef MSN_CONFIG_H_
+#define MSN_CONFIG_H_
+
+/* ***********************************************************************************************/
+/* MSN Configurations */
+
+/* Deepest nesting of LOOP/NEXT blocks, each level costs 3 bytes of SRAM per mission instance */
+#define MSN_U8_LOOP_DEPTH		4
+
+/* End of Configurations */
+
+/* ***********************************************************************************************/
+
+#endif /* MSN_CONFIG_H_ */
@@ -0,0 +1,206 @@
+/*
+ * msn_interface.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Mission Interpreter (MSN) functions' prototypes and definitions (Macros) to avoid magic numbers.
+ *               MSN runs bytecode missions stored in EEPROM, so missions are loaded without reflashing. A mission is
+ *               validated once when it is loaded, then it runs in place from EEPROM, one instruction per step.
+ *               Moves, LEDs and sensors are reached through operations provided by the user.
+ *
+ *               Mission image: header ( magic, version, length low, length high, checksum ), then the instructions.
+ *               The checksum is the two's complement of the instruction bytes sum.
+ *
+ *               Instruction: opcode in bits 7:5, immediate operand in bits 4:0, then an operand byte for some opcodes.
+ *                 END                      0x00                Mission done.
+ *                 MOVE  speed, time        0x20 | speed / 10   Forward move, speed 10 -> 100 %,
+ *                                          time / 50           time 50 -> 12750 msec.
+ *                 TURN  quarters           0x40 | quarters     Right turn of 1 -> 31 quarter turns.
+ *                 WAIT  time               0x60 | time / 100   Stand still 100 -> 3100 msec.,
+ *                                          0x60, time / 100    or 100 -> 25500 msec. in the long form.
+ *                 LED   mask               0x80 | mask         LEDs 0 -> 3 on/off.
+ *                 LOOP  count              0xA0 | count        Run the block up to NEXT 1 -> 31 times, or forever with 0.
+ *                 NEXT                     0xC0                End of the innermost LOOP block.
+ *                 BR    sensor, offset     0xE0 | sensor       Branch if the sensor is set ( bit 4 set: if clear ),
+ *                                          offset              signed offset from the next instruction.
+ *                                                              Sensor 15 is always set: unconditional jump.
+ *               The host tool Tools/msn_asm.py assembles and disassembles missions.
+ */
+
+#ifndef MSN_INTERFACE_H_
+#define MSN_INTERFACE_H_
+
+/* ***********************************************************************************************/
+/* MSN Includes */
+
+/* LIB */
+#include "../../LIB/std.h"
+#include "../../LIB/bit_math.h"
+
+/* MCAL */
+#include "../../MCAL/eep/eep_interface.h"
+
+/* SERVICE */
+#include "msn_config.h"
+
+/* ***********************************************************************************************/
+/* MSN Macros */
+
+/* MSN Mission Header */
+#define MSN_U8_MAGIC				0x4D
+#define MSN_U8_VERSION				1
+#define MSN_U8_HEADER_SIZE			5
+
+/* MSN Opcodes ( bits 7:5 ) */
+#define MSN_U8_OP_END				0x00
+#define MSN_U8_OP_MOVE				0x20
+#define MSN_U8_OP_TURN				0x40
+#define MSN_U8_OP_WAIT				0x60
+#define MSN_U8_OP_LED				0x80
+#define MSN_U8_OP_LOOP				0xA0
+#define MSN_U8_OP_NEXT				0xC0
+#define MSN_U8_OP_BR				0xE0
+#define MSN_U8_OPCODE_MASK			0xE0
+#define MSN_U8_OPERAND_MASK			0x1F
+
+/* MSN Operands */
+#define MSN_U8_MOVE_MAX_SPEED		10		// x 10 %
+#define MSN_U8_MOVE_TIME_UNIT		50		// msec.
+#define MSN_U8_WAIT_TIME_UNIT		100		// msec.
+#define MSN_U8_LED_MAX_MASK			0x0F
+#define MSN_U8_BR_NEGATE_BIT		4
+#define MSN_U8_BR_SENSOR_MASK		0x0F
+#define MSN_U8_BR_ALWAYS			0x0F
+
+/* MSN States */
+#define MSN_U8_IDLE					0		// Loaded, not started
+#define MSN_U8_RUNNING				1
+#define MSN_U8_DONE					2		// END reached
+#define MSN_U8_FAULT				3		// Not loaded, or invalid mission
+#define MSN_U8_PAUSED				4		// Paused while running, resumed where it stopped
+
+/* MSN Validation Errors */
+#define MSN_U8_ERR_NONE				0
+#define MSN_U8_ERR_HEADER			1		// Bad magic or version, or length does not fit in EEPROM
+#define MSN_U8_ERR_CHECKSUM			2
+#define MSN_U8_ERR_OPERAND			3		// Operand out of range
+#define MSN_U8_ERR_TRUNCATED		4		// Operand byte past the mission end
+#define MSN_U8_ERR_NESTING			5		// LOOP too deep, NEXT without LOOP, or LOOP without NEXT
+#define MSN_U8_ERR_BRANCH			6		// Target outside the mission, inside an instruction, or in another block
+#define MSN_U8_ERR_NO_END			7		// Last instruction is not END
+
+/**
+ * @brief Operations a mission acts through, provided by the user.
+ */
+typedef struct {
+	void ( *pf_move )      ( u8 u8_a_speed, u16 u16_a_time );	/* Start a forward move, speed in %, time in msec. */
+	void ( *pf_turn )      ( u8 u8_a_quarters );				/* Start a right turn of a number of quarter turns */
+	void ( *pf_setLeds )   ( u8 u8_a_mask );					/* Set the LEDs 0 -> 3 */
+	u8   ( *pf_isBusy )    ( void );							/* STD_OK while a move or turn is in progress */
+	u8   ( *pf_readSensor )( u8 u8_a_sensor );					/* STD_OK if the sensor ( 0 -> 14 ) is set */
+}ST_MSN_ops_t;
+
+/**
+ * @brief Mission instance: the mission location, and its execution context.
+ */
+typedef struct {
+	const ST_MSN_ops_t *pst_ops;
+	u16 u16_address;							/* EEPROM address of the first instruction */
+	u16 u16_length;								/* Instructions length in bytes */
+	u16 u16_pc;									/* Offset of the next instruction */
+	u16 u16_loopPc[MSN_U8_LOOP_DEPTH];			/* Offset of each open loop body */
+	u8  u8_loopCount[MSN_U8_LOOP_DEPTH];		/* Runs left of each open loop, 0 runs forever */
+	u8  u8_loopDepth;
+	u8  u8_waiting;								/* STD_OK while a WAIT is in progress */
+	u32 u32_waitDeadline;
+	u32 u32_pauseTime;							/* Time the mission was paused, a WAIT is shifted by the pause on resume */
+	u8  u8_state;								/* MSN_U8_xxx state */
+	u8  u8_error;								/* MSN_U8_ERR_xxx error found by the validator */
+	u16 u16_errorPc;							/* Offset of the faulty instruction */
+}ST_MSN_t;
+
+typedef enum {
+	MSN_OK,
+	MSN_ERROR
+}EN_MSN_ERROR_T;
+
+/* ***********************************************************************************************/
+/* MSN Functions' Prototypes */
+
+/**
+ * @brief Loads a mission stored in EEPROM: checks its header and checksum, then validates every
+ * instruction, its operands, the LOOP/NEXT nesting and every branch target. Nothing is copied to SRAM.
+ *
+ * @param[out] st_a_mission   Pointer to the instance, left in MSN_U8_IDLE if the mission is valid, or MSN_U8_FAULT.
+ * @param[in]  u16_a_address  EEPROM address of the mission header.
+ * @param[in]  st_a_ops       Pointer to the operations the mission acts through.
+ *
+ * @return EN_MSN_ERROR_T MSN_OK if the mission is valid, MSN_ERROR otherwise ( reason read by MSN_getError ).
+ */
+EN_MSN_ERROR_T MSN_load    ( ST_MSN_t *st_a_mission, u16 u16_a_address, const ST_MSN_ops_t *st_a_ops );
+
+/**
+ * @brief Starts a loaded mission from its first instruction ( also restarts a running, paused or done mission ).
+ *
+ * @param[in] st_a_mission Pointer to the instance.
+ *
+ * @return EN_MSN_ERROR_T MSN_OK if started, MSN_ERROR if the pointer is NULL or no valid mission is loaded.
+ */
+EN_MSN_ERROR_T MSN_start   ( ST_MSN_t *st_a_mission );
+
+/**
+ * @brief Runs one instruction of a running mission, and never blocks: nothing runs while the previous
+ * move, turn or wait is in progress. Meant to be called from a periodic task.
+ *
+ * @param[in] st_a_mission Pointer to the instance.
+ * @param[in] u32_a_timeMs Current time in msec., used by WAIT.
+ *
+ * @return EN_MSN_ERROR_T MSN_OK if stepped ( or nothing to run ), MSN_ERROR if the pointer is NULL.
+ */
+EN_MSN_ERROR_T MSN_step    ( ST_MSN_t *st_a_mission, u32 u32_a_timeMs );
+
+/**
+ * @brief Pauses a running mission: nothing runs until it is resumed. A move or turn in progress is not the mission's
+ * to stop, the caller stops it and may finish it before resuming.
+ *
+ * @param[in] st_a_mission Pointer to the instance.
+ * @param[in] u32_a_timeMs Current time in msec.
+ *
+ * @return EN_MSN_ERROR_T MSN_OK if paused, MSN_ERROR if the pointer is NULL or the mission is not running.
+ */
+EN_MSN_ERROR_T MSN_pause   ( ST_MSN_t *st_a_mission, u32 u32_a_timeMs );
+
+/**
+ * @brief Resumes a paused mission where it stopped: a WAIT in progress only waits for its remaining time.
+ *
+ * @param[in] st_a_mission Pointer to the instance.
+ * @param[in] u32_a_timeMs Current time in msec.
+ *
+ * @return EN_MSN_ERROR_T MSN_OK if resumed, MSN_ERROR if the pointer is NULL or the mission is not paused.
+ */
+EN_MSN_ERROR_T MSN_resume  ( ST_MSN_t *st_a_mission, u32 u32_a_timeMs );
+
+/**
+ * @brief Reads the state of a mission.
+ *
+ * @param[in]  st_a_mission Pointer to the instance.
+ * @param[out] u8_a_state   Pointer to where the state ( MSN_U8_IDLE, RUNNING, DONE, FAULT, PAUSED ) will be stored.
+ *
+ * @return EN_MSN_ERROR_T MSN_OK if read, MSN_ERROR if a pointer is NULL.
+ */
+EN_MSN_ERROR_T MSN_getState( const ST_MSN_t *st_a_mission, u8 *u8_a_state );
+
+/**
+ * @brief Reads why the last loaded mission was rejected.
+ *
+ * @param[in]  st_a_mission Pointer to the instance.
+ * @param[out] u8_a_error   Pointer to where the error ( MSN_U8_ERR_xxx ) will be stored.
+ * @param[out] u16_a_pc     Pointer to where the offset of the faulty instruction will be stored.
+ *
+ * @return EN_MSN_ERROR_T MSN_OK if read, MSN_ERROR if a pointer is NULL.
+ */
+EN_MSN_ERROR_T MSN_getError( const ST_MSN_t *st_a_mission, u8 *u8_a_error, u16 *u16_a_pc );
+
+/* ***********************************************************************************************/
+
+#endif /* MSN_INTERFACE_H_ */
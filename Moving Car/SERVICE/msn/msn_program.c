@@ -0,0 +1,475 @@
+/*
+ * msn_program.c
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Mission Interpreter (MSN) functions' implementation.
+ */
+
+/* SERVICE */
+#include "msn_config.h"
+#include "msn_interface.h"
+
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+/* Block of the top level instructions, outside any loop */
+#define MSN_U16_TOP_BLOCK		0xFFFF
+
+/* Read one mission byte at an instruction offset */
+static u8   MSN_readByte ( const ST_MSN_t *st_a_mission, u16 u16_a_pc );
+
+/* Size in bytes of an instruction, from its first byte */
+static u8   MSN_getSize  ( u8 u8_a_instruction );
+
+/* Check an offset is the start of an instruction, and find the loop body it belongs to */
+static u8   MSN_findBlock( const ST_MSN_t *st_a_mission, u16 u16_a_target, u16 *u16_a_block );
+
+/* Validate every instruction of a mission whose header is valid */
+static u8   MSN_validate ( ST_MSN_t *st_a_mission );
+
+/* ***********************************************************************************************/
+
+/**
+ * @brief Loads a mission stored in EEPROM: checks its header and checksum, then validates every
+ * instruction, its operands, the LOOP/NEXT nesting and every branch target. Nothing is copied to SRAM.
+ *
+ * @param[out] st_a_mission   Pointer to the instance, left in MSN_U8_IDLE if the mission is valid, or MSN_U8_FAULT.
+ * @param[in]  u16_a_address  EEPROM address of the mission header.
+ * @param[in]  st_a_ops       Pointer to the operations the mission acts through.
+ *
+ * @return EN_MSN_ERROR_T MSN_OK if the mission is valid, MSN_ERROR otherwise ( reason read by MSN_getError ).
+ */
+EN_MSN_ERROR_T MSN_load    ( ST_MSN_t *st_a_mission, u16 u16_a_address, const ST_MSN_ops_t *st_a_ops )
+{
+	u8  u8_l_header[MSN_U8_HEADER_SIZE];
+	u8  u8_l_sum;
+	u16 u16_l_pc;
+
+	if ( ( st_a_mission == NULL ) || ( st_a_ops == NULL ) ) return MSN_ERROR;
+
+	st_a_mission->pst_ops      = st_a_ops;
+	st_a_mission->u8_state     = MSN_U8_FAULT;
+	st_a_mission->u8_error     = MSN_U8_ERR_HEADER;
+	st_a_mission->u16_errorPc  = 0;
+	st_a_mission->u16_address  = 0;
+	st_a_mission->u16_length   = 0;
+
+	/* Check 1: Header is readable, then identifies a mission of this version */
+	if ( ( u16_a_address > ( EEP_U16_SIZE - MSN_U8_HEADER_SIZE ) ) ||
+		 ( EEP_readBlock( u16_a_address, u8_l_header, MSN_U8_HEADER_SIZE ) != EEP_OK ) ||
+		 ( u8_l_header[0] != MSN_U8_MAGIC ) || ( u8_l_header[1] != MSN_U8_VERSION ) ) return MSN_ERROR;
+
+	st_a_mission->u16_address = u16_a_address + MSN_U8_HEADER_SIZE;
+	st_a_mission->u16_length  = ( u16 ) u8_l_header[2] | ( ( u16 ) u8_l_header[3] << 8 );
+
+	/* Check 2: Mission is not empty, and fits in the EEPROM */
+	if ( ( st_a_mission->u16_length == 0 ) ||
+		 ( st_a_mission->u16_length > ( EEP_U16_SIZE - st_a_mission->u16_address ) ) ) return MSN_ERROR;
+
+	/* Check 3: Checksum, the sum of all the instruction bytes and the checksum is 0 */
+	u8_l_sum = u8_l_header[4];
+	for ( u16_l_pc = 0; u16_l_pc < st_a_mission->u16_length; u16_l_pc++ )
+	{
+		u8_l_sum += MSN_readByte( st_a_mission, u16_l_pc );
+	}
+
+	if ( u8_l_sum != 0 )
+	{
+		st_a_mission->u8_error = MSN_U8_ERR_CHECKSUM;
+		return MSN_ERROR;
+	}
+
+	/* Check 4: Every instruction is valid */
+	if ( MSN_validate( st_a_mission ) != STD_OK ) return MSN_ERROR;
+
+	st_a_mission->u8_error = MSN_U8_ERR_NONE;
+	st_a_mission->u8_state = MSN_U8_IDLE;
+
+	return MSN_OK;
+}
+
+/**
+ * @brief Starts a loaded mission from its first instruction ( also restarts a running, paused or done mission ).
+ *
+ * @param[in] st_a_mission Pointer to the instance.
+ *
+ * @return EN_MSN_ERROR_T MSN_OK if started, MSN_ERROR if the pointer is NULL or no valid mission is loaded.
+ */
+EN_MSN_ERROR_T MSN_start   ( ST_MSN_t *st_a_mission )
+{
+	if ( ( st_a_mission == NULL ) || ( st_a_mission->u8_state == MSN_U8_FAULT ) ) return MSN_ERROR;
+
+	st_a_mission->u16_pc       = 0;
+	st_a_mission->u8_loopDepth = 0;
+	st_a_mission->u8_waiting   = STD_NOK;
+	st_a_mission->u8_state     = MSN_U8_RUNNING;
+
+	return MSN_OK;
+}
+
+/**
+ * @brief Runs one instruction of a running mission, and never blocks: nothing runs while the previous
+ * move, turn or wait is in progress. Meant to be called from a periodic task.
+ *
+ * @param[in] st_a_mission Pointer to the instance.
+ * @param[in] u32_a_timeMs Current time in msec., used by WAIT.
+ *
+ * @return EN_MSN_ERROR_T MSN_OK if stepped ( or nothing to run ), MSN_ERROR if the pointer is NULL.
+ */
+EN_MSN_ERROR_T MSN_step    ( ST_MSN_t *st_a_mission, u32 u32_a_timeMs )
+{
+	const ST_MSN_ops_t *st_l_ops;
+	u16 u16_l_pc;
+	u8  u8_l_instruction;
+	u8  u8_l_operand;
+	u8  u8_l_loop;
+	u8  u8_l_sensorSet;
+
+	if ( st_a_mission == NULL ) return MSN_ERROR;
+
+	/* Check 1: Mission is running */
+	if ( st_a_mission->u8_state != MSN_U8_RUNNING ) return MSN_OK;
+
+	/* Check 2: Previous WAIT is over ( wrap-safe time comparison ) */
+	if ( st_a_mission->u8_waiting == STD_OK )
+	{
+		if ( ( i32 ) ( u32_a_timeMs - st_a_mission->u32_waitDeadline ) < 0 ) return MSN_OK;
+
+		st_a_mission->u8_waiting = STD_NOK;
+	}
+
+	st_l_ops = st_a_mission->pst_ops;
+
+	/* Check 3: Previous move or turn is over */
+	if ( st_l_ops->pf_isBusy() == STD_OK ) return MSN_OK;
+
+	/* Step 1: Fetch, the mission was validated, so every operand byte exists */
+	u16_l_pc         = st_a_mission->u16_pc;
+	u8_l_instruction = MSN_readByte( st_a_mission, u16_l_pc );
+	u8_l_operand     = u8_l_instruction & MSN_U8_OPERAND_MASK;
+
+	/* Step 2: Execute */
+	switch ( u8_l_instruction & MSN_U8_OPCODE_MASK )
+	{
+		case MSN_U8_OP_END:
+			st_a_mission->u8_state = MSN_U8_DONE;
+			break;
+
+		case MSN_U8_OP_MOVE:
+			st_l_ops->pf_move( u8_l_operand * 10, ( u16 ) MSN_readByte( st_a_mission, u16_l_pc + 1 ) * MSN_U8_MOVE_TIME_UNIT );
+			st_a_mission->u16_pc = u16_l_pc + 2;
+			break;
+
+		case MSN_U8_OP_TURN:
+			st_l_ops->pf_turn( u8_l_operand );
+			st_a_mission->u16_pc = u16_l_pc + 1;
+			break;
+
+		case MSN_U8_OP_WAIT:
+			/* Check 2.1: Long form, the time is in the operand byte */
+			if ( u8_l_operand == 0 )
+			{
+				u8_l_operand = MSN_readByte( st_a_mission, u16_l_pc + 1 );
+				u16_l_pc++;
+			}
+			st_a_mission->u32_waitDeadline = u32_a_timeMs + ( ( u16 ) u8_l_operand * MSN_U8_WAIT_TIME_UNIT );
+			st_a_mission->u8_waiting       = STD_OK;
+			st_a_mission->u16_pc           = u16_l_pc + 1;
+			break;
+
+		case MSN_U8_OP_LED:
+			st_l_ops->pf_setLeds( u8_l_operand );
+			st_a_mission->u16_pc = u16_l_pc + 1;
+			break;
+
+		case MSN_U8_OP_LOOP:
+			u8_l_loop = st_a_mission->u8_loopDepth++;
+			st_a_mission->u16_loopPc[u8_l_loop]   = u16_l_pc + 1;
+			st_a_mission->u8_loopCount[u8_l_loop] = u8_l_operand;
+			st_a_mission->u16_pc = u16_l_pc + 1;
+			break;
+
+		case MSN_U8_OP_NEXT:
+			u8_l_loop = st_a_mission->u8_loopDepth - 1;
+
+			/* Check 2.2: Loop runs forever, or has runs left, then run its body again */
+			if ( ( st_a_mission->u8_loopCount[u8_l_loop] == 0 ) || ( --st_a_mission->u8_loopCount[u8_l_loop] != 0 ) )
+			{
+				st_a_mission->u16_pc = st_a_mission->u16_loopPc[u8_l_loop];
+			}
+			else
+			{
+				st_a_mission->u8_loopDepth--;
+				st_a_mission->u16_pc = u16_l_pc + 1;
+			}
+			break;
+
+		case MSN_U8_OP_BR:
+			/* Step 2.1: Read the sensor, sensor 15 is always set */
+			if ( ( u8_l_operand & MSN_U8_BR_SENSOR_MASK ) == MSN_U8_BR_ALWAYS )
+			{
+				u8_l_sensorSet = STD_OK;
+			}
+			else
+			{
+				u8_l_sensorSet = st_l_ops->pf_readSensor( u8_l_operand & MSN_U8_BR_SENSOR_MASK );
+			}
+
+			if ( GET_BIT( u8_l_operand, MSN_U8_BR_NEGATE_BIT ) == 1 ) u8_l_sensorSet = ( u8_l_sensorSet == STD_OK ) ? STD_NOK : STD_OK;
+
+			/* Step 2.2: Branch, the offset is counted from the next instruction */
+			st_a_mission->u16_pc = u16_l_pc + 2;
+			if ( u8_l_sensorSet == STD_OK )
+			{
+				st_a_mission->u16_pc += ( i8 ) MSN_readByte( st_a_mission, u16_l_pc + 1 );
+			}
+			break;
+
+		default:
+			break;
+	}
+
+	return MSN_OK;
+}
+
+/**
+ * @brief Pauses a running mission: nothing runs until it is resumed. A move or turn in progress is not the mission's
+ * to stop, the caller stops it and may finish it before resuming.
+ *
+ * @param[in] st_a_mission Pointer to the instance.
+ * @param[in] u32_a_timeMs Current time in msec.
+ *
+ * @return EN_MSN_ERROR_T MSN_OK if paused, MSN_ERROR if the pointer is NULL or the mission is not running.
+ */
+EN_MSN_ERROR_T MSN_pause   ( ST_MSN_t *st_a_mission, u32 u32_a_timeMs )
+{
+	if ( ( st_a_mission == NULL ) || ( st_a_mission->u8_state != MSN_U8_RUNNING ) ) return MSN_ERROR;
+
+	st_a_mission->u32_pauseTime = u32_a_timeMs;
+	st_a_mission->u8_state      = MSN_U8_PAUSED;
+
+	return MSN_OK;
+}
+
+/**
+ * @brief Resumes a paused mission where it stopped: a WAIT in progress only waits for its remaining time.
+ *
+ * @param[in] st_a_mission Pointer to the instance.
+ * @param[in] u32_a_timeMs Current time in msec.
+ *
+ * @return EN_MSN_ERROR_T MSN_OK if resumed, MSN_ERROR if the pointer is NULL or the mission is not paused.
+ */
+EN_MSN_ERROR_T MSN_resume  ( ST_MSN_t *st_a_mission, u32 u32_a_timeMs )
+{
+	if ( ( st_a_mission == NULL ) || ( st_a_mission->u8_state != MSN_U8_PAUSED ) ) return MSN_ERROR;
+
+	/* Check 1: WAIT in progress, then its deadline moves by the pause duration */
+	if ( st_a_mission->u8_waiting == STD_OK ) st_a_mission->u32_waitDeadline += u32_a_timeMs - st_a_mission->u32_pauseTime;
+
+	st_a_mission->u8_state = MSN_U8_RUNNING;
+
+	return MSN_OK;
+}
+
+/**
+ * @brief Reads the state of a mission.
+ *
+ * @param[in]  st_a_mission Pointer to the instance.
+ * @param[out] u8_a_state   Pointer to where the state ( MSN_U8_IDLE, RUNNING, DONE, FAULT, PAUSED ) will be stored.
+ *
+ * @return EN_MSN_ERROR_T MSN_OK if read, MSN_ERROR if a pointer is NULL.
+ */
+EN_MSN_ERROR_T MSN_getState( const ST_MSN_t *st_a_mission, u8 *u8_a_state )
+{
+	if ( ( st_a_mission == NULL ) || ( u8_a_state == NULL ) ) return MSN_ERROR;
+
+	*u8_a_state = st_a_mission->u8_state;
+
+	return MSN_OK;
+}
+
+/**
+ * @brief Reads why the last loaded mission was rejected.
+ *
+ * @param[in]  st_a_mission Pointer to the instance.
+ * @param[out] u8_a_error   Pointer to where the error ( MSN_U8_ERR_xxx ) will be stored.
+ * @param[out] u16_a_pc     Pointer to where the offset of the faulty instruction will be stored.
+ *
+ * @return EN_MSN_ERROR_T MSN_OK if read, MSN_ERROR if a pointer is NULL.
+ */
+EN_MSN_ERROR_T MSN_getError( const ST_MSN_t *st_a_mission, u8 *u8_a_error, u16 *u16_a_pc )
+{
+	if ( ( st_a_mission == NULL ) || ( u8_a_error == NULL ) || ( u16_a_pc == NULL ) ) return MSN_ERROR;
+
+	*u8_a_error = st_a_mission->u8_error;
+	*u16_a_pc   = st_a_mission->u16_errorPc;
+
+	return MSN_OK;
+}
+
+/* ***********************************************************************************************/
+
+/* Read one mission byte at an instruction offset */
+static u8   MSN_readByte ( const ST_MSN_t *st_a_mission, u16 u16_a_pc )
+{
+	u8 u8_l_byte = 0;
+
+	EEP_readByte( st_a_mission->u16_address + u16_a_pc, &u8_l_byte );
+
+	return u8_l_byte;
+}
+
+/* Size in bytes of an instruction, from its first byte */
+static u8   MSN_getSize  ( u8 u8_a_instruction )
+{
+	switch ( u8_a_instruction & MSN_U8_OPCODE_MASK )
+	{
+		case MSN_U8_OP_MOVE:
+		case MSN_U8_OP_BR  : return 2;
+		case MSN_U8_OP_WAIT: return ( ( u8_a_instruction & MSN_U8_OPERAND_MASK ) == 0 ) ? 2 : 1;
+		default            : return 1;
+	}
+}
+
+/* Check an offset is the start of an instruction, and find the loop body it belongs to */
+static u8   MSN_findBlock( const ST_MSN_t *st_a_mission, u16 u16_a_target, u16 *u16_a_block )
+{
+	u16 u16_l_loopPc[MSN_U8_LOOP_DEPTH];
+	u16 u16_l_pc    = 0;
+	u8  u8_l_depth  = 0;
+	u8  u8_l_instruction;
+
+	/* Walk the instructions from the start, tracking the open loops ( malformed nesting is reported by the validator ) */
+	while ( u16_l_pc < u16_a_target )
+	{
+		u8_l_instruction = MSN_readByte( st_a_mission, u16_l_pc );
+
+		if ( ( ( u8_l_instruction & MSN_U8_OPCODE_MASK ) == MSN_U8_OP_LOOP ) && ( u8_l_depth < MSN_U8_LOOP_DEPTH ) )
+		{
+			u16_l_loopPc[u8_l_depth++] = u16_l_pc + 1;
+		}
+		else if ( ( ( u8_l_instruction & MSN_U8_OPCODE_MASK ) == MSN_U8_OP_NEXT ) && ( u8_l_depth > 0 ) )
+		{
+			u8_l_depth--;
+		}
+
+		u16_l_pc += MSN_getSize( u8_l_instruction );
+	}
+
+	*u16_a_block = ( u8_l_depth == 0 ) ? MSN_U16_TOP_BLOCK : u16_l_loopPc[u8_l_depth - 1];
+
+	return ( u16_l_pc == u16_a_target ) ? STD_OK : STD_NOK;
+}
+
+/* Validate every instruction of a mission whose header is valid */
+static u8   MSN_validate ( ST_MSN_t *st_a_mission )
+{
+	u16 u16_l_loopPc[MSN_U8_LOOP_DEPTH];
+	u16 u16_l_pc     = 0;
+	u16 u16_l_lastPc = 0;
+	u16 u16_l_block;
+	i16 i16_l_target;
+	u8  u8_l_depth   = 0;
+	u8  u8_l_instruction;
+	u8  u8_l_operand;
+	u8  u8_l_size;
+	u8  u8_l_error;
+
+	while ( u16_l_pc < st_a_mission->u16_length )
+	{
+		u8_l_instruction = MSN_readByte( st_a_mission, u16_l_pc );
+		u8_l_operand     = u8_l_instruction & MSN_U8_OPERAND_MASK;
+		u8_l_size        = MSN_getSize( u8_l_instruction );
+		u8_l_error       = MSN_U8_ERR_NONE;
+
+		/* Check 1: Operand byte is inside the mission */
+		if ( ( u16 ) ( u16_l_pc + u8_l_size ) > st_a_mission->u16_length )
+		{
+			u8_l_error = MSN_U8_ERR_TRUNCATED;
+		}
+		else
+		{
+			/* Check 2: Operands are in range, and blocks are well nested */
+			switch ( u8_l_instruction & MSN_U8_OPCODE_MASK )
+			{
+				case MSN_U8_OP_END:
+					if ( u8_l_operand != 0 ) u8_l_error = MSN_U8_ERR_OPERAND;
+					break;
+
+				case MSN_U8_OP_NEXT:
+					if ( u8_l_operand != 0 ) u8_l_error = MSN_U8_ERR_OPERAND;
+					else if ( u8_l_depth == 0 ) u8_l_error = MSN_U8_ERR_NESTING;
+					else u8_l_depth--;
+					break;
+
+				case MSN_U8_OP_MOVE:
+					if ( ( u8_l_operand == 0 ) || ( u8_l_operand > MSN_U8_MOVE_MAX_SPEED ) ||
+						 ( MSN_readByte( st_a_mission, u16_l_pc + 1 ) == 0 ) ) u8_l_error = MSN_U8_ERR_OPERAND;
+					break;
+
+				case MSN_U8_OP_TURN:
+					if ( u8_l_operand == 0 ) u8_l_error = MSN_U8_ERR_OPERAND;
+					break;
+
+				case MSN_U8_OP_WAIT:
+					if ( ( u8_l_operand == 0 ) && ( MSN_readByte( st_a_mission, u16_l_pc + 1 ) == 0 ) ) u8_l_error = MSN_U8_ERR_OPERAND;
+					break;
+
+				case MSN_U8_OP_LED:
+					if ( u8_l_operand > MSN_U8_LED_MAX_MASK ) u8_l_error = MSN_U8_ERR_OPERAND;
+					break;
+
+				case MSN_U8_OP_LOOP:
+					if ( u8_l_depth == MSN_U8_LOOP_DEPTH ) u8_l_error = MSN_U8_ERR_NESTING;
+					else u16_l_loopPc[u8_l_depth++] = u16_l_pc + 1;
+					break;
+
+				case MSN_U8_OP_BR:
+					/* Check 2.1: Target is an instruction of the same block, so the loops stay balanced */
+					i16_l_target = ( i16 ) ( u16_l_pc + 2 ) + ( i8 ) MSN_readByte( st_a_mission, u16_l_pc + 1 );
+
+					if ( ( i16_l_target < 0 ) || ( ( u16 ) i16_l_target >= st_a_mission->u16_length ) ||
+						 ( MSN_findBlock( st_a_mission, ( u16 ) i16_l_target, &u16_l_block ) != STD_OK ) ||
+						 ( u16_l_block != ( ( u8_l_depth == 0 ) ? MSN_U16_TOP_BLOCK : u16_l_loopPc[u8_l_depth - 1] ) ) )
+					{
+						u8_l_error = MSN_U8_ERR_BRANCH;
+					}
+					break;
+
+				default:
+					break;
+			}
+		}
+
+		if ( u8_l_error != MSN_U8_ERR_NONE )
+		{
+			st_a_mission->u8_error    = u8_l_error;
+			st_a_mission->u16_errorPc = u16_l_pc;
+			return STD_NOK;
+		}
+
+		u16_l_lastPc = u16_l_pc;
+		u16_l_pc    += u8_l_size;
+	}
+
+	/* Check 3: Every LOOP is closed */
+	if ( u8_l_depth != 0 )
+	{
+		st_a_mission->u8_error    = MSN_U8_ERR_NESTING;
+		st_a_mission->u16_errorPc = u16_l_loopPc[u8_l_depth - 1] - 1;
+		return STD_NOK;
+	}
+
+	/* Check 4: Mission cannot run past its last instruction */
+	if ( MSN_readByte( st_a_mission, u16_l_lastPc ) != MSN_U8_OP_END )
+	{
+		st_a_mission->u8_error    = MSN_U8_ERR_NO_END;
+		st_a_mission->u16_errorPc = u16_l_lastPc;
+		return STD_NOK;
+	}
+
+	return STD_OK;
+}
+
+/* ***********************************************************************************************/
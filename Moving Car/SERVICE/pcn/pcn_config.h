@@ -0,0 +1,22 @@
+/*
+ * pcn_config.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Pin Change Notification (PCN) pre-build configurations, through which user can configure before using the PCN service.
+ */
+
+#ifndef PCN_CONFIG_H_
+#define PCN_CONFIG_H_
+
+/* ***********************************************************************************************/
+/* PCN Configurations */
+
+/* Maximum number of subscribers, each one watches any set of the 32 pins ( 1 -> 8 ) */
+#define PCN_U8_MAX_SUBSCRIBERS			4
+
+/* End of Configurations */
+
+/* ***********************************************************************************************/
+
+#endif /* PCN_CONFIG_H_ */
@@ -0,0 +1,79 @@
+/*
+ * pcn_interface.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Pin Change Notification (PCN) functions' prototypes and definitions (Macros) to avoid magic numbers.
+ *               PCN gives every pin a change notification, where the ATmega32 has only INT0, INT1 and INT2:
+ *               PCN_task snapshots PINA to PIND into one 32-bit word ( bit 8 * port + pin ), XORs it with the previous
+ *               snapshot, and masks the result with the union of the subscribed pins. Nothing changed costs the same
+ *               few word operations whatever the number of watched pins; otherwise each subscriber whose pins changed
+ *               is called once with its changed pins and their levels, as words too.
+ *               Changes are seen at the PCN_task period: a pulse shorter than the period can be missed.
+ *               All functions are for the main loop ( scheduler tasks ) only.
+ */
+
+#ifndef PCN_INTERFACE_H_
+#define PCN_INTERFACE_H_
+
+/* ***********************************************************************************************/
+/* PCN Includes */
+
+/* LIB */
+#include "../../LIB/std.h"
+#include "../../LIB/bit_math.h"
+
+/* MCAL */
+#include "../../MCAL/dio/dio_interface.h"
+
+/* SERVICE */
+#include "pcn_config.h"
+
+/* ***********************************************************************************************/
+/* PCN Macros */
+
+#if ( ( PCN_U8_MAX_SUBSCRIBERS < 1 ) || ( PCN_U8_MAX_SUBSCRIBERS > 8 ) )
+#error "PCN_U8_MAX_SUBSCRIBERS must be from 1 to 8"
+#endif
+
+/* Pins word bit of a pin descriptor ( MCAL/dio/dio_interface.h ), e.g. PCN_U32_PIN_MASK( DIO_PIN( B, 4 ) ) */
+#define PCN_U32_PIN_MASK( DESCRIPTOR )		PCN_U32_PIN_MASK_( DESCRIPTOR )
+#define PCN_U32_PIN_MASK_( PORT, PIN )		( ( u32 ) 1 << ( ( DIO_PIN_PORT_( PORT, PIN ) * 8 ) + DIO_PIN_NUMBER_( PORT, PIN ) ) )
+
+/* Pins word bits of a whole port ( PORT_A, PORT_B, PORT_C or PORT_D ) */
+#define PCN_U32_PORT_MASK( PORT )			( ( u32 ) 0xFF << ( ( PORT ) * 8 ) )
+
+typedef enum {
+	PCN_OK,
+	PCN_ERROR
+}EN_PCN_ERROR_T;
+
+/* ***********************************************************************************************/
+/* PCN Functions' Prototypes */
+
+/**
+ * @brief Initializes the engine with no subscriber, the current pins levels are the first snapshot.
+ */
+void           PCN_init     ( void );
+
+/**
+ * @brief Subscribes a function to the changes of a set of pins.
+ * The current pins levels are taken as the snapshot of the new pins, so a subscription does not report them as changed.
+ *
+ * @param[in] u32_a_pinsMask      Pins to watch ( PCN_U32_PIN_MASK, PCN_U32_PORT_MASK ), not 0.
+ * @param[in] pf_a_changeAction   Function called with the changed pins of the set, and the levels of the pins of the set
+ *                                ( bit set: high ), once per PCN_task call that saw any of them change.
+ *
+ * @return EN_PCN_ERROR_T PCN_OK if subscribed, PCN_ERROR if the mask is 0, the pointer is NULL, or the table is full.
+ */
+EN_PCN_ERROR_T PCN_subscribe( u32 u32_a_pinsMask, void ( *pf_a_changeAction ) ( u32 u32_a_changedPins, u32 u32_a_pinsLevels ) );
+
+/**
+ * @brief Snapshots all ports, and calls the subscribers whose pins changed since the last call.
+ * Call it periodically, e.g. from a scheduler task.
+ */
+void           PCN_task     ( void );
+
+/* ***********************************************************************************************/
+
+#endif /* PCN_INTERFACE_H_ */
@@ -0,0 +1,119 @@
+/*
+ * pcn_program.c
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Pin Change Notification (PCN) functions' implementation.
+ */
+
+/* SERVICE */
+#include "pcn_config.h"
+#include "pcn_interface.h"
+
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+/* Subscribers: watched pins and change action */
+typedef struct {
+	u32  u32_pinsMask;
+	void ( *pf_changeAction ) ( u32 u32_a_changedPins, u32 u32_a_pinsLevels );
+}ST_PCN_subscriber_t;
+
+static ST_PCN_subscriber_t st_gs_pcnSubscribers[PCN_U8_MAX_SUBSCRIBERS];
+static u8 u8_gs_pcnSubscribersNumber = 0;
+
+/* Union of all the watched pins, and the last snapshot */
+static u32 u32_gs_pcnWatchedPins = 0;
+static u32 u32_gs_pcnSnapshot = 0;
+
+/* PCN private functions */
+static u32 PCN_snapshot( void );
+
+/* ***********************************************************************************************/
+
+/**
+ * @brief Initializes the engine with no subscriber, the current pins levels are the first snapshot.
+ */
+void           PCN_init     ( void )
+{
+	u8_gs_pcnSubscribersNumber = 0;
+	u32_gs_pcnWatchedPins      = 0;
+	u32_gs_pcnSnapshot         = PCN_snapshot();
+}
+
+/**
+ * @brief Subscribes a function to the changes of a set of pins.
+ * The current pins levels are taken as the snapshot of the new pins, so a subscription does not report them as changed.
+ *
+ * @param[in] u32_a_pinsMask      Pins to watch ( PCN_U32_PIN_MASK, PCN_U32_PORT_MASK ), not 0.
+ * @param[in] pf_a_changeAction   Function called with the changed pins of the set, and the levels of the pins of the set
+ *                                ( bit set: high ), once per PCN_task call that saw any of them change.
+ *
+ * @return EN_PCN_ERROR_T PCN_OK if subscribed, PCN_ERROR if the mask is 0, the pointer is NULL, or the table is full.
+ */
+EN_PCN_ERROR_T PCN_subscribe( u32 u32_a_pinsMask, void ( *pf_a_changeAction ) ( u32 u32_a_changedPins, u32 u32_a_pinsLevels ) )
+{
+	/* Check 1: Mask, pointer, and room are valid */
+	if ( ( u32_a_pinsMask == 0 ) || ( pf_a_changeAction == NULL ) || ( u8_gs_pcnSubscribersNumber >= PCN_U8_MAX_SUBSCRIBERS ) ) return PCN_ERROR;
+
+	st_gs_pcnSubscribers[u8_gs_pcnSubscribersNumber].u32_pinsMask    = u32_a_pinsMask;
+	st_gs_pcnSubscribers[u8_gs_pcnSubscribersNumber].pf_changeAction = pf_a_changeAction;
+	u8_gs_pcnSubscribersNumber++;
+
+	/* Step 1: New pins start from their current levels */
+	u32_gs_pcnSnapshot = ( u32_gs_pcnSnapshot & ~u32_a_pinsMask ) | ( PCN_snapshot() & u32_a_pinsMask );
+	u32_gs_pcnWatchedPins |= u32_a_pinsMask;
+
+	return PCN_OK;
+}
+
+/**
+ * @brief Snapshots all ports, and calls the subscribers whose pins changed since the last call.
+ * Call it periodically, e.g. from a scheduler task.
+ */
+void           PCN_task     ( void )
+{
+	u32 u32_l_snapshot = PCN_snapshot();
+	u32 u32_l_changedPins;
+	u8  u8_l_subscriber;
+
+	/* Step 1: Watched pins that changed, one XOR and one AND over the 32 pins */
+	u32_l_changedPins  = ( u32_l_snapshot ^ u32_gs_pcnSnapshot ) & u32_gs_pcnWatchedPins;
+	u32_gs_pcnSnapshot = u32_l_snapshot;
+
+	/* Check 1: Nothing changed, the usual case */
+	if ( u32_l_changedPins == 0 ) return;
+
+	/* Step 2: Notify the subscribers of the changed pins only */
+	for ( u8_l_subscriber = 0; u8_l_subscriber < u8_gs_pcnSubscribersNumber; u8_l_subscriber++ )
+	{
+		u32 u32_l_pinsMask = st_gs_pcnSubscribers[u8_l_subscriber].u32_pinsMask;
+
+		if ( ( u32_l_changedPins & u32_l_pinsMask ) != 0 )
+		{
+			st_gs_pcnSubscribers[u8_l_subscriber].pf_changeAction( u32_l_changedPins & u32_l_pinsMask, u32_l_snapshot & u32_l_pinsMask );
+		}
+	}
+}
+
+/* ***********************************************************************************************/
+/* PCN Private Functions */
+
+/**
+ * @brief Reads PINA to PIND, one byte of the word each.
+ *
+ * @return u32 Pins levels, bit ( 8 * port + pin ).
+ */
+static u32 PCN_snapshot( void )
+{
+	u8 u8_l_portA = 0, u8_l_portB = 0, u8_l_portC = 0, u8_l_portD = 0;
+
+	DIO_portRead( PORT_A, &u8_l_portA );
+	DIO_portRead( PORT_B, &u8_l_portB );
+	DIO_portRead( PORT_C, &u8_l_portC );
+	DIO_portRead( PORT_D, &u8_l_portD );
+
+	return ( ( u32 ) u8_l_portD << 24 ) | ( ( u32 ) u8_l_portC << 16 ) | ( ( u16 ) u8_l_portB << 8 ) | u8_l_portA;
+}
+
+/* ***********************************************************************************************/
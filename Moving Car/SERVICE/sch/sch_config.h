@@ -0,0 +1,43 @@
+/*
+ * sch_config.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Scheduler (SCH) pre-build configurations, through which user can configure before using the SCH service.
+ */
+
+#ifndef SCH_CONFIG_H_
+#define SCH_CONFIG_H_
+
+/* ***********************************************************************************************/
+/* SCH Configurations */
+
+/* Maximum number of tasks, ready bits are kept in one byte ( 1 -> 8 ) */
+#define SCH_U8_MAX_TASKS				8
+
+/* System tick source: Timer1 CTC mode, F_CPU = 8 MHz */
+/* Timer1 prescaler, 8 MHz / 8 = 1 timer count per usec. */
+#define SCH_U16_TICK_PRESCALER			8
+/* Timer1 counts per tick - 1, ( 999 + 1 ) usec. = 1 msec. tick */
+#define SCH_U16_TICK_COMPARE_VALUE		999
+/* Timer1 counts per tick, also the number of usec. per tick */
+#define SCH_U16_US_PER_TICK				( SCH_U16_TICK_COMPARE_VALUE + 1 )
+
+/* Idle: sleep in the deepest mode compatible with the enabled wake-up sources when no task is ready ( STD_OK ),
+ * or keep polling the ready tasks ( STD_NOK ) */
+#define SCH_U8_IDLE_SLEEP				STD_OK
+
+/* Tickless idle: before sleeping, the tick period is stretched up to the next task release, so the MCU
+ * is not woken up every tick for nothing ( STD_OK ), or the tick keeps its period ( STD_NOK ).
+ * Only used with SCH_U8_IDLE_SLEEP */
+#define SCH_U8_TICKLESS_IDLE			STD_OK
+/* Longest stretched period in ticks, ( 65 * 1000 ) - 1 timer counts still fit in the 16-bit compare value */
+#define SCH_U16_MAX_IDLE_TICKS			65
+/* Timer counts kept between the counter and a new compare value, so a match is never missed while writing it */
+#define SCH_U16_TICKLESS_GUARD_COUNTS	50
+
+/* End of Configurations */
+
+/* ***********************************************************************************************/
+
+#endif /* SCH_CONFIG_H_ */
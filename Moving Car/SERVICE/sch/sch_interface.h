@@ -0,0 +1,130 @@
+/*
+ * sch_interface.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Scheduler (SCH) functions' prototypes and definitions (Macros) to avoid magic numbers.
+ *               SCH is a cooperative run-to-completion scheduler: tasks are released by the system tick, and the
+ *               ready task with the highest priority ( lowest index in the tasks table ) is dispatched first.
+ */
+
+#ifndef SCH_INTERFACE_H_
+#define SCH_INTERFACE_H_
+
+/* ***********************************************************************************************/
+/* SCH Includes */
+
+/* LIB */
+#include "../../LIB/std.h"
+#include "../../LIB/bit_math.h"
+
+/* MCAL */
+#include "../../MCAL/gli/gli_interface.h"
+#include "../../MCAL/timer/timer_interface.h"
+#include "../../MCAL/slp/slp_interface.h"
+
+/* ***********************************************************************************************/
+/* SCH Macros */
+
+/**
+ * @brief Statically declared task, the index of the task in its table is its priority ( 0 is the highest ).
+ * A task must run to completion, it must never block.
+ */
+typedef struct {
+	void ( *pf_task ) ( void );		/* Task body */
+	u16  u16_period;				/* Release period in ticks ( 1 or more ) */
+	u16  u16_offset;				/* Ticks before the first release, used to spread tasks over the ticks */
+}ST_SCH_task_t;
+
+typedef enum {
+	SCH_OK,
+	SCH_ERROR
+}EN_SCH_ERROR_T;
+
+/* ***********************************************************************************************/
+/* SCH Functions' Prototypes */
+
+/**
+ * @brief Initializes the scheduler with a constant tasks table, and prepares the system tick timer.
+ *
+ * @param[in] st_a_tasks       Pointer to the tasks table, sorted by priority ( index 0 is the highest ).
+ * @param[in] u8_a_tasksNumber Number of tasks in the table ( 1 to SCH_U8_MAX_TASKS ).
+ *
+ * @return EN_SCH_ERROR_T SCH_OK if the table is valid, SCH_ERROR otherwise.
+ */
+EN_SCH_ERROR_T SCH_init       ( const ST_SCH_task_t *st_a_tasks, u8 u8_a_tasksNumber );
+
+/**
+ * @brief Starts the system tick, and dispatches the ready tasks forever in priority order.
+ * After each task, dispatching restarts from the highest priority task.
+ * When no task is ready, the MCU sleeps until the next interrupt ( SCH_U8_IDLE_SLEEP ), and with
+ * SCH_U8_TICKLESS_IDLE the tick is skipped until the next task release.
+ * The execution time of every task run is measured, and the worst case is kept per task.
+ *
+ * @return This function never returns.
+ */
+void           SCH_start      ( void );
+
+/**
+ * @brief Reads the number of system ticks ( msec. ) since the scheduler was started.
+ *
+ * @param[out] u32_a_ticks Pointer to where the ticks will be stored.
+ *
+ * @return EN_SCH_ERROR_T SCH_OK if the ticks were read, SCH_ERROR if the pointer is NULL.
+ */
+EN_SCH_ERROR_T SCH_getTicks   ( u32 *u32_a_ticks );
+
+/**
+ * @brief Reads the measured worst-case execution time of a task.
+ *
+ * @param[in]  u8_a_taskId  Index of the task in the tasks table.
+ * @param[out] u16_a_wcetUs Pointer to where the worst-case execution time ( usec. ) will be stored.
+ *
+ * @return EN_SCH_ERROR_T SCH_OK if the time was read, SCH_ERROR if the task does not exist or the pointer is NULL.
+ */
+EN_SCH_ERROR_T SCH_getTaskWcet( u8 u8_a_taskId, u16 *u16_a_wcetUs );
+
+/**
+ * @brief Reads the time spent awake and asleep, and the number of idle wake-ups, since the scheduler was started.
+ * Sleep time is measured around each idle sleep with the tick timer counts ( 1 usec. resolution ).
+ *
+ * @param[out] u32_a_awakeMs Pointer to where the awake time ( msec. ) will be stored.
+ * @param[out] u32_a_sleepMs Pointer to where the sleep time ( msec. ) will be stored.
+ * @param[out] u32_a_wakeups Pointer to where the number of idle wake-ups will be stored.
+ *
+ * @return EN_SCH_ERROR_T SCH_OK if the stats were read, SCH_ERROR if a pointer is NULL.
+ */
+EN_SCH_ERROR_T SCH_getIdleStats( u32 *u32_a_awakeMs, u32 *u32_a_sleepMs, u32 *u32_a_wakeups );
+
+/**
+ * @brief Suspends a task: it is not released anymore until it is resumed. Tasks only.
+ * A suspended task does not limit the tickless idle period.
+ *
+ * @param[in] u8_a_taskId Index of the task in the tasks table.
+ *
+ * @return EN_SCH_ERROR_T SCH_OK if suspended, SCH_ERROR if the task does not exist.
+ */
+EN_SCH_ERROR_T SCH_suspendTask ( u8 u8_a_taskId );
+
+/**
+ * @brief Resumes a suspended task, it is released on the next tick, then every period. Tasks only.
+ *
+ * @param[in] u8_a_taskId Index of the task in the tasks table.
+ *
+ * @return EN_SCH_ERROR_T SCH_OK if resumed ( or was not suspended ), SCH_ERROR if the task does not exist.
+ */
+EN_SCH_ERROR_T SCH_resumeTask  ( u8 u8_a_taskId );
+
+/**
+ * @brief Reads whether a task is suspended.
+ *
+ * @param[in]  u8_a_taskId    Index of the task in the tasks table.
+ * @param[out] u8_a_suspended Pointer to where STD_OK ( suspended ) or STD_NOK will be stored.
+ *
+ * @return EN_SCH_ERROR_T SCH_OK if read, SCH_ERROR if the task does not exist or the pointer is NULL.
+ */
+EN_SCH_ERROR_T SCH_isTaskSuspended( u8 u8_a_taskId, u8 *u8_a_suspended );
+
+/* ***********************************************************************************************/
+
+#endif /* SCH_INTERFACE_H_ */
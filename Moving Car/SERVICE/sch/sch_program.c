@@ -0,0 +1,440 @@
+/*
+ * sch_program.c
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Scheduler (SCH) functions' implementation.
+ */
+
+/* SERVICE */
+#include "sch_config.h"
+#include "sch_interface.h"
+
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+/* Tasks table, owned by the caller of SCH_init */
+static const ST_SCH_task_t *st_gs_schTasks = NULL;
+static u8 u8_gs_schTasksNumber = 0;
+
+/* Ticks left before each task's next release, updated from the tick ISR */
+static volatile u16 u16_gs_schCountdown[SCH_U8_MAX_TASKS];
+
+/* One ready bit per task, bit number = task index = priority */
+static volatile u8 u8_gs_schReadyBits = 0;
+
+/* One suspended bit per task, suspended tasks are not released */
+static volatile u8 u8_gs_schSuspendedBits = 0;
+
+/* System ticks since the scheduler was started */
+static volatile u32 u32_gs_schTicks = 0;
+
+/* Ticks spanned by the current timer period: 1, or more while a tickless idle stretches it */
+static volatile u16 u16_gs_schPeriodTicks = 1;
+
+/* Measured worst-case execution time of each task in usec. */
+static u16 u16_gs_schWcet[SCH_U8_MAX_TASKS];
+
+/* Time spent in idle sleep: whole msec., and the remaining usec., and the number of idle wake-ups */
+static u32 u32_gs_schSleepMs = 0;
+static u16 u16_gs_schSleepUs = 0;
+static u32 u32_gs_schWakeups = 0;
+
+/* ISR Callback function for the system tick */
+static void SCH_tick        ( void );
+
+/* Sleep until the next interrupt if no task got ready, and account the sleep time */
+static void SCH_idle        ( void );
+
+/* Current time in usec. ( ticks and timer counts ), used for execution time measurement */
+static u32  SCH_getTimestamp( void );
+
+/* Stretch the tick period up to the next task release, interrupts disabled */
+static void SCH_startTickless( void );
+
+/* Woken up before the stretched period ended, shorten it to the next tick boundary, interrupts disabled */
+static void SCH_stopTickless ( void );
+
+/* ***********************************************************************************************/
+
+/**
+ * @brief Initializes the scheduler with a constant tasks table, and prepares the system tick timer.
+ *
+ * @param[in] st_a_tasks       Pointer to the tasks table, sorted by priority ( index 0 is the highest ).
+ * @param[in] u8_a_tasksNumber Number of tasks in the table ( 1 to SCH_U8_MAX_TASKS ).
+ *
+ * @return EN_SCH_ERROR_T SCH_OK if the table is valid, SCH_ERROR otherwise.
+ */
+EN_SCH_ERROR_T SCH_init       ( const ST_SCH_task_t *st_a_tasks, u8 u8_a_tasksNumber )
+{
+	u8 u8_l_taskId;
+
+	/* Check 1: Table exists, and its size is in the valid range */
+	if ( ( st_a_tasks == NULL ) || ( u8_a_tasksNumber == 0 ) || ( u8_a_tasksNumber > SCH_U8_MAX_TASKS ) ) return SCH_ERROR;
+
+	/* Check 2: Every task has a body and a period */
+	for ( u8_l_taskId = 0; u8_l_taskId < u8_a_tasksNumber; u8_l_taskId++ )
+	{
+		if ( ( st_a_tasks[u8_l_taskId].pf_task == NULL ) || ( st_a_tasks[u8_l_taskId].u16_period == 0 ) ) return SCH_ERROR;
+	}
+
+	st_gs_schTasks       = st_a_tasks;
+	u8_gs_schTasksNumber = u8_a_tasksNumber;
+	u8_gs_schReadyBits     = 0;
+	u8_gs_schSuspendedBits = 0;
+	u32_gs_schTicks        = 0;
+	u16_gs_schPeriodTicks  = 1;
+	u32_gs_schSleepMs      = 0;
+	u16_gs_schSleepUs      = 0;
+	u32_gs_schWakeups      = 0;
+
+	for ( u8_l_taskId = 0; u8_l_taskId < u8_a_tasksNumber; u8_l_taskId++ )
+	{
+		/* Offset 0 releases the task on the first tick */
+		u16_gs_schCountdown[u8_l_taskId] = st_a_tasks[u8_l_taskId].u16_offset + 1;
+		u16_gs_schWcet[u8_l_taskId]      = 0;
+	}
+
+	/* System tick: Timer1 CTC, started by SCH_start */
+	TIMER_timer1CtcInit( SCH_U16_TICK_COMPARE_VALUE );
+	TIMER_compASetCallback( &SCH_tick );
+
+	return SCH_OK;
+}
+
+/**
+ * @brief Starts the system tick, and dispatches the ready tasks forever in priority order.
+ * After each task, dispatching restarts from the highest priority task.
+ * When no task is ready, the MCU sleeps until the next interrupt ( SCH_U8_IDLE_SLEEP ).
+ * The execution time of every task run is measured, and the worst case is kept per task.
+ *
+ * @return This function never returns.
+ */
+void           SCH_start      ( void )
+{
+	u8  u8_l_readyBits;
+	u8  u8_l_taskId;
+	u8  u8_l_sreg;
+	u32 u32_l_startTime;
+	u32 u32_l_execTime;
+
+	TIMER_timer1Start( SCH_U16_TICK_PRESCALER );
+
+	while ( 1 )
+	{
+		u8_l_readyBits = u8_gs_schReadyBits;
+
+		/* Check 1: No task is ready */
+		if ( u8_l_readyBits == 0 )
+		{
+#if ( SCH_U8_IDLE_SLEEP == STD_OK )
+			SCH_idle();
+#endif
+			continue;
+		}
+
+		/* Step 1: Highest priority ready task is the lowest set bit */
+		for ( u8_l_taskId = 0; GET_BIT( u8_l_readyBits, u8_l_taskId ) == 0; u8_l_taskId++ );
+
+		/* Step 2: Consume its ready bit, the tick ISR sets bits in the same byte */
+		GLI_ENTER_CRITICAL( u8_l_sreg, GLI_U8_SITE_SCH_DISPATCH );
+		CLR_BIT( u8_gs_schReadyBits, u8_l_taskId );
+		GLI_EXIT_CRITICAL( u8_l_sreg );
+
+		/* Step 3: Run it to completion, and keep its worst-case execution time */
+		u32_l_startTime = SCH_getTimestamp();
+		st_gs_schTasks[u8_l_taskId].pf_task();
+		u32_l_execTime  = SCH_getTimestamp() - u32_l_startTime;
+
+		if ( u32_l_execTime > 0xFFFF ) u32_l_execTime = 0xFFFF;
+		if ( u32_l_execTime > u16_gs_schWcet[u8_l_taskId] ) u16_gs_schWcet[u8_l_taskId] = ( u16 ) u32_l_execTime;
+	}
+}
+
+/**
+ * @brief Reads the number of system ticks ( msec. ) since the scheduler was started.
+ *
+ * @param[out] u32_a_ticks Pointer to where the ticks will be stored.
+ *
+ * @return EN_SCH_ERROR_T SCH_OK if the ticks were read, SCH_ERROR if the pointer is NULL.
+ */
+EN_SCH_ERROR_T SCH_getTicks   ( u32 *u32_a_ticks )
+{
+	u32 u32_l_ticks;
+
+	if ( u32_a_ticks == NULL ) return SCH_ERROR;
+
+	/* The 4 bytes are updated from the tick ISR, read again until the value is stable */
+	do
+	{
+		u32_l_ticks = u32_gs_schTicks;
+	}
+	while ( u32_l_ticks != u32_gs_schTicks );
+
+	*u32_a_ticks = u32_l_ticks;
+
+	return SCH_OK;
+}
+
+/**
+ * @brief Reads the measured worst-case execution time of a task.
+ *
+ * @param[in]  u8_a_taskId  Index of the task in the tasks table.
+ * @param[out] u16_a_wcetUs Pointer to where the worst-case execution time ( usec. ) will be stored.
+ *
+ * @return EN_SCH_ERROR_T SCH_OK if the time was read, SCH_ERROR if the task does not exist or the pointer is NULL.
+ */
+EN_SCH_ERROR_T SCH_getTaskWcet( u8 u8_a_taskId, u16 *u16_a_wcetUs )
+{
+	if ( ( u8_a_taskId >= u8_gs_schTasksNumber ) || ( u16_a_wcetUs == NULL ) ) return SCH_ERROR;
+
+	*u16_a_wcetUs = u16_gs_schWcet[u8_a_taskId];
+
+	return SCH_OK;
+}
+
+/**
+ * @brief Reads the time spent awake and asleep, and the number of idle wake-ups, since the scheduler was started.
+ * Sleep time is measured around each idle sleep with the tick timer counts ( 1 usec. resolution ).
+ *
+ * @param[out] u32_a_awakeMs Pointer to where the awake time ( msec. ) will be stored.
+ * @param[out] u32_a_sleepMs Pointer to where the sleep time ( msec. ) will be stored.
+ * @param[out] u32_a_wakeups Pointer to where the number of idle wake-ups will be stored.
+ *
+ * @return EN_SCH_ERROR_T SCH_OK if the stats were read, SCH_ERROR if a pointer is NULL.
+ */
+EN_SCH_ERROR_T SCH_getIdleStats( u32 *u32_a_awakeMs, u32 *u32_a_sleepMs, u32 *u32_a_wakeups )
+{
+	u32 u32_l_ticks;
+
+	if ( ( u32_a_awakeMs == NULL ) || ( u32_a_sleepMs == NULL ) || ( u32_a_wakeups == NULL ) ) return SCH_ERROR;
+
+	/* Idle stats are only updated by the dispatcher, so a task reads them consistently */
+	SCH_getTicks( &u32_l_ticks );
+
+	*u32_a_sleepMs = u32_gs_schSleepMs;
+	*u32_a_awakeMs = u32_l_ticks - u32_gs_schSleepMs;
+	*u32_a_wakeups = u32_gs_schWakeups;
+
+	return SCH_OK;
+}
+
+/**
+ * @brief Suspends a task: it is not released anymore until it is resumed. Tasks only.
+ * A suspended task does not limit the tickless idle period.
+ *
+ * @param[in] u8_a_taskId Index of the task in the tasks table.
+ *
+ * @return EN_SCH_ERROR_T SCH_OK if suspended, SCH_ERROR if the task does not exist.
+ */
+EN_SCH_ERROR_T SCH_suspendTask ( u8 u8_a_taskId )
+{
+	u8 u8_l_sreg;
+
+	if ( u8_a_taskId >= u8_gs_schTasksNumber ) return SCH_ERROR;
+
+	/* The tick ISR reads and writes the same bytes */
+	GLI_ENTER_CRITICAL( u8_l_sreg, GLI_U8_SITE_SCH_TASKS );
+	SET_BIT( u8_gs_schSuspendedBits, u8_a_taskId );
+	CLR_BIT( u8_gs_schReadyBits, u8_a_taskId );
+	GLI_EXIT_CRITICAL( u8_l_sreg );
+
+	return SCH_OK;
+}
+
+/**
+ * @brief Resumes a suspended task, it is released on the next tick, then every period. Tasks only.
+ *
+ * @param[in] u8_a_taskId Index of the task in the tasks table.
+ *
+ * @return EN_SCH_ERROR_T SCH_OK if resumed ( or was not suspended ), SCH_ERROR if the task does not exist.
+ */
+EN_SCH_ERROR_T SCH_resumeTask  ( u8 u8_a_taskId )
+{
+	u8 u8_l_sreg;
+
+	if ( u8_a_taskId >= u8_gs_schTasksNumber ) return SCH_ERROR;
+
+	GLI_ENTER_CRITICAL( u8_l_sreg, GLI_U8_SITE_SCH_TASKS );
+	if ( GET_BIT( u8_gs_schSuspendedBits, u8_a_taskId ) == 1 )
+	{
+		/* Released at the end of the current timer period */
+		u16_gs_schCountdown[u8_a_taskId] = 1;
+		CLR_BIT( u8_gs_schSuspendedBits, u8_a_taskId );
+
+		/* Check 1: Current period is stretched, then end it at the next tick boundary */
+		if ( u16_gs_schPeriodTicks != 1 ) SCH_stopTickless();
+	}
+	GLI_EXIT_CRITICAL( u8_l_sreg );
+
+	return SCH_OK;
+}
+
+/**
+ * @brief Reads whether a task is suspended.
+ *
+ * @param[in]  u8_a_taskId    Index of the task in the tasks table.
+ * @param[out] u8_a_suspended Pointer to where STD_OK ( suspended ) or STD_NOK will be stored.
+ *
+ * @return EN_SCH_ERROR_T SCH_OK if read, SCH_ERROR if the task does not exist or the pointer is NULL.
+ */
+EN_SCH_ERROR_T SCH_isTaskSuspended( u8 u8_a_taskId, u8 *u8_a_suspended )
+{
+	if ( ( u8_a_taskId >= u8_gs_schTasksNumber ) || ( u8_a_suspended == NULL ) ) return SCH_ERROR;
+
+	*u8_a_suspended = ( GET_BIT( u8_gs_schSuspendedBits, u8_a_taskId ) == 1 ) ? STD_OK : STD_NOK;
+
+	return SCH_OK;
+}
+
+/* ***********************************************************************************************/
+
+/* ISR Callback function for the system tick: count the ticks of the ended period, and release the tasks whose period elapsed */
+static void SCH_tick        ( void )
+{
+	u16 u16_l_elapsedTicks = u16_gs_schPeriodTicks;
+	u8  u8_l_taskId;
+
+	u32_gs_schTicks += u16_l_elapsedTicks;
+
+	/* Check 1: A stretched period ended, then go back to one tick per period */
+	if ( u16_l_elapsedTicks != 1 )
+	{
+		u16_gs_schPeriodTicks = 1;
+		TIMER_timer1SetCompareValue( SCH_U16_TICK_COMPARE_VALUE );
+	}
+
+	for ( u8_l_taskId = 0; u8_l_taskId < u8_gs_schTasksNumber; u8_l_taskId++ )
+	{
+		if ( GET_BIT( u8_gs_schSuspendedBits, u8_l_taskId ) == 1 ) continue;
+
+		/* A stretched period never goes past a release, so the countdown reaches 0 exactly */
+		if ( u16_gs_schCountdown[u8_l_taskId] <= u16_l_elapsedTicks )
+		{
+			u16_gs_schCountdown[u8_l_taskId] = st_gs_schTasks[u8_l_taskId].u16_period;
+			SET_BIT( u8_gs_schReadyBits, u8_l_taskId );
+		}
+		else
+		{
+			u16_gs_schCountdown[u8_l_taskId] -= u16_l_elapsedTicks;
+		}
+	}
+}
+
+/* Sleep until the next interrupt if no task got ready, and account the sleep time */
+static void SCH_idle        ( void )
+{
+	u8  u8_l_sleepMode;
+	u32 u32_l_sleepStart;
+	u32 u32_l_sleepTime;
+#if ( SCH_U8_TICKLESS_IDLE == STD_OK )
+	u8  u8_l_sreg;
+#endif
+
+	SLP_getDeepestMode( &u8_l_sleepMode );
+	u32_l_sleepStart = SCH_getTimestamp();
+
+	/* Check 1: A task got ready since the dispatcher checked, then do not sleep
+	 * ( not a nestable section: SLP_sleep enables interrupts itself, with the SLEEP instruction ) */
+	GLI_disableGIE();
+	if ( u8_gs_schReadyBits != 0 )
+	{
+		GLI_enableGIE();
+		return;
+	}
+
+#if ( SCH_U8_TICKLESS_IDLE == STD_OK )
+	SCH_startTickless();
+#endif
+
+	/* Step 1: Sleep, the tick or any other interrupt wakes the MCU up ( interrupts are enabled on return ) */
+	SLP_sleep( u8_l_sleepMode );
+	u32_gs_schWakeups++;
+
+#if ( SCH_U8_TICKLESS_IDLE == STD_OK )
+	/* Check 2: Woken up by another interrupt before the stretched period ended */
+	GLI_ENTER_CRITICAL( u8_l_sreg, GLI_U8_SITE_SCH_IDLE );
+	if ( u16_gs_schPeriodTicks != 1 ) SCH_stopTickless();
+	GLI_EXIT_CRITICAL( u8_l_sreg );
+#endif
+
+	/* Step 2: Account the sleep time */
+	u32_l_sleepTime   = ( SCH_getTimestamp() - u32_l_sleepStart ) + u16_gs_schSleepUs;
+	u32_gs_schSleepMs += u32_l_sleepTime / SCH_U16_US_PER_TICK;
+	u16_gs_schSleepUs  = ( u16 ) ( u32_l_sleepTime % SCH_U16_US_PER_TICK );
+}
+
+/* Current time in usec. ( ticks and timer counts ), used for execution time measurement */
+static u32  SCH_getTimestamp( void )
+{
+	u32 u32_l_ticks;
+	u16 u16_l_counts;
+
+	/* A tick ISR between both reads means the counter wrapped, read both again */
+	do
+	{
+		u32_l_ticks  = u32_gs_schTicks;
+		u16_l_counts = TIMER_timer1GetCounter();
+	}
+	while ( u32_l_ticks != u32_gs_schTicks );
+
+	return ( u32_l_ticks * SCH_U16_US_PER_TICK ) + u16_l_counts;
+}
+
+/* Stretch the tick period up to the next task release, interrupts disabled */
+static void SCH_startTickless( void )
+{
+	u16 u16_l_nextRelease = SCH_U16_MAX_IDLE_TICKS;
+	u8  u8_l_taskId;
+
+	/* Check 1: Period is already stretched ( woken up early ), or the tick is pending, then keep it */
+	if ( ( u16_gs_schPeriodTicks != 1 ) || ( TIMER_timer1IsCompAPending() == 1 ) ) return;
+
+	/* Step 1: Nearest release of a non suspended task */
+	for ( u8_l_taskId = 0; u8_l_taskId < u8_gs_schTasksNumber; u8_l_taskId++ )
+	{
+		if ( ( GET_BIT( u8_gs_schSuspendedBits, u8_l_taskId ) == 0 ) && ( u16_gs_schCountdown[u8_l_taskId] < u16_l_nextRelease ) )
+		{
+			u16_l_nextRelease = u16_gs_schCountdown[u8_l_taskId];
+		}
+	}
+
+	/* Check 2: Next release is the next tick, nothing to skip */
+	if ( u16_l_nextRelease <= 1 ) return;
+
+	/* Step 2: The counter is below one tick, so the new compare value is always ahead of it, and the counter is never written */
+	u16_gs_schPeriodTicks = u16_l_nextRelease;
+	TIMER_timer1SetCompareValue( ( u16_l_nextRelease * SCH_U16_US_PER_TICK ) - 1 );
+
+	/* Check 3: Tick period ended while stretching it, then it only spanned one tick */
+	if ( TIMER_timer1IsCompAPending() == 1 )
+	{
+		u16_gs_schPeriodTicks = 1;
+		TIMER_timer1SetCompareValue( SCH_U16_TICK_COMPARE_VALUE );
+	}
+}
+
+/* Woken up before the stretched period ended, shorten it to the next tick boundary, interrupts disabled */
+static void SCH_stopTickless ( void )
+{
+	u16 u16_l_counts;
+	u16 u16_l_ticks;
+
+	/* Check 1: Stretched period already ended, the pending tick ISR counts it */
+	if ( TIMER_timer1IsCompAPending() == 1 ) return;
+
+	/* Step 1: Next tick boundary, or the one after if the counter is too close to it */
+	u16_l_counts = TIMER_timer1GetCounter();
+	u16_l_ticks  = ( u16_l_counts / SCH_U16_US_PER_TICK ) + 1;
+
+	if ( ( ( u16_l_ticks * SCH_U16_US_PER_TICK ) - 1 - u16_l_counts ) < SCH_U16_TICKLESS_GUARD_COUNTS ) u16_l_ticks++;
+
+	/* Step 2: Skipped ticks are counted by the tick ISR at that boundary, so the clock stays exact */
+	if ( u16_l_ticks < u16_gs_schPeriodTicks )
+	{
+		u16_gs_schPeriodTicks = u16_l_ticks;
+		TIMER_timer1SetCompareValue( ( u16_l_ticks * SCH_U16_US_PER_TICK ) - 1 );
+	}
+}
+
+/* ***********************************************************************************************/
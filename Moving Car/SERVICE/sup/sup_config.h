@@ -0,0 +1,33 @@
+/*
+ * sup_config.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Supervisor (SUP) pre-build configurations, through which user can configure before using the SUP service.
+ */
+
+#ifndef SUP_CONFIG_H_
+#define SUP_CONFIG_H_
+
+/* ***********************************************************************************************/
+/* SUP Configurations */
+
+/* Supervised tasks, identified by their scheduler task index, registered bits are kept in one byte ( 1 -> 8 ) */
+#define SUP_U8_MAX_TASKS			8
+
+/* Watchdog timeout while every task keeps its deadline: longer than the supervisor task period,
+ * and than the longest tickless idle period ( SCH_U16_MAX_IDLE_TICKS ) */
+#define SUP_U8_WDT_TIMEOUT			WDT_U8_TIMEOUT_1S
+
+/* Watchdog timeout of the blocking start-up code, between SUP_init and SUP_start: longer than its longest step
+ * between two SUP_feedStartup calls ( a 1 sec. test move of the calibration, then the 0.5 sec. settle delay of the next one ) */
+#define SUP_U8_WDT_STARTUP_TIMEOUT	WDT_U8_TIMEOUT_2S
+
+/* Watchdog timeout once a deadline is missed, the car is reset as soon as possible */
+#define SUP_U8_WDT_EXPIRED_TIMEOUT	WDT_U8_TIMEOUT_16MS
+
+/* End of Configurations */
+
+/* ***********************************************************************************************/
+
+#endif /* SUP_CONFIG_H_ */
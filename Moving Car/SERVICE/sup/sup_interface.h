@@ -0,0 +1,113 @@
+/*
+ * sup_interface.h
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Supervisor (SUP) functions' prototypes and definitions (Macros) to avoid magic numbers.
+ *               SUP feeds the watchdog only while every registered task checks in within its own deadline.
+ *               A hung task stops checking in, and a task hung in a loop also stops the supervisor task itself:
+ *               either way the watchdog resets the MCU, and the task to blame is reported after the reset.
+ *               Tasks suspended in the scheduler are not supervised, their deadline starts again when they are resumed.
+ */
+
+#ifndef SUP_INTERFACE_H_
+#define SUP_INTERFACE_H_
+
+/* ***********************************************************************************************/
+/* SUP Includes */
+
+/* LIB */
+#include "../../LIB/std.h"
+#include "../../LIB/bit_math.h"
+
+/* MCAL */
+#include "../../MCAL/wdt/wdt_interface.h"
+
+/* SERVICE */
+#include "../sch/sch_interface.h"
+#include "../evg/evg_interface.h"
+#include "sup_config.h"
+
+/* ***********************************************************************************************/
+/* SUP Macros */
+
+#if ( ( SUP_U8_MAX_TASKS < 1 ) || ( SUP_U8_MAX_TASKS > 8 ) )
+#error "SUP_U8_MAX_TASKS must be from 1 to 8"
+#endif
+
+/* No task to blame for the last reset */
+#define SUP_U8_NO_TASK				0xFF
+
+typedef enum {
+	SUP_OK,
+	SUP_ERROR
+}EN_SUP_ERROR_T;
+
+/* ***********************************************************************************************/
+/* SUP Functions' Prototypes */
+
+/**
+ * @brief Records the cause of the last reset, and the task to blame if the watchdog reset the MCU,
+ * then starts the watchdog with the start-up timeout ( SUP_U8_WDT_STARTUP_TIMEOUT ): until SUP_start, the blocking
+ * start-up code feeds it with SUP_feedStartup. Must be called first at start-up.
+ */
+void           SUP_init            ( void );
+
+/**
+ * @brief Registers a task: once started, the task must call SUP_checkIn at least every deadline.
+ *
+ * @param[in] u8_a_taskId     Scheduler index of the task ( 0 to SUP_U8_MAX_TASKS - 1 ).
+ * @param[in] u16_a_deadlineMs Longest time between two check-ins in msec. ( 1 or more ).
+ *
+ * @return EN_SUP_ERROR_T SUP_OK if registered, SUP_ERROR if the task index or the deadline is invalid.
+ */
+EN_SUP_ERROR_T SUP_register        ( u8 u8_a_taskId, u16 u16_a_deadlineMs );
+
+/**
+ * @brief Starts the supervision, every deadline starts now, and shortens the watchdog timeout to SUP_U8_WDT_TIMEOUT.
+ * Call it after the blocking start-up code, right before the scheduler is started.
+ */
+void           SUP_start           ( void );
+
+/**
+ * @brief Feeds the watchdog from the blocking start-up code, between SUP_init and SUP_start: every wait or move
+ * of the start-up code must feed it at least every start-up timeout. Does nothing once the supervision is started,
+ * the watchdog is only fed by SUP_task then.
+ */
+void           SUP_feedStartup     ( void );
+
+/**
+ * @brief Checks a registered task in, at the start of its body. Tasks only.
+ *
+ * @param[in] u8_a_taskId Scheduler index of the task.
+ */
+void           SUP_checkIn         ( u8 u8_a_taskId );
+
+/**
+ * @brief Starts the deadline of a task again, call it right after resuming the task in the scheduler. Tasks only.
+ *
+ * @param[in] u8_a_taskId Scheduler index of the task.
+ */
+void           SUP_restartDeadline ( u8 u8_a_taskId );
+
+/**
+ * @brief Supervisor task body, to be scheduled at the lowest priority with a period shorter than the
+ * watchdog timeout: feeds the watchdog if every supervised task met its deadline. Otherwise, keeps the late
+ * task for the report after the reset, shortens the watchdog timeout, and never feeds it again.
+ */
+void           SUP_task            ( void );
+
+/**
+ * @brief Reads the cause of the last reset, recorded by SUP_init.
+ *
+ * @param[out] u8_a_resetCause Pointer to where the causes ( WDT_U8_RESET_xxx flags ) will be stored.
+ * @param[out] u8_a_lateTaskId Pointer to where the task to blame for a watchdog reset will be stored: the task that
+ *             missed its deadline, or the task that hung. SUP_U8_NO_TASK if not a watchdog reset, or none checked in.
+ *
+ * @return EN_SUP_ERROR_T SUP_OK if read, SUP_ERROR if a pointer is NULL.
+ */
+EN_SUP_ERROR_T SUP_getResetCause   ( u8 *u8_a_resetCause, u8 *u8_a_lateTaskId );
+
+/* ***********************************************************************************************/
+
+#endif /* SUP_INTERFACE_H_ */
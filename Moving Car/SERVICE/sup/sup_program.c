@@ -0,0 +1,208 @@
+/*
+ * sup_program.c
+ *
+ *   Created on: Oct 18, 2026
+ *       Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *  Description: This file contains all Supervisor (SUP) functions' implementation.
+ */
+
+/* SERVICE */
+#include "sup_config.h"
+#include "sup_interface.h"
+
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+/* One bit per registered task, bit number = scheduler task index */
+static u8 u8_gs_supRegisteredBits = 0;
+
+/* Deadline, and time of the last check-in of each task, in msec. */
+static u16 u16_gs_supDeadline[SUP_U8_MAX_TASKS];
+static u32 u32_gs_supLastCheckIn[SUP_U8_MAX_TASKS];
+
+/* Supervision started: the watchdog is fed by SUP_task only */
+static u8 u8_gs_supStarted = STD_NOK;
+
+/* A deadline was missed, the watchdog is not fed anymore */
+static u8 u8_gs_supExpired = STD_NOK;
+
+/* Cause of the last reset, and the task to blame for it */
+static u8 u8_gs_supResetCause = 0;
+static u8 u8_gs_supLateTaskId = SUP_U8_NO_TASK;
+
+/* Task to blame kept across the watchdog reset: the task that missed its deadline, or else the last task that
+ * checked in, which is the running one if a task hung ( tasks run to completion and check in when they start ).
+ * The C start-up code does not clear the .noinit section, its complement tells a kept value from the random
+ * content of the RAM after power-up. */
+static u8 u8_gs_supKeptTaskId      __attribute__((section(".noinit")));
+static u8 u8_gs_supKeptTaskIdCheck __attribute__((section(".noinit")));
+
+/* ***********************************************************************************************/
+
+/**
+ * @brief Records the cause of the last reset, and the task to blame if the watchdog reset the MCU,
+ * then starts the watchdog with the start-up timeout ( SUP_U8_WDT_STARTUP_TIMEOUT ): until SUP_start, the blocking
+ * start-up code feeds it with SUP_feedStartup. Must be called first at start-up.
+ */
+void           SUP_init            ( void )
+{
+	WDT_getResetCause( &u8_gs_supResetCause );
+
+	/* Check 1: Watchdog reset, and a task to blame was kept before it */
+	if ( ( ( u8_gs_supResetCause & WDT_U8_RESET_WATCHDOG ) != 0 ) &&
+		 ( ( u8 ) ( u8_gs_supKeptTaskIdCheck ^ u8_gs_supKeptTaskId ) == 0xFF ) )
+	{
+		u8_gs_supLateTaskId = u8_gs_supKeptTaskId;
+	}
+
+	u8_gs_supKeptTaskId      = SUP_U8_NO_TASK;
+	u8_gs_supKeptTaskIdCheck = SUP_U8_NO_TASK;
+
+	u8_gs_supRegisteredBits = 0;
+	u8_gs_supStarted = STD_NOK;
+	u8_gs_supExpired = STD_NOK;
+
+	/* Start-up code blocks on buttons, delays and test moves: a hang there resets the MCU too, later */
+	WDT_enable( SUP_U8_WDT_STARTUP_TIMEOUT );
+}
+
+/**
+ * @brief Registers a task: once started, the task must call SUP_checkIn at least every deadline.
+ *
+ * @param[in] u8_a_taskId     Scheduler index of the task ( 0 to SUP_U8_MAX_TASKS - 1 ).
+ * @param[in] u16_a_deadlineMs Longest time between two check-ins in msec. ( 1 or more ).
+ *
+ * @return EN_SUP_ERROR_T SUP_OK if registered, SUP_ERROR if the task index or the deadline is invalid.
+ */
+EN_SUP_ERROR_T SUP_register        ( u8 u8_a_taskId, u16 u16_a_deadlineMs )
+{
+	if ( ( u8_a_taskId >= SUP_U8_MAX_TASKS ) || ( u16_a_deadlineMs == 0 ) ) return SUP_ERROR;
+
+	u16_gs_supDeadline[u8_a_taskId] = u16_a_deadlineMs;
+	SET_BIT( u8_gs_supRegisteredBits, u8_a_taskId );
+
+	return SUP_OK;
+}
+
+/**
+ * @brief Starts the supervision, every deadline starts now, and shortens the watchdog timeout to SUP_U8_WDT_TIMEOUT.
+ * Call it after the blocking start-up code, right before the scheduler is started.
+ */
+void           SUP_start           ( void )
+{
+	u32 u32_l_now;
+	u8  u8_l_taskId;
+
+	SCH_getTicks( &u32_l_now );
+
+	for ( u8_l_taskId = 0; u8_l_taskId < SUP_U8_MAX_TASKS; u8_l_taskId++ )
+	{
+		u32_gs_supLastCheckIn[u8_l_taskId] = u32_l_now;
+	}
+
+	u8_gs_supStarted = STD_OK;
+	WDT_enable( SUP_U8_WDT_TIMEOUT );
+}
+
+/**
+ * @brief Feeds the watchdog from the blocking start-up code, between SUP_init and SUP_start: every wait or move
+ * of the start-up code must feed it at least every start-up timeout. Does nothing once the supervision is started,
+ * the watchdog is only fed by SUP_task then.
+ */
+void           SUP_feedStartup     ( void )
+{
+	if ( u8_gs_supStarted == STD_OK ) return;
+
+	WDT_feed();
+}
+
+/**
+ * @brief Checks a registered task in, at the start of its body. Tasks only.
+ *
+ * @param[in] u8_a_taskId Scheduler index of the task.
+ */
+void           SUP_checkIn         ( u8 u8_a_taskId )
+{
+	if ( u8_a_taskId >= SUP_U8_MAX_TASKS ) return;
+
+	SCH_getTicks( &u32_gs_supLastCheckIn[u8_a_taskId] );
+
+	/* Check 1: No deadline missed yet, then this task is the one running */
+	if ( u8_gs_supExpired == STD_NOK )
+	{
+		u8_gs_supKeptTaskId      = u8_a_taskId;
+		u8_gs_supKeptTaskIdCheck = ( u8 ) ~u8_a_taskId;
+	}
+}
+
+/**
+ * @brief Starts the deadline of a task again, call it right after resuming the task in the scheduler. Tasks only.
+ *
+ * @param[in] u8_a_taskId Scheduler index of the task.
+ */
+void           SUP_restartDeadline ( u8 u8_a_taskId )
+{
+	if ( u8_a_taskId >= SUP_U8_MAX_TASKS ) return;
+
+	SCH_getTicks( &u32_gs_supLastCheckIn[u8_a_taskId] );
+}
+
+/**
+ * @brief Supervisor task body, to be scheduled at the lowest priority with a period shorter than the
+ * watchdog timeout: feeds the watchdog if every supervised task met its deadline. Otherwise, keeps the late
+ * task for the report after the reset, shortens the watchdog timeout, and never feeds it again.
+ */
+void           SUP_task            ( void )
+{
+	u32 u32_l_now;
+	u8  u8_l_taskId;
+	u8  u8_l_suspended;
+
+	/* Check 1: A deadline was already missed, wait for the reset */
+	if ( u8_gs_supExpired == STD_OK ) return;
+
+	SCH_getTicks( &u32_l_now );
+
+	for ( u8_l_taskId = 0; u8_l_taskId < SUP_U8_MAX_TASKS; u8_l_taskId++ )
+	{
+		if ( GET_BIT( u8_gs_supRegisteredBits, u8_l_taskId ) == 0 ) continue;
+
+		/* Check 2: Suspended task, not supervised */
+		if ( ( SCH_isTaskSuspended( u8_l_taskId, &u8_l_suspended ) == SCH_OK ) && ( u8_l_suspended == STD_OK ) ) continue;
+
+		/* Check 3: Deadline missed, then keep the task, raise the fault flag ( motors off ), and let the watchdog reset the MCU */
+		if ( ( u32_l_now - u32_gs_supLastCheckIn[u8_l_taskId] ) > u16_gs_supDeadline[u8_l_taskId] )
+		{
+			EVG_set( EVG_U8_FAULT );
+			u8_gs_supKeptTaskId      = u8_l_taskId;
+			u8_gs_supKeptTaskIdCheck = ( u8 ) ~u8_l_taskId;
+			u8_gs_supExpired = STD_OK;
+
+			WDT_enable( SUP_U8_WDT_EXPIRED_TIMEOUT );
+			return;
+		}
+	}
+
+	WDT_feed();
+}
+
+/**
+ * @brief Reads the cause of the last reset, recorded by SUP_init.
+ *
+ * @param[out] u8_a_resetCause Pointer to where the causes ( WDT_U8_RESET_xxx flags ) will be stored.
+ * @param[out] u8_a_lateTaskId Pointer to where the task to blame for a watchdog reset will be stored: the task that
+ *             missed its deadline, or the task that hung. SUP_U8_NO_TASK if not a watchdog reset, or none checked in.
+ *
+ * @return EN_SUP_ERROR_T SUP_OK if read, SUP_ERROR if a pointer is NULL.
+ */
+EN_SUP_ERROR_T SUP_getResetCause   ( u8 *u8_a_resetCause, u8 *u8_a_lateTaskId )
+{
+	if ( ( u8_a_resetCause == NULL ) || ( u8_a_lateTaskId == NULL ) ) return SUP_ERROR;
+
+	*u8_a_resetCause = u8_gs_supResetCause;
+	*u8_a_lateTaskId = u8_gs_supLateTaskId;
+
+	return SUP_OK;
+}
+
+/* ***********************************************************************************************/
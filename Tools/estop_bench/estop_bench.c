@@ -0,0 +1,333 @@
+/*
+ * estop_bench.c
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: Bench firmware measuring the emergency stop latency: from the falling edge on INT0 to the motors'
+ *                 PWM pins low, driven by the INT0 safe state of the EXI driver ( MCAL/exi/exi_config.h ).
+ *  MCU Datasheet: AVR ATmega32 - https://ww1.microchip.com/downloads/en/DeviceDoc/Atmega32A-DataSheet-Complete-DS40002072A.pdf
+ *
+ * Both ends are timed by hardware, with Timer1 counting CPU cycles:
+ *  - The edge is OC1B ( PD4 ) cleared on compare match, at a random time   -> jumper PD4 to INT0 ( PD2 )
+ *  - The pin low is captured by the input capture unit, on falling edge    -> jumper PC0 ( Motor 0 PWM ) to ICP1 ( PD6 )
+ * Latency = ICR1 - OCR1B, which includes the OC1B output and the ICP1 input synchronizer delays: build with
+ * -DBENCH_LOOPBACK and jumper PD4 to PD6 to measure that offset alone.
+ *
+ * Every trial picks one background load at random, to hit the edge in every state the car can be in:
+ *  - Busy  : main loop running, interrupts enabled
+ *  - Locked: critical sections of random length, up to BENCH_U8_MAX_LOCK_LOOPS
+ *  - Sleep : Idle sleep ( + 4 cycles wake-up )
+ * and a Timer0 ISR runs every 1 msec. for BENCH_U8_TICK_LOOPS loops, standing for the scheduler tick.
+ *
+ * The report is sent on the USART ( TXD, PD1 ), 38400 8N1:
+ *  trials, min, mean and max cycles, max per load, and a histogram of 8-cycle buckets.
+ *
+ * Disconnect the motor driver, and do not press the STOP button during the bench.
+ *
+ * Build and flash:
+ *  avr-gcc -mmcu=atmega32 -Os -DEXI_U8_STATIC_BINDING=STD_NOK -I"../../Moving Car" estop_bench.c "../../Moving Car/MCAL/exi/exi_program.c" -o estop_bench.elf
+ *  ( runtime binding: INT0 calls BENCH_stopCallback instead of the car's APP_stopCar, MCAL/exi/exi_config.h )
+ *  avr-objcopy -O ihex estop_bench.elf estop_bench.hex
+ *  avrdude -p m32 -c <programmer> -U flash:w:estop_bench.hex:i
+ *
+ * The bench needs the board: both jumpers loop MCU pins back to the timer, which a simulator such as simavr does
+ * not wire without a harness of its own.
+ *
+ * Results ( copy the USART report here, with the date, the board, its clock, and the -DBENCH_LOOPBACK offset ):
+ *  None yet. The bench was written without an AVR toolchain or board at hand, and has only been syntax-checked on a
+ *  PC. Until a report is recorded here, the only figures are the datasheet bound of MCAL/exi/exi_config.h.
+ */
+
+/* LIB */
+#include "LIB/std.h"
+#include "LIB/bit_math.h"
+
+/* MCAL */
+#include "MCAL/exi/exi_interface.h"
+
+/* ***********************************************************************************************/
+/* Bench Configurations */
+
+#define BENCH_U16_TRIALS			2000
+#define BENCH_U16_MIN_DELAY			400		/* Cycles from arming to the edge, at least */
+#define BENCH_U16_DELAY_MASK		0x0FFF	/* + 0 -> 4095 random cycles */
+#define BENCH_U8_MAX_LOCK_LOOPS		40		/* Longest critical section of the Locked load, 3 cycles per loop */
+#define BENCH_U8_TICK_LOOPS			60		/* Timer0 ISR work, 3 cycles per loop */
+#define BENCH_U8_BUCKET_SHIFT		3		/* 8-cycle histogram buckets */
+#define BENCH_U8_BUCKETS			32		/* Last bucket counts everything above */
+
+#define BENCH_U8_LOAD_BUSY			0
+#define BENCH_U8_LOAD_LOCKED		1
+#define BENCH_U8_LOAD_SLEEP			2
+#define BENCH_U8_LOADS				3
+
+/* ***********************************************************************************************/
+/* Registers */
+
+#define BENCH_U8_PORTC_REG		*( ( volatile u8  * ) 0x35 )
+#define BENCH_U8_DDRC_REG		*( ( volatile u8  * ) 0x34 )
+#define BENCH_U8_PORTD_REG		*( ( volatile u8  * ) 0x32 )
+#define BENCH_U8_DDRD_REG		*( ( volatile u8  * ) 0x31 )
+#define BENCH_U8_PIND_REG		*( ( volatile u8  * ) 0x30 )
+
+#define BENCH_U8_TCCR0_REG		*( ( volatile u8  * ) 0x53 )
+#define BENCH_U8_OCR0_REG		*( ( volatile u8  * ) 0x5C )
+#define BENCH_U8_TIMSK_REG		*( ( volatile u8  * ) 0x59 )
+#define BENCH_U8_TIFR_REG		*( ( volatile u8  * ) 0x58 )
+#define BENCH_U8_TCCR1A_REG		*( ( volatile u8  * ) 0x4F )
+#define BENCH_U8_TCCR1B_REG		*( ( volatile u8  * ) 0x4E )
+#define BENCH_U16_TCNT1_REG		*( ( volatile u16 * ) 0x4C )
+#define BENCH_U16_OCR1B_REG		*( ( volatile u16 * ) 0x48 )
+#define BENCH_U16_ICR1_REG		*( ( volatile u16 * ) 0x46 )
+#define BENCH_U8_GIFR_REG		*( ( volatile u8  * ) 0x5A )
+#define BENCH_U8_MCUCR_REG		*( ( volatile u8  * ) 0x55 )
+
+#define BENCH_U8_UCSRA_REG		*( ( volatile u8  * ) 0x2B )
+#define BENCH_U8_UCSRB_REG		*( ( volatile u8  * ) 0x2A )
+#define BENCH_U8_UCSRC_REG		*( ( volatile u8  * ) 0x40 )
+#define BENCH_U8_UBRRL_REG		*( ( volatile u8  * ) 0x29 )
+#define BENCH_U8_UDR_REG		*( ( volatile u8  * ) 0x2C )
+
+#define BENCH_U8_PWM_PINS		0x03	/* PC0, PC1 */
+#define BENCH_U8_OC1B_PIN		4		/* PD4 */
+#define BENCH_U8_INT0_PIN		2		/* PD2 */
+#define BENCH_U8_ICP1_PIN		6		/* PD6 */
+
+#define BENCH_U8_COM1B_SET		0x30	/* TCCR1A: set OC1B on compare match */
+#define BENCH_U8_COM1B_CLEAR	0x20	/* TCCR1A: clear OC1B on compare match */
+#define BENCH_U8_FOC1B_BIT		2
+#define BENCH_U8_CS10			0x01	/* TCCR1B: no prescaler, ICES1 = 0: capture on falling edge */
+#define BENCH_U8_ICF1_BIT		5
+#define BENCH_U8_OCF1B_BIT		3
+#define BENCH_U8_INTF0_BIT		6
+#define BENCH_U8_OCIE0_BIT		1
+#define BENCH_U8_TIMER0_CTC_64	0x0B	/* TCCR0: CTC, prescaler 64 */
+#define BENCH_U8_TIMER0_1MSEC	124		/* 8 MHz / 64 / 125 = 1 kHz */
+#define BENCH_U8_SE_BIT			7
+#define BENCH_U8_SM_MASK		0x70
+#define BENCH_U8_TXEN_BIT		3
+#define BENCH_U8_UDRE_BIT		5
+#define BENCH_U8_UCSRC_8N1		0x86	/* URSEL, UCSZ1, UCSZ0 */
+#define BENCH_U8_UBRR_38400		12		/* 8 MHz, 0.2 % error */
+
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+static u16 u16_gs_lfsr = 0xACE1;
+static volatile u16 u16_gs_stopCallbacks = 0;
+
+static u16 u16_gs_min = 0xFFFF;
+static u16 u16_gs_max = 0;
+static u32 u32_gs_sum = 0;
+static u16 u16_gs_timeouts = 0;
+static u16 au16_gs_loadMax[BENCH_U8_LOADS] = { 0, 0, 0 };
+static u16 au16_gs_histogram[BENCH_U8_BUCKETS];
+
+void __vector_10( void )	__attribute__((signal));
+
+/* ***********************************************************************************************/
+
+/* 16-bit Galois LFSR, period 65535 */
+static u16 BENCH_random( void )
+{
+	u16_gs_lfsr = ( u16_gs_lfsr >> 1 ) ^ ( -( u16_gs_lfsr & 1 ) & 0xB400 );
+
+	return u16_gs_lfsr;
+}
+
+/* 3 cycles per loop */
+static void BENCH_spin( u8 u8_a_loops )
+{
+	__asm__ __volatile__ ( "1: dec %0"	"\n\t"
+						   "brne 1b"
+						   : "+r" ( u8_a_loops ) );
+}
+
+static void BENCH_putChar( u8 u8_a_char )
+{
+	while ( GET_BIT( BENCH_U8_UCSRA_REG, BENCH_U8_UDRE_BIT ) == 0 );
+	BENCH_U8_UDR_REG = u8_a_char;
+}
+
+static void BENCH_putString( const char *pc_a_string )
+{
+	while ( *pc_a_string != '\0' ) BENCH_putChar( *pc_a_string++ );
+}
+
+static void BENCH_putNumber( const char *pc_a_label, u32 u32_a_number )
+{
+	char ac_l_digits[10];
+	u8 u8_l_count = 0;
+
+	BENCH_putString( pc_a_label );
+	do
+	{
+		ac_l_digits[u8_l_count++] = '0' + ( u32_a_number % 10 );
+		u32_a_number /= 10;
+	} while ( u32_a_number != 0 );
+	while ( u8_l_count != 0 ) BENCH_putChar( ac_l_digits[--u8_l_count] );
+}
+
+/* The real callback of the car only raises flags, after the safe state is driven */
+static void BENCH_stopCallback( void )
+{
+	u16_gs_stopCallbacks++;
+}
+
+/**
+ * @brief Runs one trial: arms the edge at a random time, runs the background load until the capture.
+ *
+ * @param[in]  u8_a_load Background load ( BENCH_U8_LOAD_BUSY, BENCH_U8_LOAD_LOCKED, BENCH_U8_LOAD_SLEEP ).
+ * @param[out] u16_a_latency Edge to capture, in cycles.
+ *
+ * @return u8 STD_OK if captured, STD_NOK on timeout ( check the jumpers ).
+ */
+static u8 BENCH_trial( u8 u8_a_load, u16 *u16_a_latency )
+{
+	u16 u16_l_edge;
+	u16 u16_l_timeout = 0xFFFF;
+
+	/* Step 1: Motors "on", OC1B forced high, then set to clear on the next compare match */
+#ifndef BENCH_LOOPBACK
+	BENCH_U8_PORTC_REG |= BENCH_U8_PWM_PINS;
+#endif
+	BENCH_U8_TCCR1A_REG = BENCH_U8_COM1B_SET;
+	BENCH_U8_TCCR1A_REG = BENCH_U8_COM1B_SET | ( 1 << BENCH_U8_FOC1B_BIT );
+	BENCH_U8_TCCR1A_REG = BENCH_U8_COM1B_CLEAR;
+	while ( GET_BIT( BENCH_U8_PIND_REG, BENCH_U8_INT0_PIN ) == 0 );
+
+	/* Step 2: Clear stale flags, and arm the edge at a random time */
+	BENCH_U8_GIFR_REG = ( 1 << BENCH_U8_INTF0_BIT );
+	__asm__ __volatile__ ( "cli" ::: "memory" );
+	u16_l_edge = BENCH_U16_TCNT1_REG + BENCH_U16_MIN_DELAY + ( BENCH_random() & BENCH_U16_DELAY_MASK );
+	BENCH_U16_OCR1B_REG = u16_l_edge;
+	__asm__ __volatile__ ( "sei" ::: "memory" );
+	BENCH_U8_TIFR_REG = ( 1 << BENCH_U8_ICF1_BIT ) | ( 1 << BENCH_U8_OCF1B_BIT );
+
+	/* Step 3: Background load until the PWM pin falling edge is captured */
+	while ( GET_BIT( BENCH_U8_TIFR_REG, BENCH_U8_ICF1_BIT ) == 0 )
+	{
+		if ( --u16_l_timeout == 0 ) return STD_NOK;
+
+		switch ( u8_a_load )
+		{
+			case BENCH_U8_LOAD_LOCKED:
+				__asm__ __volatile__ ( "cli" ::: "memory" );
+				BENCH_spin( 1 + ( BENCH_random() % BENCH_U8_MAX_LOCK_LOOPS ) );
+				__asm__ __volatile__ ( "sei" ::: "memory" );
+			break;
+
+			case BENCH_U8_LOAD_SLEEP:
+				SET_BIT( BENCH_U8_MCUCR_REG, BENCH_U8_SE_BIT );
+				__asm__ __volatile__ ( "sleep" ::: "memory" );
+				CLR_BIT( BENCH_U8_MCUCR_REG, BENCH_U8_SE_BIT );
+			break;
+
+			default: break;
+		}
+	}
+
+	*u16_a_latency = BENCH_U16_ICR1_REG - u16_l_edge;
+
+	return STD_OK;
+}
+
+static void BENCH_record( u8 u8_a_load, u16 u16_a_latency )
+{
+	u16 u16_l_bucket = u16_a_latency >> BENCH_U8_BUCKET_SHIFT;
+
+	if ( u16_a_latency < u16_gs_min ) u16_gs_min = u16_a_latency;
+	if ( u16_a_latency > u16_gs_max ) u16_gs_max = u16_a_latency;
+	if ( u16_a_latency > au16_gs_loadMax[u8_a_load] ) au16_gs_loadMax[u8_a_load] = u16_a_latency;
+	u32_gs_sum += u16_a_latency;
+
+	if ( u16_l_bucket >= BENCH_U8_BUCKETS ) u16_l_bucket = BENCH_U8_BUCKETS - 1;
+	au16_gs_histogram[u16_l_bucket]++;
+}
+
+static void BENCH_report( u16 u16_a_trials )
+{
+	u8 u8_l_bucket;
+
+#ifdef BENCH_LOOPBACK
+	BENCH_putString( "\r\nE-stop bench, loopback ( OC1B to ICP1 offset )" );
+#else
+	BENCH_putString( "\r\nE-stop bench, INT0 edge to PWM pin low" );
+#endif
+	BENCH_putNumber( "\r\ntrials    : ", u16_a_trials );
+	BENCH_putNumber( "\r\ntimeouts  : ", u16_gs_timeouts );
+	BENCH_putNumber( "\r\ncallbacks : ", u16_gs_stopCallbacks );
+	BENCH_putNumber( "\r\nmin cycles: ", u16_gs_min );
+	BENCH_putNumber( "\r\nmean x100 : ", ( u16_a_trials != 0 ) ? ( u32_gs_sum * 100 ) / u16_a_trials : 0 );
+	BENCH_putNumber( "\r\nmax cycles: ", u16_gs_max );
+	BENCH_putNumber( "\r\nmax busy  : ", au16_gs_loadMax[BENCH_U8_LOAD_BUSY] );
+	BENCH_putNumber( "\r\nmax locked: ", au16_gs_loadMax[BENCH_U8_LOAD_LOCKED] );
+	BENCH_putNumber( "\r\nmax sleep : ", au16_gs_loadMax[BENCH_U8_LOAD_SLEEP] );
+	BENCH_putString( "\r\nhistogram ( from cycles: trials )" );
+	for ( u8_l_bucket = 0; u8_l_bucket < BENCH_U8_BUCKETS; u8_l_bucket++ )
+	{
+		if ( au16_gs_histogram[u8_l_bucket] == 0 ) continue;
+		BENCH_putNumber( "\r\n  ", ( u16 ) u8_l_bucket << BENCH_U8_BUCKET_SHIFT );
+		BENCH_putNumber( ": ", au16_gs_histogram[u8_l_bucket] );
+	}
+	BENCH_putString( "\r\n" );
+}
+
+int main( void )
+{
+	u16 u16_l_trial;
+	u16 u16_l_captured = 0;
+	u16 u16_l_latency;
+	u8 u8_l_load;
+
+	/* Step 1: Pins: PWM outputs, OC1B output, INT0 and ICP1 inputs, USART */
+	BENCH_U8_DDRC_REG |= BENCH_U8_PWM_PINS;
+	SET_BIT( BENCH_U8_DDRD_REG, BENCH_U8_OC1B_PIN );
+	CLR_BIT( BENCH_U8_DDRD_REG, BENCH_U8_INT0_PIN );
+	CLR_BIT( BENCH_U8_DDRD_REG, BENCH_U8_ICP1_PIN );
+	BENCH_U8_UBRRL_REG = BENCH_U8_UBRR_38400;
+	BENCH_U8_UCSRC_REG = BENCH_U8_UCSRC_8N1;
+	SET_BIT( BENCH_U8_UCSRB_REG, BENCH_U8_TXEN_BIT );
+
+	/* Step 2: Timer1 counts CPU cycles, Timer0 ticks every 1 msec., Idle sleep selected */
+	BENCH_U8_TCCR1B_REG = BENCH_U8_CS10;
+	BENCH_U8_OCR0_REG = BENCH_U8_TIMER0_1MSEC;
+	BENCH_U8_TCCR0_REG = BENCH_U8_TIMER0_CTC_64;
+	SET_BIT( BENCH_U8_TIMSK_REG, BENCH_U8_OCIE0_BIT );
+	BENCH_U8_MCUCR_REG &= ~BENCH_U8_SM_MASK;
+
+	/* Step 3: INT0 through the EXI driver, safe state and callback as in the car */
+#ifndef BENCH_LOOPBACK
+	EXI_intSetCallBack( EXI_U8_INT0, &BENCH_stopCallback );
+	EXI_enablePIE( EXI_U8_INT0, EXI_U8_SENSE_FALLING_EDGE );
+#endif
+	__asm__ __volatile__ ( "sei" ::: "memory" );
+
+	/* Step 4: Trials */
+	for ( u16_l_trial = 0; u16_l_trial < BENCH_U16_TRIALS; u16_l_trial++ )
+	{
+		u8_l_load = BENCH_random() % BENCH_U8_LOADS;
+
+		if ( BENCH_trial( u8_l_load, &u16_l_latency ) == STD_OK )
+		{
+			BENCH_record( u8_l_load, u16_l_latency );
+			u16_l_captured++;
+		}
+		else
+		{
+			u16_gs_timeouts++;
+		}
+	}
+
+	BENCH_report( u16_l_captured );
+
+	while ( 1 );
+}
+
+/**
+ * ISR function implementation of Timer0 Compare Match, stands for the scheduler tick
+ * */
+void __vector_10( void )
+{
+	BENCH_spin( BENCH_U8_TICK_LOOPS );
+}
@@ -0,0 +1,268 @@
+/*
+ * isr_bench.c
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: Bench firmware measuring the cost of the EXI and TIMER ISR bindings: the runtime callback through
+ *                 a pointer, or the compile-time handler ( APP/app_bindings.h, enabled in MCAL/exi/exi_config.h and
+ *                 MCAL/timer/timer_config.h ).
+ *  MCU Datasheet: AVR ATmega32 - https://ww1.microchip.com/downloads/en/DeviceDoc/Atmega32A-DataSheet-Complete-DS40002072A.pdf
+ *
+ * Two vectors are timed, each with the handler the car binds to it:
+ *  - INT2 ( __vector_3 )        : wheel encoder tick ( ENC_COUNT_TICK_FROM_ISR, or the ENC_countTick callback )
+ *  - Timer2 OVF ( __vector_5 )  : end of a Timer2 delay ( DCM_UPDATE_STOP_FLAG_FROM_ISR, or the DCM_updateStopFlag callback )
+ * INT2 is raised by the firmware itself: PB2 is an output, and external interrupts fire on output pins too.
+ * Timer2 is preloaded to overflow on its next clock. No jumper is needed.
+ *
+ * Timer1 counts CPU cycles. A trial reads TCNT1, raises the interrupt with interrupts disabled, enables them, and
+ * reads TCNT1 again once the ISR returned: the ISR cost ( response, vector jump, prologue, handler, epilogue, RETI ).
+ * The same sequence with the interrupt disabled gives the fixed offset, subtracted from every trial.
+ * The handler is the same in both builds, so the difference of the two reports is the cost of the binding alone.
+ *
+ * The report is sent on the USART ( TXD, PD1 ), 38400 8N1: min and max ISR cycles per vector.
+ * The ISR code is deterministic, so min and max only differ by the cycle the interrupt waits for the instruction
+ * following SEI.
+ *
+ * Build and flash, once per binding:
+ *  BINDING="-DEXI_U8_STATIC_BINDING=STD_OK  -DTIMER_U8_STATIC_BINDING=STD_OK"    ( compile-time )
+ *  BINDING="-DEXI_U8_STATIC_BINDING=STD_NOK -DTIMER_U8_STATIC_BINDING=STD_NOK"   ( runtime )
+ *  avr-gcc -mmcu=atmega32 -Os $BINDING -I"../../Moving Car" isr_bench.c "../../Moving Car/MCAL/exi/exi_program.c" \
+ *          "../../Moving Car/MCAL/timer/timer_program.c" "../../Moving Car/MCAL/dio/dio_program.c" \
+ *          "../../Moving Car/HAL/enc/enc_program.c" "../../Moving Car/HAL/led/led_program.c" \
+ *          "../../Moving Car/SERVICE/evg/evg_program.c" -lm -o isr_bench.elf
+ *  avr-objcopy -O ihex isr_bench.elf isr_bench.hex
+ *  avrdude -p m32 -c <programmer> -U flash:w:isr_bench.hex:i
+ *  avr-objdump -d isr_bench.elf shows the prologue of __vector_3 and __vector_5 for each binding.
+ *
+ * No jumper is used, so the same elf also runs in simavr, which counts CPU cycles and prints the USART on the console:
+ *  simavr -m atmega32 -f 8000000 isr_bench.elf
+ * A simulator run is only a stand-in: note it as such, and compare its offsets line with one board run once.
+ *
+ * Results ( copy both reports here, with the date, the board or simulator, and the avr-gcc version ):
+ *  None yet. No AVR toolchain, board or simavr was available when the bench was written, so it has never run; the
+ *  cycles saved by the compile-time binding are still unmeasured.
+ */
+
+/* LIB */
+#include "LIB/std.h"
+#include "LIB/bit_math.h"
+
+/* MCAL */
+#include "MCAL/exi/exi_interface.h"
+#include "MCAL/timer/timer_interface.h"
+
+/* HAL */
+#include "HAL/enc/enc_interface.h"
+#include "HAL/dcm/dcm_interface.h"
+
+/* ***********************************************************************************************/
+/* Bench Configurations */
+
+#define BENCH_U16_TRIALS			1000
+
+#define BENCH_U8_VECTOR_INT2		0
+#define BENCH_U8_VECTOR_TIMER2		1
+#define BENCH_U8_VECTORS			2
+
+/* ***********************************************************************************************/
+/* Registers */
+
+#define BENCH_U8_PORTB_REG		*( ( volatile u8  * ) 0x38 )
+#define BENCH_U8_DDRB_REG		*( ( volatile u8  * ) 0x37 )
+#define BENCH_U8_GICR_REG		*( ( volatile u8  * ) 0x5B )
+#define BENCH_U8_GIFR_REG		*( ( volatile u8  * ) 0x5A )
+#define BENCH_U8_TIMSK_REG		*( ( volatile u8  * ) 0x59 )
+#define BENCH_U8_TIFR_REG		*( ( volatile u8  * ) 0x58 )
+#define BENCH_U8_TCCR1B_REG		*( ( volatile u8  * ) 0x4E )
+#define BENCH_U16_TCNT1_REG		*( ( volatile u16 * ) 0x4C )
+#define BENCH_U8_TCCR2_REG		*( ( volatile u8  * ) 0x45 )
+#define BENCH_U8_TCNT2_REG		*( ( volatile u8  * ) 0x44 )
+
+#define BENCH_U8_UCSRA_REG		*( ( volatile u8  * ) 0x2B )
+#define BENCH_U8_UCSRB_REG		*( ( volatile u8  * ) 0x2A )
+#define BENCH_U8_UCSRC_REG		*( ( volatile u8  * ) 0x40 )
+#define BENCH_U8_UBRRL_REG		*( ( volatile u8  * ) 0x29 )
+#define BENCH_U8_UDR_REG		*( ( volatile u8  * ) 0x2C )
+
+#define BENCH_U8_INT2_PIN		2		/* PB2 */
+#define BENCH_U8_INT2_BIT		5		/* GICR, GIFR */
+#define BENCH_U8_TOIE2_BIT		6		/* TIMSK, TIFR */
+#define BENCH_U8_CS10			0x01	/* TCCR1B: no prescaler */
+#define BENCH_U8_CS20			0x01	/* TCCR2: normal mode, no prescaler */
+#define BENCH_U8_TXEN_BIT		3
+#define BENCH_U8_UDRE_BIT		5
+#define BENCH_U8_UCSRC_8N1		0x86	/* URSEL, UCSZ1, UCSZ0 */
+#define BENCH_U8_UBRR_38400		12		/* 8 MHz, 0.2 % error */
+
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+/* Timer2 overflows before its handler runs, from MCAL/timer/timer_program.c */
+extern u16 u16_g_overflow2Numbers;
+
+/* The INT0 vector is built with the car's binding, it is never enabled here */
+void APP_stopCar( void ) {}
+
+/* The DCM stop flag and its callback, as in HAL/dcm/dcm_program.c, without the rest of the DCM */
+EN_DCM_FLAG en_g_stopFlag = FALSE;
+void DCM_updateStopFlag( void ) { DCM_UPDATE_STOP_FLAG_FROM_ISR(); }
+
+static u16 au16_gs_min[BENCH_U8_VECTORS] = { 0xFFFF, 0xFFFF };
+static u16 au16_gs_max[BENCH_U8_VECTORS] = { 0, 0 };
+
+/* ***********************************************************************************************/
+
+static void BENCH_putChar( u8 u8_a_char )
+{
+	while ( GET_BIT( BENCH_U8_UCSRA_REG, BENCH_U8_UDRE_BIT ) == 0 );
+	BENCH_U8_UDR_REG = u8_a_char;
+}
+
+static void BENCH_putString( const char *pc_a_string )
+{
+	while ( *pc_a_string != '\0' ) BENCH_putChar( *pc_a_string++ );
+}
+
+static void BENCH_putNumber( const char *pc_a_label, u32 u32_a_number )
+{
+	char ac_l_digits[10];
+	u8 u8_l_count = 0;
+
+	BENCH_putString( pc_a_label );
+	do
+	{
+		ac_l_digits[u8_l_count++] = '0' + ( u32_a_number % 10 );
+		u32_a_number /= 10;
+	} while ( u32_a_number != 0 );
+	while ( u8_l_count != 0 ) BENCH_putChar( ac_l_digits[--u8_l_count] );
+}
+
+/**
+ * @brief Runs one trial: raises the interrupt with interrupts disabled, then lets it run.
+ * With the interrupt disabled, the same sequence runs without the ISR.
+ *
+ * @param[in] u8_a_vector BENCH_U8_VECTOR_INT2 or BENCH_U8_VECTOR_TIMER2.
+ *
+ * @return u16 Cycles from the first TCNT1 read to the second.
+ */
+static u16 BENCH_trial( u8 u8_a_vector )
+{
+	u16 u16_l_start;
+	u16 u16_l_end;
+
+	__asm__ __volatile__ ( "cli" ::: "memory" );
+
+	/* Step 1: Arm: INT2 pin low, or Timer2 stopped one count before the overflow */
+	if ( u8_a_vector == BENCH_U8_VECTOR_INT2 )
+	{
+		CLR_BIT( BENCH_U8_PORTB_REG, BENCH_U8_INT2_PIN );
+		BENCH_U8_GIFR_REG = ( 1 << BENCH_U8_INT2_BIT );
+	}
+	else
+	{
+		u16_g_overflow2Numbers = 0;
+		BENCH_U8_TCNT2_REG = 0xFF;
+		BENCH_U8_TIFR_REG = ( 1 << BENCH_U8_TOIE2_BIT );
+	}
+
+	/* Step 2: Raise the interrupt, and let it run */
+	u16_l_start = BENCH_U16_TCNT1_REG;
+	if ( u8_a_vector == BENCH_U8_VECTOR_INT2 ) SET_BIT( BENCH_U8_PORTB_REG, BENCH_U8_INT2_PIN );
+	else                                       BENCH_U8_TCCR2_REG = BENCH_U8_CS20;
+	__asm__ __volatile__ ( "sei"	"\n\t"
+						   "nop"	"\n\t"
+						   "nop"	"\n\t"
+						   "nop"	::: "memory" );
+	u16_l_end = BENCH_U16_TCNT1_REG;
+
+	/* Step 3: Timer2 stopped by its ISR, or here when its interrupt is disabled */
+	BENCH_U8_TCCR2_REG = 0;
+
+	return u16_l_end - u16_l_start;
+}
+
+/**
+ * @brief Times one vector: the offset with its interrupt disabled, then the trials with it enabled.
+ *
+ * @param[in] u8_a_vector BENCH_U8_VECTOR_INT2 or BENCH_U8_VECTOR_TIMER2.
+ */
+static void BENCH_measure( u8 u8_a_vector )
+{
+	u16 u16_l_trial;
+	u16 u16_l_offset = 0xFFFF;
+	u16 u16_l_cycles;
+
+	/* Step 1: Offset, interrupt disabled */
+	CLR_BIT( BENCH_U8_GICR_REG, BENCH_U8_INT2_BIT );
+	CLR_BIT( BENCH_U8_TIMSK_REG, BENCH_U8_TOIE2_BIT );
+	for ( u16_l_trial = 0; u16_l_trial < BENCH_U16_TRIALS; u16_l_trial++ )
+	{
+		u16_l_cycles = BENCH_trial( u8_a_vector );
+		if ( u16_l_cycles < u16_l_offset ) u16_l_offset = u16_l_cycles;
+	}
+
+	/* Step 2: Trials, interrupt enabled, without the flag left by the last offset trial */
+	BENCH_U8_GIFR_REG = ( 1 << BENCH_U8_INT2_BIT );
+	BENCH_U8_TIFR_REG = ( 1 << BENCH_U8_TOIE2_BIT );
+	if ( u8_a_vector == BENCH_U8_VECTOR_INT2 ) SET_BIT( BENCH_U8_GICR_REG, BENCH_U8_INT2_BIT );
+	else                                       SET_BIT( BENCH_U8_TIMSK_REG, BENCH_U8_TOIE2_BIT );
+	for ( u16_l_trial = 0; u16_l_trial < BENCH_U16_TRIALS; u16_l_trial++ )
+	{
+		u16_l_cycles = BENCH_trial( u8_a_vector ) - u16_l_offset;
+		if ( u16_l_cycles < au16_gs_min[u8_a_vector] ) au16_gs_min[u8_a_vector] = u16_l_cycles;
+		if ( u16_l_cycles > au16_gs_max[u8_a_vector] ) au16_gs_max[u8_a_vector] = u16_l_cycles;
+	}
+
+	CLR_BIT( BENCH_U8_GICR_REG, BENCH_U8_INT2_BIT );
+	CLR_BIT( BENCH_U8_TIMSK_REG, BENCH_U8_TOIE2_BIT );
+}
+
+static void BENCH_report( void )
+{
+	u16 u16_l_ticks;
+
+#if EXI_U8_STATIC_BINDING == STD_OK
+	BENCH_putString( "\r\nISR bench, EXI compile-time binding" );
+#else
+	BENCH_putString( "\r\nISR bench, EXI runtime binding" );
+#endif
+#if TIMER_U8_STATIC_BINDING == STD_OK
+	BENCH_putString( ", TIMER compile-time binding" );
+#else
+	BENCH_putString( ", TIMER runtime binding" );
+#endif
+	BENCH_putNumber( "\r\ntrials        : ", BENCH_U16_TRIALS );
+	BENCH_putNumber( "\r\nINT2 min      : ", au16_gs_min[BENCH_U8_VECTOR_INT2] );
+	BENCH_putNumber( "\r\nINT2 max      : ", au16_gs_max[BENCH_U8_VECTOR_INT2] );
+	BENCH_putNumber( "\r\nTimer2 OVF min: ", au16_gs_min[BENCH_U8_VECTOR_TIMER2] );
+	BENCH_putNumber( "\r\nTimer2 OVF max: ", au16_gs_max[BENCH_U8_VECTOR_TIMER2] );
+
+	/* Handlers ran once per trial */
+	ENC_getTicks( &u16_l_ticks );
+	BENCH_putNumber( "\r\nencoder ticks : ", u16_l_ticks );
+	BENCH_putNumber( "\r\nstop flag     : ", en_g_stopFlag );
+	BENCH_putString( "\r\n" );
+}
+
+int main( void )
+{
+	/* Step 1: USART, Timer1 counts CPU cycles */
+	BENCH_U8_UBRRL_REG = BENCH_U8_UBRR_38400;
+	BENCH_U8_UCSRC_REG = BENCH_U8_UCSRC_8N1;
+	SET_BIT( BENCH_U8_UCSRB_REG, BENCH_U8_TXEN_BIT );
+	BENCH_U8_TCCR1B_REG = BENCH_U8_CS10;
+
+	/* Step 2: Encoder and Timer2 through their drivers, callbacks set as in the car, then PB2 driven by the bench */
+	ENC_init();
+	TIMER_timer2NormalModeInit( ENABLED, 0 );
+	TIMER_ovfSetCallback( &DCM_updateStopFlag );
+	SET_BIT( BENCH_U8_DDRB_REG, BENCH_U8_INT2_PIN );
+
+	/* Step 3: Trials */
+	BENCH_measure( BENCH_U8_VECTOR_INT2 );
+	BENCH_measure( BENCH_U8_VECTOR_TIMER2 );
+
+	BENCH_report();
+
+	while ( 1 );
+}
@@ -0,0 +1,641 @@
+/*
+ * krn_test.c
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: Host test of the preemptive kernel ( SERVICE/krn ): the kernel source runs with its task switching
+ *                 decisions, tick handling, semaphores and queues unchanged, over a simulated SREG and tick ISR.
+ *
+ * Each kernel task runs on its own host stack ( ucontext ). The few assembly statements of the kernel are executed by
+ * SIM_asm instead of the AVR: KRN_SAVE_CONTEXT records the outgoing task and its SREG, then clears the I bit, and
+ * KRN_RESTORE_CONTEXT switches to the task pst_g_krnCurrentTcb points to, and restores its SREG. The AVR register
+ * save and restore themselves, the 35 bytes frame layout and the stack pointer values are NOT executed on the host,
+ * they are only checked through the frame size KRN_getStackFree reports.
+ *
+ * Time only passes in SIM_tick: a task calls it to stand for one tick of computing, the idle task calls it forever.
+ * It checks the I bit is set ( a tick may only interrupt task code ), runs the ISR hook of the scenario ( an EXI
+ * callback giving a semaphore or sending an item ), then the tick ISR __vector_8.
+ *
+ * Checks:
+ *  1. KRN_createTask and KRN_getStackFree refuse invalid arguments, a new context takes 35 bytes of its stack.
+ *  2. Delays: two delayed tasks wake on every multiple of their delays, the higher priority one first, preempting
+ *     a background task that never blocks, and the idle task never runs while that task is ready.
+ *  3. Semaphores: a give wakes the waiting task of higher priority inside KRN_semGive, a tick wakes a higher priority
+ *     task inside the computing of a lower one, a take times out after exactly its ticks, and leaves the semaphore,
+ *     NO_WAIT never blocks, a give from an ISR wakes the waiting task on that tick, or is kept for the next take, and
+ *     a full count refuses a give.
+ *  4. Queues: items are received in order, a send wakes the waiting receiver at once, a full queue refuses a send
+ *     from a task and from an ISR, a receive times out after exactly its ticks, and an item sent from an ISR wakes
+ *     the receiver on that tick.
+ * and after each scenario: the kernel ticks equal the simulated ticks, and every task script reached its end.
+ *
+ * Build and run:
+ *  gcc -std=gnu11 -O2 -I"../../Moving Car" krn_test.c -o krn_test
+ *  ./krn_test
+ * Exits with 0 if every check passed.
+ */
+
+/* LIB */
+#include "LIB/std.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+
+/* The kernel assembly statements are run by SIM_asm, the naked and signal attributes are AVR only */
+static void SIM_asm( const char * pu8_a_text );
+#define __asm__
+#define __volatile__( TEXT )						SIM_asm( TEXT )
+#define naked
+#define signal
+
+/* Kernel under test, built in whatever the car build says */
+#define KRN_U8_ENABLE		STD_OK
+#include "SERVICE/krn/krn_config.h"
+#include "SERVICE/krn/krn_interface.h"
+#include "SERVICE/krn/krn_private.h"
+
+/* Simulated SREG, only its I bit is used */
+static u8 u8_gs_simSreg = 0;
+
+#undef  KRN_U8_SREG_REG
+#define KRN_U8_SREG_REG								u8_gs_simSreg
+
+/* GLI critical sections save and clear the simulated SREG */
+#undef  GLI_ENTER_CRITICAL
+#undef  GLI_EXIT_CRITICAL
+#define GLI_ENTER_CRITICAL( SREG_COPY, SITE_ID )	do { ( SREG_COPY ) = u8_gs_simSreg; CLR_BIT( u8_gs_simSreg, KRN_U8_I_BIT ); } while ( 0 )
+#define GLI_EXIT_CRITICAL( SREG_COPY )				do { u8_gs_simSreg = ( SREG_COPY ); } while ( 0 )
+
+/* The AVR stack pointer and return address are 16 bits wide, they are not used on the host */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpointer-to-int-cast"
+#include "SERVICE/krn/krn_program.c"
+#pragma GCC diagnostic pop
+
+/* ***********************************************************************************************/
+/* Test Configurations */
+
+#define SIM_U32_HOST_STACK_SIZE		65536
+
+/* AVR context frame: return address, r0, SREG, r1 to r31 */
+#define TEST_U16_FRAME_SIZE			35
+
+#define TEST_U16_LOG_SIZE			4096
+
+/* Scenario 1: delays of the two delayed tasks */
+#define TEST_U16_DELAY_0			5
+#define TEST_U16_DELAY_1			7
+#define TEST_U32_DELAYS_TICKS		700
+
+/* Scenario 2: ISR gives, the semaphore take timeout, and the ticks computed between two gives */
+#define TEST_U32_ISR_GIVE_TICK_1	50
+#define TEST_U32_ISR_GIVE_TICK_2	60
+#define TEST_U16_TAKE_TIMEOUT		4
+#define TEST_U8_GIVE_PERIOD			3
+#define TEST_U32_SEMS_TICKS			300
+
+/* Scenario 3: queue size, items sent one by one, receiver delay, ISR send ticks */
+#define TEST_U8_QUEUE_SIZE			4
+#define TEST_U8_SINGLE_ITEMS		20
+#define TEST_U8_BURST_ITEMS			6
+#define TEST_U16_RECEIVER_DELAY		30
+#define TEST_U16_RECEIVE_TIMEOUT	5
+#define TEST_U32_ISR_SEND_TICK		100
+#define TEST_U8_ISR_ITEM			200
+#define TEST_U32_ISR_FILL_TICK		110
+#define TEST_U32_QUEUES_TICKS		150
+
+/* Log events */
+#define TEST_U8_EVENT_RUN			0
+#define TEST_U8_EVENT_GIVE			1
+#define TEST_U8_EVENT_GIVEN			2
+#define TEST_U8_EVENT_TAKEN			3
+
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+/* One host context per kernel task, index = priority */
+static ucontext_t st_gs_simContexts[KRN_U8_MAX_TASKS + 1];
+static u8 *apu8_gs_simStacks[KRN_U8_MAX_TASKS + 1];
+static u8 au8_gs_simStarted[KRN_U8_MAX_TASKS + 1];
+static u8 au8_gs_simSavedSreg[KRN_U8_MAX_TASKS + 1];
+static void ( *apf_gs_simBodies[KRN_U8_MAX_TASKS + 1] ) ( void );
+
+/* Task saved by the last KRN_SAVE_CONTEXT, NULL before KRN_start */
+static ST_KRN_tcb_t *pst_gs_simOutgoing = NULL;
+
+/* Context of the test, resumed when the scenario time is over */
+static ucontext_t st_gs_simEnd;
+
+static u32 u32_gs_simTicks = 0;
+static u32 u32_gs_simEndTick = 0;
+static u32 u32_gs_simIdleTicks = 0;
+
+/* EXI callback run just before a tick, NULL if none */
+static void ( *pf_gs_simIsrHook ) ( void ) = NULL;
+
+/* Log of the task events */
+static u8  au8_gs_testLogTask[TEST_U16_LOG_SIZE];
+static u8  au8_gs_testLogEvent[TEST_U16_LOG_SIZE];
+static u32 au32_gs_testLogTick[TEST_U16_LOG_SIZE];
+static u16 u16_gs_testLogSize = 0;
+
+/* One bit per task script that reached its end */
+static u8  u8_gs_testDoneBits = 0;
+
+static ST_KRN_sem_t   st_gs_testSemA;
+static ST_KRN_sem_t   st_gs_testSemB;
+static ST_KRN_queue_t st_gs_testQueue;
+static u8 au8_gs_testQueueBuffer[TEST_U8_QUEUE_SIZE];
+
+static u32 u32_gs_testFailures = 0;
+
+/* ***********************************************************************************************/
+/* Checks */
+
+static void TEST_check( u8 u8_a_condition, const char * pu8_a_step, const char * pu8_a_what )
+{
+	if ( u8_a_condition ) return;
+
+	u32_gs_testFailures++;
+	if ( u32_gs_testFailures <= 10 ) printf( "FAIL %s: %s\n", pu8_a_step, pu8_a_what );
+}
+
+static u32 TEST_ticks( void )
+{
+	u32 u32_l_ticks = 0;
+
+	KRN_getTicks( &u32_l_ticks );
+	return u32_l_ticks;
+}
+
+static void TEST_log( u8 u8_a_task, u8 u8_a_event )
+{
+	if ( u16_gs_testLogSize == TEST_U16_LOG_SIZE ) return;
+
+	au8_gs_testLogTask[u16_gs_testLogSize]  = u8_a_task;
+	au8_gs_testLogEvent[u16_gs_testLogSize] = u8_a_event;
+	au32_gs_testLogTick[u16_gs_testLogSize] = TEST_ticks();
+	u16_gs_testLogSize++;
+}
+
+/* ***********************************************************************************************/
+/* Simulated MCU */
+
+EN_TIMER_ERROR_T TIMER_timer1CtcInit      ( u16 u16_a_compareValue ) { ( void ) u16_a_compareValue; return TIMER_OK; }
+EN_TIMER_ERROR_T TIMER_timer1CompBTickInit( u16 u16_a_compareValue ) { ( void ) u16_a_compareValue; return TIMER_OK; }
+EN_TIMER_ERROR_T TIMER_timer1Start        ( u16 u16_a_prescaler )    { ( void ) u16_a_prescaler;    return TIMER_OK; }
+
+static u8 SIM_priority( ST_KRN_tcb_t * pst_a_tcb )
+{
+	return ( u8 ) ( pst_a_tcb - st_gs_krnTcbs );
+}
+
+/* First run of a task: SREG of a new context, then its body, which never returns */
+static void SIM_taskEntry( void )
+{
+	u8_gs_simSreg = KRN_U8_INITIAL_SREG;
+
+	apf_gs_simBodies[SIM_priority( pst_g_krnCurrentTcb )]();
+
+	printf( "FAIL task %u returned\n", SIM_priority( pst_g_krnCurrentTcb ) );
+	exit( 1 );
+}
+
+/* KRN_SAVE_CONTEXT: the registers stay on the host stack, SREG is saved, and interrupts are disabled */
+static void SIM_saveContext( void )
+{
+	pst_gs_simOutgoing = pst_g_krnCurrentTcb;
+	au8_gs_simSavedSreg[SIM_priority( pst_g_krnCurrentTcb )] = u8_gs_simSreg;
+	CLR_BIT( u8_gs_simSreg, KRN_U8_I_BIT );
+}
+
+/* KRN_RESTORE_CONTEXT: switch to the selected task, and restore the SREG it saved */
+static void SIM_restoreContext( void )
+{
+	ST_KRN_tcb_t *pst_l_outgoing = pst_gs_simOutgoing;
+	u8 u8_l_next = SIM_priority( pst_g_krnCurrentTcb );
+	u8 u8_l_self;
+
+	pst_gs_simOutgoing = NULL;
+
+	/* Check 1: Same task selected again, only SREG is popped */
+	if ( pst_l_outgoing == pst_g_krnCurrentTcb )
+	{
+		u8_gs_simSreg = au8_gs_simSavedSreg[u8_l_next];
+		return;
+	}
+
+	/* Check 2: Task never run, its context starts at its body */
+	if ( au8_gs_simStarted[u8_l_next] == 0 )
+	{
+		getcontext( &st_gs_simContexts[u8_l_next] );
+		st_gs_simContexts[u8_l_next].uc_stack.ss_sp   = apu8_gs_simStacks[u8_l_next];
+		st_gs_simContexts[u8_l_next].uc_stack.ss_size = SIM_U32_HOST_STACK_SIZE;
+		st_gs_simContexts[u8_l_next].uc_link          = NULL;
+		makecontext( &st_gs_simContexts[u8_l_next], &SIM_taskEntry, 0 );
+		au8_gs_simStarted[u8_l_next] = 1;
+	}
+
+	/* Check 3: KRN_start, nothing to come back to */
+	if ( pst_l_outgoing == NULL ) setcontext( &st_gs_simContexts[u8_l_next] );
+
+	u8_l_self = SIM_priority( pst_l_outgoing );
+	swapcontext( &st_gs_simContexts[u8_l_self], &st_gs_simContexts[u8_l_next] );
+
+	/* Selected again by a later switch */
+	u8_gs_simSreg = au8_gs_simSavedSreg[u8_l_self];
+}
+
+static void SIM_asm( const char * pu8_a_text )
+{
+	if      ( strncmp( pu8_a_text, "push r0", 7 ) == 0 )      SIM_saveContext();
+	else if ( strncmp( pu8_a_text, "lds  r26", 8 ) == 0 )     SIM_restoreContext();
+	else if ( strcmp( pu8_a_text, "call KRN_selectTask" ) == 0 )    KRN_selectTask();
+	else if ( strcmp( pu8_a_text, "call KRN_tickHandler" ) == 0 )   KRN_tickHandler();
+	else if ( strcmp( pu8_a_text, "call KRN_yieldFromTick" ) == 0 ) KRN_yieldFromTick();
+	else if ( ( strcmp( pu8_a_text, "ret" ) == 0 ) || ( strcmp( pu8_a_text, "reti" ) == 0 ) ) return;
+	else
+	{
+		printf( "FAIL unknown assembly: %s\n", pu8_a_text );
+		exit( 1 );
+	}
+}
+
+/* One tick of task code: the ISR hook, then the tick ISR, ends the scenario when its time is over */
+static void SIM_tick( void )
+{
+	TEST_check( GET_BIT( u8_gs_simSreg, KRN_U8_I_BIT ) == 1, "tick", "interrupts disabled in task code" );
+
+	if ( u32_gs_simTicks == u32_gs_simEndTick ) setcontext( &st_gs_simEnd );
+	u32_gs_simTicks++;
+
+	if ( pf_gs_simIsrHook != NULL )
+	{
+		CLR_BIT( u8_gs_simSreg, KRN_U8_I_BIT );
+		pf_gs_simIsrHook();
+		SET_BIT( u8_gs_simSreg, KRN_U8_I_BIT );
+	}
+
+	/* Interrupt response clears I, reti sets it back, possibly in another task much later */
+	CLR_BIT( u8_gs_simSreg, KRN_U8_I_BIT );
+	__vector_8();
+	SET_BIT( u8_gs_simSreg, KRN_U8_I_BIT );
+}
+
+static void SIM_idleTask( void )
+{
+	while ( 1 )
+	{
+		u32_gs_simIdleTicks++;
+		SIM_tick();
+	}
+}
+
+/* Creates a kernel task, and records its body for its first run */
+static EN_KRN_ERROR_T SIM_createTask( u8 u8_a_priority, void ( *pf_a_task ) ( void ) )
+{
+	if ( u8_a_priority < KRN_U8_MAX_TASKS ) apf_gs_simBodies[u8_a_priority] = pf_a_task;
+
+	return KRN_createTask( u8_a_priority, pf_a_task );
+}
+
+/* Prepares a scenario: kernel initialized, simulation and log cleared */
+static void SIM_init( void ( *pf_a_isrHook ) ( void ) )
+{
+	u8 u8_l_priority;
+
+	for ( u8_l_priority = 0; u8_l_priority <= KRN_U8_MAX_TASKS; u8_l_priority++ ) au8_gs_simStarted[u8_l_priority] = 0;
+	apf_gs_simBodies[KRN_U8_IDLE_PRIORITY] = &SIM_idleTask;
+
+	pst_gs_simOutgoing  = NULL;
+	u32_gs_simTicks     = 0;
+	u32_gs_simIdleTicks = 0;
+	pf_gs_simIsrHook    = pf_a_isrHook;
+	u16_gs_testLogSize  = 0;
+	u8_gs_testDoneBits  = 0;
+	u8_gs_simSreg       = 0;
+
+	KRN_init();
+}
+
+/* Starts the kernel, and returns once the given ticks elapsed */
+static void SIM_run( const char * pu8_a_step, u32 u32_a_ticks, u8 u8_a_doneBits )
+{
+	volatile u8 u8_l_ended = 0;
+
+	u32_gs_simEndTick = u32_a_ticks;
+
+	getcontext( &st_gs_simEnd );
+	if ( u8_l_ended == 0 )
+	{
+		u8_l_ended = 1;
+		KRN_start();
+	}
+
+	TEST_check( TEST_ticks() == u32_gs_simTicks, pu8_a_step, "kernel ticks differ from the simulated ticks" );
+	TEST_check( u8_gs_testDoneBits == u8_a_doneBits, pu8_a_step, "a task script did not reach its end" );
+	TEST_check( u16_gs_testLogSize < TEST_U16_LOG_SIZE, pu8_a_step, "log full" );
+}
+
+/* ***********************************************************************************************/
+/* Check 1: Refused arguments, and the new context frame */
+
+static void TEST_idleBody( void ) { while ( 1 ); }
+
+static void TEST_arguments( void )
+{
+	u16 u16_l_free = 0;
+
+	SIM_init( NULL );
+
+	TEST_check( KRN_getStackFree( KRN_U8_IDLE_PRIORITY, &u16_l_free ) == KRN_OK, "arguments", "idle stack refused" );
+	TEST_check( u16_l_free == KRN_U16_IDLE_STACK_SIZE - TEST_U16_FRAME_SIZE, "arguments", "wrong idle context frame size" );
+	TEST_check( KRN_getStackFree( KRN_U8_IDLE_PRIORITY + 1, &u16_l_free ) == KRN_ERROR, "arguments", "invalid priority accepted" );
+	TEST_check( KRN_getStackFree( 0, NULL ) == KRN_ERROR, "arguments", "NULL pointer accepted" );
+
+	TEST_check( KRN_createTask( KRN_U8_MAX_TASKS, &TEST_idleBody ) == KRN_ERROR, "arguments", "idle priority accepted" );
+	TEST_check( KRN_createTask( 0, NULL ) == KRN_ERROR, "arguments", "NULL body accepted" );
+	TEST_check( KRN_createTask( 0, &TEST_idleBody ) == KRN_OK, "arguments", "task refused" );
+	TEST_check( KRN_createTask( 0, &TEST_idleBody ) == KRN_ERROR, "arguments", "priority taken twice" );
+
+	TEST_check( KRN_getStackFree( 0, &u16_l_free ) == KRN_OK, "arguments", "task stack refused" );
+	TEST_check( u16_l_free == KRN_U16_TASK0_STACK_SIZE - TEST_U16_FRAME_SIZE, "arguments", "wrong task context frame size" );
+
+	TEST_check( KRN_semInit( NULL, 0 ) == KRN_ERROR, "arguments", "NULL semaphore accepted" );
+	TEST_check( KRN_queueInit( &st_gs_testQueue, au8_gs_testQueueBuffer, 0 ) == KRN_ERROR, "arguments", "queue size 0 accepted" );
+	TEST_check( KRN_queueInit( &st_gs_testQueue, NULL, TEST_U8_QUEUE_SIZE ) == KRN_ERROR, "arguments", "NULL buffer accepted" );
+}
+
+/* ***********************************************************************************************/
+/* Check 2: Delays */
+
+static void TEST_delayTask0( void )
+{
+	while ( 1 )
+	{
+		TEST_log( 0, TEST_U8_EVENT_RUN );
+		KRN_delay( TEST_U16_DELAY_0 );
+	}
+}
+
+static void TEST_delayTask1( void )
+{
+	while ( 1 )
+	{
+		TEST_log( 1, TEST_U8_EVENT_RUN );
+		KRN_delay( TEST_U16_DELAY_1 );
+	}
+}
+
+/* Background task, computes forever */
+static void TEST_busyTask( void )
+{
+	while ( 1 ) SIM_tick();
+}
+
+static void TEST_delays( void )
+{
+	u16 u16_l_entry = 0;
+	u32 u32_l_tick;
+	u8  u8_l_ok = 1;
+
+	SIM_init( NULL );
+	SIM_createTask( 0, &TEST_delayTask0 );
+	SIM_createTask( 1, &TEST_delayTask1 );
+	SIM_createTask( 3, &TEST_busyTask );
+	SIM_run( "delays", TEST_U32_DELAYS_TICKS, 0 );
+
+	/* Task 0 on every multiple of its delay, task 1 on every multiple of its own, task 0 first on common ticks, up to the last tick run */
+	for ( u32_l_tick = 0; u32_l_tick <= TEST_U32_DELAYS_TICKS; u32_l_tick++ )
+	{
+		if ( u32_l_tick % TEST_U16_DELAY_0 == 0 )
+		{
+			u8_l_ok &= ( u16_l_entry < u16_gs_testLogSize ) && ( au8_gs_testLogTask[u16_l_entry] == 0 ) && ( au32_gs_testLogTick[u16_l_entry] == u32_l_tick );
+			u16_l_entry++;
+		}
+		if ( u32_l_tick % TEST_U16_DELAY_1 == 0 )
+		{
+			u8_l_ok &= ( u16_l_entry < u16_gs_testLogSize ) && ( au8_gs_testLogTask[u16_l_entry] == 1 ) && ( au32_gs_testLogTick[u16_l_entry] == u32_l_tick );
+			u16_l_entry++;
+		}
+	}
+
+	TEST_check( u8_l_ok && ( u16_l_entry == u16_gs_testLogSize ), "delays", "delayed tasks did not run exactly on their ticks, in priority order" );
+	TEST_check( u32_gs_simIdleTicks == 0, "delays", "idle task ran while a task was ready" );
+}
+
+/* ***********************************************************************************************/
+/* Check 3: Semaphores */
+
+static void TEST_semIsrHook( void )
+{
+	if ( ( u32_gs_simTicks == TEST_U32_ISR_GIVE_TICK_1 ) || ( u32_gs_simTicks == TEST_U32_ISR_GIVE_TICK_2 ) )
+	{
+		TEST_check( KRN_semGiveFromIsr( &st_gs_testSemB ) == KRN_OK, "semaphores", "give from ISR refused" );
+	}
+}
+
+/* Timeouts, NO_WAIT, and the ISR gives */
+static void TEST_semTask0( void )
+{
+	ST_KRN_sem_t st_l_full;
+	u32 u32_l_start = TEST_ticks();
+
+	TEST_check( KRN_semTake( &st_gs_testSemB, TEST_U16_TAKE_TIMEOUT ) == KRN_ERROR, "semaphores", "take did not time out" );
+	TEST_check( TEST_ticks() == u32_l_start + TEST_U16_TAKE_TIMEOUT, "semaphores", "take timed out on a wrong tick" );
+	TEST_check( st_gs_testSemB.u8_waitBits == 0, "semaphores", "timed out task still waits on the semaphore" );
+
+	TEST_check( KRN_semTake( &st_gs_testSemB, KRN_U16_NO_WAIT ) == KRN_ERROR, "semaphores", "NO_WAIT take of an empty semaphore succeeded" );
+	TEST_check( TEST_ticks() == u32_l_start + TEST_U16_TAKE_TIMEOUT, "semaphores", "NO_WAIT take blocked" );
+
+	/* Computes one tick, the takes gave the interrupts back */
+	SIM_tick();
+
+	/* First ISR give wakes the task on its tick */
+	TEST_check( KRN_semTake( &st_gs_testSemB, 2 * TEST_U32_ISR_GIVE_TICK_1 ) == KRN_OK, "semaphores", "ISR give not taken" );
+	TEST_check( TEST_ticks() == TEST_U32_ISR_GIVE_TICK_1, "semaphores", "ISR give woke the task on a wrong tick" );
+
+	/* Second ISR give while no task waits, kept for the next take */
+	KRN_delay( TEST_U32_ISR_GIVE_TICK_2 - TEST_U32_ISR_GIVE_TICK_1 + 1 );
+	TEST_check( KRN_semTake( &st_gs_testSemB, KRN_U16_NO_WAIT ) == KRN_OK, "semaphores", "kept ISR give not taken" );
+
+	TEST_check( KRN_semInit( &st_l_full, 0xFF ) == KRN_OK, "semaphores", "init refused" );
+	TEST_check( KRN_semGive( &st_l_full ) == KRN_ERROR, "semaphores", "give to a full count accepted" );
+
+	SET_BIT( u8_gs_testDoneBits, 0 );
+	while ( 1 ) KRN_delay( KRN_U16_WAIT_FOREVER );
+}
+
+/* Taker of the gives of task 2 */
+static void TEST_semTask1( void )
+{
+	while ( 1 )
+	{
+		TEST_check( KRN_semTake( &st_gs_testSemA, KRN_U16_WAIT_FOREVER ) == KRN_OK, "semaphores", "take without timeout failed" );
+		TEST_log( 1, TEST_U8_EVENT_TAKEN );
+	}
+}
+
+/* Computes, then gives */
+static void TEST_semTask2( void )
+{
+	u8 u8_l_tick;
+
+	while ( 1 )
+	{
+		for ( u8_l_tick = 0; u8_l_tick < TEST_U8_GIVE_PERIOD; u8_l_tick++ ) SIM_tick();
+
+		TEST_log( 2, TEST_U8_EVENT_GIVE );
+		TEST_check( KRN_semGive( &st_gs_testSemA ) == KRN_OK, "semaphores", "give refused" );
+		TEST_log( 2, TEST_U8_EVENT_GIVEN );
+	}
+}
+
+static void TEST_semaphores( void )
+{
+	u16 u16_l_entry;
+	u16 u16_l_gives = 0;
+	u8  u8_l_ok = 1;
+
+	SIM_init( &TEST_semIsrHook );
+	KRN_semInit( &st_gs_testSemA, 0 );
+	KRN_semInit( &st_gs_testSemB, 0 );
+	SIM_createTask( 0, &TEST_semTask0 );
+	SIM_createTask( 1, &TEST_semTask1 );
+	SIM_createTask( 2, &TEST_semTask2 );
+	SIM_run( "semaphores", TEST_U32_SEMS_TICKS, 0x01 );
+
+	/* Every give is taken inside KRN_semGive: give, taken, given, on the same tick */
+	for ( u16_l_entry = 0; u16_l_entry + 2 < u16_gs_testLogSize; u16_l_entry += 3 )
+	{
+		u8_l_ok &= ( au8_gs_testLogTask[u16_l_entry] == 2 ) && ( au8_gs_testLogEvent[u16_l_entry] == TEST_U8_EVENT_GIVE );
+		u8_l_ok &= ( au8_gs_testLogTask[u16_l_entry + 1] == 1 ) && ( au8_gs_testLogEvent[u16_l_entry + 1] == TEST_U8_EVENT_TAKEN );
+		u8_l_ok &= ( au8_gs_testLogTask[u16_l_entry + 2] == 2 ) && ( au8_gs_testLogEvent[u16_l_entry + 2] == TEST_U8_EVENT_GIVEN );
+		u8_l_ok &= ( au32_gs_testLogTick[u16_l_entry] == au32_gs_testLogTick[u16_l_entry + 2] );
+		u16_l_gives++;
+	}
+
+	TEST_check( u8_l_ok, "semaphores", "give did not switch to the waiting task of higher priority at once" );
+	/* Task 2 computed every tick but the one of task 0 */
+	TEST_check( u16_l_gives == ( TEST_U32_SEMS_TICKS - 1 ) / TEST_U8_GIVE_PERIOD, "semaphores", "wrong number of gives" );
+	TEST_check( u32_gs_simIdleTicks == 0, "semaphores", "idle task ran while a task was ready" );
+}
+
+/* ***********************************************************************************************/
+/* Check 4: Queues */
+
+static void TEST_queueIsrHook( void )
+{
+	u8 u8_l_item;
+
+	if ( u32_gs_simTicks == TEST_U32_ISR_SEND_TICK )
+	{
+		TEST_check( KRN_queueSendFromIsr( &st_gs_testQueue, TEST_U8_ISR_ITEM ) == KRN_OK, "queues", "send from ISR refused" );
+	}
+	else if ( u32_gs_simTicks == TEST_U32_ISR_FILL_TICK )
+	{
+		for ( u8_l_item = 0; u8_l_item < TEST_U8_QUEUE_SIZE; u8_l_item++ )
+		{
+			TEST_check( KRN_queueSendFromIsr( &st_gs_testQueue, u8_l_item ) == KRN_OK, "queues", "send from ISR refused" );
+		}
+		TEST_check( KRN_queueSendFromIsr( &st_gs_testQueue, u8_l_item ) == KRN_ERROR, "queues", "send from ISR to a full queue accepted" );
+	}
+}
+
+/* Receiver */
+static void TEST_queueTask0( void )
+{
+	u8  u8_l_expected;
+	u8  u8_l_item = 0;
+	u32 u32_l_start;
+
+	/* Single items, each one received as soon as it is sent */
+	for ( u8_l_expected = 0; u8_l_expected < TEST_U8_SINGLE_ITEMS; u8_l_expected++ )
+	{
+		TEST_check( KRN_queueReceive( &st_gs_testQueue, &u8_l_item, KRN_U16_WAIT_FOREVER ) == KRN_OK, "queues", "receive failed" );
+		TEST_check( u8_l_item == u8_l_expected, "queues", "single items received out of order" );
+	}
+
+	/* The burst fills the queue meanwhile */
+	KRN_delay( TEST_U16_RECEIVER_DELAY );
+	for ( u8_l_expected = TEST_U8_SINGLE_ITEMS; u8_l_expected < TEST_U8_SINGLE_ITEMS + TEST_U8_QUEUE_SIZE; u8_l_expected++ )
+	{
+		TEST_check( KRN_queueReceive( &st_gs_testQueue, &u8_l_item, KRN_U16_NO_WAIT ) == KRN_OK, "queues", "stored item not received" );
+		TEST_check( u8_l_item == u8_l_expected, "queues", "stored items received out of order" );
+	}
+	TEST_check( KRN_queueReceive( &st_gs_testQueue, &u8_l_item, KRN_U16_NO_WAIT ) == KRN_ERROR, "queues", "item received from an empty queue" );
+
+	u32_l_start = TEST_ticks();
+	TEST_check( KRN_queueReceive( &st_gs_testQueue, &u8_l_item, TEST_U16_RECEIVE_TIMEOUT ) == KRN_ERROR, "queues", "receive did not time out" );
+	TEST_check( TEST_ticks() == u32_l_start + TEST_U16_RECEIVE_TIMEOUT, "queues", "receive timed out on a wrong tick" );
+
+	/* Computes one tick, the receives gave the interrupts back */
+	SIM_tick();
+
+	/* Item sent from an ISR wakes the receiver on that tick */
+	TEST_check( KRN_queueReceive( &st_gs_testQueue, &u8_l_item, KRN_U16_WAIT_FOREVER ) == KRN_OK, "queues", "ISR item not received" );
+	TEST_check( u8_l_item == TEST_U8_ISR_ITEM, "queues", "wrong ISR item" );
+	TEST_check( TEST_ticks() == TEST_U32_ISR_SEND_TICK, "queues", "ISR item woke the receiver on a wrong tick" );
+
+	SET_BIT( u8_gs_testDoneBits, 0 );
+	while ( 1 ) KRN_delay( KRN_U16_WAIT_FOREVER );
+}
+
+/* Sender */
+static void TEST_queueTask3( void )
+{
+	u8 u8_l_item;
+
+	for ( u8_l_item = 0; u8_l_item < TEST_U8_SINGLE_ITEMS; u8_l_item++ )
+	{
+		TEST_check( KRN_queueSend( &st_gs_testQueue, u8_l_item ) == KRN_OK, "queues", "send refused" );
+		TEST_check( st_gs_testQueue.u8_used == 0, "queues", "waiting receiver did not take the item at once" );
+		SIM_tick();
+	}
+
+	/* Burst while the receiver is delayed */
+	for ( ; u8_l_item < TEST_U8_SINGLE_ITEMS + TEST_U8_BURST_ITEMS; u8_l_item++ )
+	{
+		TEST_check( KRN_queueSend( &st_gs_testQueue, u8_l_item ) == ( ( u8_l_item < TEST_U8_SINGLE_ITEMS + TEST_U8_QUEUE_SIZE ) ? KRN_OK : KRN_ERROR ),
+		            "queues", "send to a full queue accepted, or to a free one refused" );
+	}
+
+	SET_BIT( u8_gs_testDoneBits, 3 );
+	while ( 1 ) KRN_delay( KRN_U16_WAIT_FOREVER );
+}
+
+static void TEST_queues( void )
+{
+	SIM_init( &TEST_queueIsrHook );
+	TEST_check( KRN_queueInit( &st_gs_testQueue, au8_gs_testQueueBuffer, TEST_U8_QUEUE_SIZE ) == KRN_OK, "queues", "init refused" );
+	SIM_createTask( 0, &TEST_queueTask0 );
+	SIM_createTask( 3, &TEST_queueTask3 );
+	SIM_run( "queues", TEST_U32_QUEUES_TICKS, 0x09 );
+
+	TEST_check( st_gs_testQueue.u8_used == TEST_U8_QUEUE_SIZE, "queues", "ISR items not stored" );
+}
+
+/* ***********************************************************************************************/
+
+int main( void )
+{
+	u8 u8_l_priority;
+
+	for ( u8_l_priority = 0; u8_l_priority <= KRN_U8_MAX_TASKS; u8_l_priority++ )
+	{
+		apu8_gs_simStacks[u8_l_priority] = malloc( SIM_U32_HOST_STACK_SIZE );
+		if ( apu8_gs_simStacks[u8_l_priority] == NULL ) return 2;
+	}
+
+	TEST_arguments();
+	TEST_delays();
+	TEST_semaphores();
+	TEST_queues();
+
+	printf( "krn_test: %lu failures: %s\n", ( unsigned long ) u32_gs_testFailures, ( u32_gs_testFailures == 0 ) ? "PASS" : "FAIL" );
+
+	return ( u32_gs_testFailures == 0 ) ? 0 : 1;
+}
@@ -0,0 +1,433 @@
+#!/usr/bin/env python3
+"""
+msn_asm.py
+
+  Created on: Oct 18, 2026
+      Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ Description: Host assembler/disassembler for the Mission Interpreter (MSN) bytecode.
+              The encoding is documented in "Moving Car/SERVICE/msn/msn_interface.h".
+
+Usage:
+  msn_asm.py asm patrol.msn -o patrol.hex        Assemble to an Intel HEX EEPROM image
+  msn_asm.py asm patrol.msn -o patrol.bin        Assemble to a raw image ( header + instructions )
+  msn_asm.py dis patrol.hex                      Disassemble an image
+
+Load the EEPROM image with: avrdude -p m32 -c <programmer> -U eeprom:w:patrol.hex:i
+
+Source syntax ( one instruction per line, ';' starts a comment, 'name:' defines a label ):
+  END                       Mission done
+  MOVE  speed, time         Forward, speed 10 -> 100 % ( step 10 ), time 50 -> 12750 msec. ( step 50 )
+  TURN  quarters            Right turn, 1 -> 31 quarter turns
+  WAIT  time                Stand still, 100 -> 25500 msec. ( step 100 )
+  LED   mask                LEDs 0 -> 3, e.g. 0b0101
+  LOOP  count | FOREVER     Run the block up to NEXT 1 -> 31 times, or forever
+  NEXT                      End of the innermost LOOP block
+  BR    sensor, label       Branch if the sensor is set
+  BRN   sensor, label       Branch if the sensor is clear
+  JMP   label               Branch always
+Sensors: START ( START button held ), BLOCKED ( wheels did not turn during the last move or turn ), or 0 -> 14.
+A branch must stay in its block: it cannot jump into or out of a LOOP block.
+"""
+
+import argparse
+import sys
+
+# Header
+MAGIC = 0x4D
+VERSION = 1
+HEADER_SIZE = 5
+
+# Opcodes ( bits 7:5 )
+OP_END, OP_MOVE, OP_TURN, OP_WAIT, OP_LED, OP_LOOP, OP_NEXT, OP_BR = (op << 5 for op in range(8))
+OPCODE_MASK = 0xE0
+OPERAND_MASK = 0x1F
+BR_NEGATE = 0x10
+BR_ALWAYS = 0x0F
+
+# Limits, as checked by the firmware validator
+LOOP_DEPTH = 4
+EEPROM_SIZE = 1024
+DEFAULT_ADDRESS = 0x0040    # APP_MSN_EEPROM_ADDRESS
+
+SENSORS = {"START": 0, "BLOCKED": 1}
+SENSOR_NAMES = {value: name for name, value in SENSORS.items()}
+
+
+class MissionError(Exception):
+    pass
+
+
+# ************************************************************************************************
+# Encoding
+
+
+def instruction_size(first_byte):
+    opcode = first_byte & OPCODE_MASK
+    if opcode in (OP_MOVE, OP_BR):
+        return 2
+    if opcode == OP_WAIT and (first_byte & OPERAND_MASK) == 0:
+        return 2
+    return 1
+
+
+def parse_number(text, line_no):
+    try:
+        return int(text, 0)
+    except ValueError:
+        raise MissionError(f"line {line_no}: bad number '{text}'")
+
+
+def parse_sensor(text, line_no):
+    name = text.upper()
+    if name in SENSORS:
+        return SENSORS[name]
+    value = parse_number(text, line_no)
+    if not 0 <= value <= 14:
+        raise MissionError(f"line {line_no}: sensor must be 0 -> 14")
+    return value
+
+
+def check_multiple(value, step, low, high, what, line_no):
+    if value % step or not low <= value <= high:
+        raise MissionError(f"line {line_no}: {what} must be {low} -> {high} in steps of {step}")
+
+
+def parse_source(text):
+    """Returns the labels, and the instructions as ( line, mnemonic, operands, size )."""
+    labels = {}
+    instructions = []
+    offset = 0
+
+    for line_no, line in enumerate(text.splitlines(), 1):
+        line = line.split(";", 1)[0].split("#", 1)[0].strip()
+
+        while ":" in line:
+            label, line = line.split(":", 1)
+            label = label.strip()
+            if not label.isidentifier():
+                raise MissionError(f"line {line_no}: bad label '{label}'")
+            if label in labels:
+                raise MissionError(f"line {line_no}: label '{label}' defined twice")
+            labels[label] = offset
+            line = line.strip()
+
+        if not line:
+            continue
+
+        parts = line.split(None, 1)
+        mnemonic = parts[0].upper()
+        operands = [op.strip() for op in parts[1].split(",")] if len(parts) > 1 else []
+
+        if mnemonic in ("MOVE", "BR", "BRN", "JMP"):
+            size = 2
+        elif mnemonic == "WAIT":
+            if len(operands) != 1:
+                raise MissionError(f"line {line_no}: WAIT takes 1 operand")
+            size = 1 if parse_number(operands[0], line_no) <= 31 * 100 else 2
+        else:
+            size = 1
+
+        instructions.append((line_no, mnemonic, operands, size))
+        offset += size
+
+    return labels, instructions
+
+
+def encode(line_no, mnemonic, operands, offset, labels):
+    expected = {"END": 0, "NEXT": 0, "MOVE": 2, "TURN": 1, "WAIT": 1, "LED": 1, "LOOP": 1, "BR": 2, "BRN": 2, "JMP": 1}
+    if mnemonic not in expected:
+        raise MissionError(f"line {line_no}: unknown instruction '{mnemonic}'")
+    if len(operands) != expected[mnemonic]:
+        raise MissionError(f"line {line_no}: {mnemonic} takes {expected[mnemonic]} operand(s)")
+
+    if mnemonic == "END":
+        return [OP_END]
+    if mnemonic == "NEXT":
+        return [OP_NEXT]
+    if mnemonic == "MOVE":
+        speed = parse_number(operands[0], line_no)
+        time = parse_number(operands[1], line_no)
+        check_multiple(speed, 10, 10, 100, "speed", line_no)
+        check_multiple(time, 50, 50, 255 * 50, "time", line_no)
+        return [OP_MOVE | speed // 10, time // 50]
+    if mnemonic == "TURN":
+        quarters = parse_number(operands[0], line_no)
+        if not 1 <= quarters <= 31:
+            raise MissionError(f"line {line_no}: quarters must be 1 -> 31")
+        return [OP_TURN | quarters]
+    if mnemonic == "WAIT":
+        time = parse_number(operands[0], line_no)
+        check_multiple(time, 100, 100, 255 * 100, "time", line_no)
+        if time <= 31 * 100:
+            return [OP_WAIT | time // 100]
+        return [OP_WAIT, time // 100]
+    if mnemonic == "LED":
+        mask = parse_number(operands[0], line_no)
+        if not 0 <= mask <= 0x0F:
+            raise MissionError(f"line {line_no}: LED mask must be 0 -> 0x0F")
+        return [OP_LED | mask]
+    if mnemonic == "LOOP":
+        if operands[0].upper() == "FOREVER":
+            return [OP_LOOP]
+        count = parse_number(operands[0], line_no)
+        if not 1 <= count <= 31:
+            raise MissionError(f"line {line_no}: loop count must be 1 -> 31, or FOREVER")
+        return [OP_LOOP | count]
+
+    # Branches
+    if mnemonic == "JMP":
+        condition, label = BR_ALWAYS, operands[0]
+    else:
+        condition = parse_sensor(operands[0], line_no) | (BR_NEGATE if mnemonic == "BRN" else 0)
+        label = operands[1]
+    if label not in labels:
+        raise MissionError(f"line {line_no}: unknown label '{label}'")
+    relative = labels[label] - (offset + 2)
+    if not -128 <= relative <= 127:
+        raise MissionError(f"line {line_no}: label '{label}' is too far for a branch")
+    return [OP_BR | condition, relative & 0xFF]
+
+
+def assemble(text):
+    labels, instructions = parse_source(text)
+    code = []
+    lines = {}
+    for line_no, mnemonic, operands, _ in instructions:
+        lines[len(code)] = line_no
+        code += encode(line_no, mnemonic, operands, len(code), labels)
+
+    error = validate(code)
+    if error:
+        reason, offset = error
+        raise MissionError(f"line {lines.get(offset, '?')}: {reason}")
+    return bytes(code)
+
+
+# ************************************************************************************************
+# Validation, same rules as MSN_load
+
+
+def block_of(code, target):
+    """Returns the loop body the instruction at target belongs to, or None if target is inside an instruction."""
+    loops = []
+    offset = 0
+    while offset < target:
+        opcode = code[offset] & OPCODE_MASK
+        if opcode == OP_LOOP and len(loops) < LOOP_DEPTH:
+            loops.append(offset + 1)
+        elif opcode == OP_NEXT and loops:
+            loops.pop()
+        offset += instruction_size(code[offset])
+    if offset != target:
+        return None
+    return loops[-1] if loops else -1
+
+
+def validate(code):
+    """Returns None if the instructions are valid, or ( reason, offset )."""
+    if not code:
+        return ("empty mission", 0)
+
+    loops = []
+    offset = last = 0
+    while offset < len(code):
+        first = code[offset]
+        opcode, operand = first & OPCODE_MASK, first & OPERAND_MASK
+        size = instruction_size(first)
+        if offset + size > len(code):
+            return ("operand byte past the mission end", offset)
+        second = code[offset + 1] if size == 2 else None
+
+        if opcode in (OP_END, OP_NEXT) and operand:
+            return ("operand out of range", offset)
+        if opcode == OP_NEXT:
+            if not loops:
+                return ("NEXT without LOOP", offset)
+            loops.pop()
+        if opcode == OP_MOVE and (operand == 0 or operand > 10 or second == 0):
+            return ("operand out of range", offset)
+        if opcode == OP_TURN and operand == 0:
+            return ("operand out of range", offset)
+        if opcode == OP_WAIT and operand == 0 and second == 0:
+            return ("operand out of range", offset)
+        if opcode == OP_LED and operand > 0x0F:
+            return ("operand out of range", offset)
+        if opcode == OP_LOOP:
+            if len(loops) == LOOP_DEPTH:
+                return (f"LOOP nested deeper than {LOOP_DEPTH}", offset)
+            loops.append(offset + 1)
+        if opcode == OP_BR:
+            target = offset + 2 + (second - 256 if second > 127 else second)
+            if not 0 <= target < len(code) or block_of(code, target) != (loops[-1] if loops else -1):
+                return ("branch target outside its block", offset)
+
+        last = offset
+        offset += size
+
+    if loops:
+        return ("LOOP without NEXT", loops[-1] - 1)
+    if code[last] != OP_END:
+        return ("last instruction is not END", last)
+    return None
+
+
+# ************************************************************************************************
+# Disassembly
+
+
+def disassemble(code):
+    targets = set()
+    offset = 0
+    while offset < len(code):
+        if code[offset] & OPCODE_MASK == OP_BR and offset + 1 < len(code):
+            second = code[offset + 1]
+            targets.add(offset + 2 + (second - 256 if second > 127 else second))
+        offset += instruction_size(code[offset])
+    labels = {target: f"L{index}" for index, target in enumerate(sorted(targets))}
+
+    lines = []
+    offset = 0
+    depth = 0
+    while offset < len(code):
+        first = code[offset]
+        opcode, operand = first & OPCODE_MASK, first & OPERAND_MASK
+        size = instruction_size(first)
+        raw = code[offset:offset + size]
+        second = raw[1] if len(raw) == 2 else 0
+
+        if opcode == OP_END:
+            text = "END"
+        elif opcode == OP_MOVE:
+            text = f"MOVE  {operand * 10}, {second * 50}"
+        elif opcode == OP_TURN:
+            text = f"TURN  {operand}"
+        elif opcode == OP_WAIT:
+            text = f"WAIT  {(operand or second) * 100}"
+        elif opcode == OP_LED:
+            text = f"LED   0b{operand:04b}"
+        elif opcode == OP_LOOP:
+            text = f"LOOP  {operand or 'FOREVER'}"
+        elif opcode == OP_NEXT:
+            text = "NEXT"
+            depth = max(depth - 1, 0)
+        else:
+            target = labels.get(offset + 2 + (second - 256 if second > 127 else second), "?")
+            sensor = operand & BR_ALWAYS
+            if sensor == BR_ALWAYS and not operand & BR_NEGATE:
+                text = f"JMP   {target}"
+            else:
+                name = SENSOR_NAMES.get(sensor, str(sensor))
+                text = f"{'BRN' if operand & BR_NEGATE else 'BR '}   {name}, {target}"
+
+        label = f"{labels[offset]}:" if offset in labels else ""
+        hex_bytes = " ".join(f"{b:02X}" for b in raw)
+        lines.append(f"{label:<8}{'    ' * depth + text:<40}; {offset:04X}: {hex_bytes}")
+
+        if opcode == OP_LOOP:
+            depth += 1
+        offset += size
+
+    return "\n".join(lines)
+
+
+# ************************************************************************************************
+# Images
+
+
+def build_image(code):
+    checksum = (-sum(code)) & 0xFF
+    return bytes([MAGIC, VERSION, len(code) & 0xFF, len(code) >> 8, checksum]) + code
+
+
+def split_image(image):
+    if len(image) < HEADER_SIZE or image[0] != MAGIC or image[1] != VERSION:
+        raise MissionError("not a mission image ( bad magic or version )")
+    length = image[2] | image[3] << 8
+    code = image[HEADER_SIZE:HEADER_SIZE + length]
+    if len(code) != length:
+        raise MissionError("mission image is truncated")
+    if (sum(code) + image[4]) & 0xFF:
+        raise MissionError("mission checksum mismatch")
+    return code
+
+
+def to_intel_hex(data, address):
+    records = []
+    for start in range(0, len(data), 16):
+        chunk = data[start:start + 16]
+        record = bytes([len(chunk), (address + start) >> 8, (address + start) & 0xFF, 0]) + chunk
+        records.append(":" + record.hex().upper() + f"{(-sum(record)) & 0xFF:02X}")
+    records.append(":00000001FF")
+    return "\n".join(records) + "\n"
+
+
+def from_intel_hex(text, address):
+    memory = {}
+    for line in text.splitlines():
+        line = line.strip()
+        if not line.startswith(":"):
+            continue
+        record = bytes.fromhex(line[1:])
+        if sum(record) & 0xFF:
+            raise MissionError("Intel HEX record checksum mismatch")
+        if record[3] == 0:
+            base = record[1] << 8 | record[2]
+            for index, byte in enumerate(record[4:4 + record[0]]):
+                memory[base + index] = byte
+    image = bytearray()
+    while address + len(image) in memory:
+        image.append(memory[address + len(image)])
+    return bytes(image)
+
+
+# ************************************************************************************************
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Mission Interpreter (MSN) assembler/disassembler")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    asm = commands.add_parser("asm", help="assemble a mission source")
+    asm.add_argument("source")
+    asm.add_argument("-o", "--output", required=True, help=".hex ( Intel HEX EEPROM image ) or .bin ( raw image )")
+    asm.add_argument("-a", "--address", type=lambda text: int(text, 0), default=DEFAULT_ADDRESS,
+                     help="EEPROM address of the mission header ( default 0x%(default)04X )")
+
+    dis = commands.add_parser("dis", help="disassemble a mission image")
+    dis.add_argument("image", help=".hex ( Intel HEX EEPROM image ) or .bin ( raw image )")
+    dis.add_argument("-a", "--address", type=lambda text: int(text, 0), default=DEFAULT_ADDRESS,
+                     help="EEPROM address of the mission header in a .hex image ( default 0x%(default)04X )")
+
+    args = parser.parse_args()
+
+    try:
+        if args.command == "asm":
+            with open(args.source) as source:
+                image = build_image(assemble(source.read()))
+            if args.address + len(image) > EEPROM_SIZE:
+                raise MissionError(f"mission image ( {len(image)} bytes ) does not fit in the EEPROM at 0x{args.address:04X}")
+            if args.output.lower().endswith(".hex"):
+                with open(args.output, "w") as output:
+                    output.write(to_intel_hex(image, args.address))
+            else:
+                with open(args.output, "wb") as output:
+                    output.write(image)
+            print(f"{args.output}: {len(image) - HEADER_SIZE} instruction bytes, {len(image)} bytes image")
+        else:
+            if args.image.lower().endswith(".hex"):
+                with open(args.image) as hex_file:
+                    image = from_intel_hex(hex_file.read(), args.address)
+            else:
+                with open(args.image, "rb") as bin_file:
+                    image = bin_file.read()
+            code = split_image(image)
+            print(disassemble(code))
+            error = validate(code)
+            if error:
+                print(f"; invalid mission at {error[1]:04X}: {error[0]}")
+    except (MissionError, OSError) as error:
+        sys.exit(f"msn_asm: {error}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,283 @@
+/*
+ * pcn_test.c
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: Host test of the pin change notification engine ( SERVICE/pcn ): the engine source runs unchanged
+ *                 over simulated PINA to PIND, and every change and level word handed to each subscriber is checked.
+ *
+ * DIO_portRead returns the simulated pins, the test writes them between two PCN_task calls.
+ * Four subscribers overlap on purpose: one pin of port B, the whole port C, PA0 with PD7, and PD7 alone.
+ *
+ * Checks:
+ *  1. PCN_subscribe refuses a mask of 0, a NULL action, and a subscriber more than PCN_U8_MAX_SUBSCRIBERS.
+ *  2. Scripted steps: unwatched pins never notify, a change notifies only the subscribers of its pins, once, with the
+ *     changed pins and the levels of all their pins, a pin watched twice notifies both, and pins changed before a
+ *     subscription are not reported to it.
+ *  3. Random steps against a reference model: each subscriber is called exactly when its pins changed since the
+ *     previous PCN_task, with ( old ^ new ) & mask and new & mask.
+ *
+ * Build and run:
+ *  gcc -std=gnu11 -O2 -I"../../Moving Car" pcn_test.c -o pcn_test
+ *  ./pcn_test [ random steps ( default 1000000 ) ] [ seed ( default 1 ) ]
+ * Exits with 0 if every check passed.
+ */
+
+/* LIB */
+#include "LIB/std.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Engine under test, its static state is reachable from here */
+#include "SERVICE/pcn/pcn_program.c"
+
+/* ***********************************************************************************************/
+/* Test Configurations */
+
+#define TEST_U8_SUBSCRIBERS_NUMBER		4
+
+/* Subscribers pins: PB4, the whole port C, PA0 with PD7, and PD7 alone */
+#define TEST_U32_PINS_0					PCN_U32_PIN_MASK( DIO_PIN( B, 4 ) )
+#define TEST_U32_PINS_1					PCN_U32_PORT_MASK( PORT_C )
+#define TEST_U32_PINS_2					( PCN_U32_PIN_MASK( DIO_PIN( A, 0 ) ) | PCN_U32_PIN_MASK( DIO_PIN( D, 7 ) ) )
+#define TEST_U32_PINS_3					PCN_U32_PIN_MASK( DIO_PIN( D, 7 ) )
+
+/* Pins never watched by any subscriber, for the random steps */
+#define TEST_U32_UNWATCHED_PINS			( 0xFFFFFFFFUL & ~( TEST_U32_PINS_0 | TEST_U32_PINS_1 | TEST_U32_PINS_2 | TEST_U32_PINS_3 ) )
+
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+/* Simulated PINA to PIND */
+static u8 au8_gs_testPins[DIO_PORTS_NUMBER];
+
+/* Calls recorded per subscriber since the last TEST_clearCalls: number, last changed pins and levels words */
+static u32 au32_gs_testCalls[TEST_U8_SUBSCRIBERS_NUMBER];
+static u32 au32_gs_testChanged[TEST_U8_SUBSCRIBERS_NUMBER];
+static u32 au32_gs_testLevels[TEST_U8_SUBSCRIBERS_NUMBER];
+
+static const u32 au32_gs_testMasks[TEST_U8_SUBSCRIBERS_NUMBER] = { TEST_U32_PINS_0, TEST_U32_PINS_1, TEST_U32_PINS_2, TEST_U32_PINS_3 };
+
+static u32 u32_gs_testRandom = 1;
+static u32 u32_gs_testFailures = 0;
+
+/* ***********************************************************************************************/
+/* Simulated MCU */
+
+EN_DIO_ERROR_T DIO_portRead( EN_DIO_PORT_T en_a_portNumber, u8 * u8_a_portValue )
+{
+	if ( ( en_a_portNumber >= DIO_PORTS_NUMBER ) || ( u8_a_portValue == NULL ) ) return DIO_ERROR;
+
+	*u8_a_portValue = au8_gs_testPins[en_a_portNumber];
+	return DIO_OK;
+}
+
+/* Sets the simulated ports from a pins word, bit ( 8 * port + pin ) */
+static void TEST_setPins( u32 u32_a_pins )
+{
+	au8_gs_testPins[PORT_A] = ( u8 ) u32_a_pins;
+	au8_gs_testPins[PORT_B] = ( u8 ) ( u32_a_pins >> 8 );
+	au8_gs_testPins[PORT_C] = ( u8 ) ( u32_a_pins >> 16 );
+	au8_gs_testPins[PORT_D] = ( u8 ) ( u32_a_pins >> 24 );
+}
+
+/* xorshift32 */
+static u32 TEST_random( void )
+{
+	u32_gs_testRandom ^= ( u32_gs_testRandom << 13 ) & 0xFFFFFFFFUL;
+	u32_gs_testRandom ^= u32_gs_testRandom >> 17;
+	u32_gs_testRandom ^= ( u32_gs_testRandom << 5 ) & 0xFFFFFFFFUL;
+	return u32_gs_testRandom;
+}
+
+/* ***********************************************************************************************/
+/* Subscribers */
+
+static void TEST_record( u8 u8_a_subscriber, u32 u32_a_changedPins, u32 u32_a_pinsLevels )
+{
+	au32_gs_testCalls[u8_a_subscriber]++;
+	au32_gs_testChanged[u8_a_subscriber] = u32_a_changedPins;
+	au32_gs_testLevels[u8_a_subscriber]  = u32_a_pinsLevels;
+}
+
+static void TEST_action0( u32 u32_a_changedPins, u32 u32_a_pinsLevels ) { TEST_record( 0, u32_a_changedPins, u32_a_pinsLevels ); }
+static void TEST_action1( u32 u32_a_changedPins, u32 u32_a_pinsLevels ) { TEST_record( 1, u32_a_changedPins, u32_a_pinsLevels ); }
+static void TEST_action2( u32 u32_a_changedPins, u32 u32_a_pinsLevels ) { TEST_record( 2, u32_a_changedPins, u32_a_pinsLevels ); }
+static void TEST_action3( u32 u32_a_changedPins, u32 u32_a_pinsLevels ) { TEST_record( 3, u32_a_changedPins, u32_a_pinsLevels ); }
+
+static void ( * const apf_gs_testActions[TEST_U8_SUBSCRIBERS_NUMBER] ) ( u32, u32 ) =
+{
+	&TEST_action0, &TEST_action1, &TEST_action2, &TEST_action3
+};
+
+static void TEST_clearCalls( void )
+{
+	u8 u8_l_subscriber;
+
+	for ( u8_l_subscriber = 0; u8_l_subscriber < TEST_U8_SUBSCRIBERS_NUMBER; u8_l_subscriber++ )
+	{
+		au32_gs_testCalls[u8_l_subscriber] = 0;
+		au32_gs_testChanged[u8_l_subscriber] = 0;
+		au32_gs_testLevels[u8_l_subscriber] = 0;
+	}
+}
+
+/* ***********************************************************************************************/
+/* Checks */
+
+static void TEST_check( u8 u8_a_condition, const char * pu8_a_step, const char * pu8_a_what )
+{
+	if ( u8_a_condition ) return;
+
+	u32_gs_testFailures++;
+	if ( u32_gs_testFailures <= 10 ) printf( "FAIL %s: %s\n", pu8_a_step, pu8_a_what );
+}
+
+/* Runs PCN_task over the given pins, and checks each subscriber got exactly the call its pins changes call for */
+static void TEST_step( const char * pu8_a_step, u32 u32_a_oldPins, u32 u32_a_newPins, u8 u8_a_subscribersNumber )
+{
+	u8  u8_l_subscriber;
+	u32 u32_l_changed;
+
+	TEST_setPins( u32_a_newPins );
+	TEST_clearCalls();
+	PCN_task();
+
+	for ( u8_l_subscriber = 0; u8_l_subscriber < TEST_U8_SUBSCRIBERS_NUMBER; u8_l_subscriber++ )
+	{
+		u32_l_changed = ( u32_a_oldPins ^ u32_a_newPins ) & au32_gs_testMasks[u8_l_subscriber];
+
+		if ( ( u8_l_subscriber >= u8_a_subscribersNumber ) || ( u32_l_changed == 0 ) )
+		{
+			TEST_check( au32_gs_testCalls[u8_l_subscriber] == 0, pu8_a_step, "subscriber called without a change of its pins" );
+			continue;
+		}
+
+		TEST_check( au32_gs_testCalls[u8_l_subscriber] == 1, pu8_a_step, "subscriber not called exactly once" );
+		TEST_check( au32_gs_testChanged[u8_l_subscriber] == u32_l_changed, pu8_a_step, "wrong changed pins word" );
+		TEST_check( au32_gs_testLevels[u8_l_subscriber] == ( u32_a_newPins & au32_gs_testMasks[u8_l_subscriber] ),
+		            pu8_a_step, "wrong pins levels word" );
+	}
+}
+
+/* Check 1: Refused subscriptions */
+static void TEST_subscriptions( void )
+{
+	u8 u8_l_subscriber;
+
+	TEST_setPins( 0 );
+	PCN_init();
+
+	TEST_check( PCN_subscribe( 0, &TEST_action0 ) == PCN_ERROR, "subscribe", "mask of 0 accepted" );
+	TEST_check( PCN_subscribe( TEST_U32_PINS_0, NULL ) == PCN_ERROR, "subscribe", "NULL action accepted" );
+
+	for ( u8_l_subscriber = 0; u8_l_subscriber < PCN_U8_MAX_SUBSCRIBERS; u8_l_subscriber++ )
+	{
+		TEST_check( PCN_subscribe( TEST_U32_PINS_0, &TEST_action0 ) == PCN_OK, "subscribe", "subscriber refused" );
+	}
+	TEST_check( PCN_subscribe( TEST_U32_PINS_0, &TEST_action0 ) == PCN_ERROR, "subscribe", "full table accepted" );
+}
+
+/* Check 2: Scripted steps, all the pins start high but PB4 */
+static void TEST_scripted( void )
+{
+	const u32 u32_l_pb4 = TEST_U32_PINS_0;
+	const u32 u32_l_pd7 = TEST_U32_PINS_3;
+	const u32 u32_l_pa0 = PCN_U32_PIN_MASK( DIO_PIN( A, 0 ) );
+	const u32 u32_l_pc3 = PCN_U32_PIN_MASK( DIO_PIN( C, 3 ) );
+	const u32 u32_l_pb5 = PCN_U32_PIN_MASK( DIO_PIN( B, 5 ) );
+	u32 u32_l_pins = 0xFFFFFFFFUL & ~u32_l_pb4;
+	u8  u8_l_subscriber;
+
+	TEST_setPins( u32_l_pins );
+	PCN_init();
+
+	/* Subscribers 0 and 1 first, 2 and 3 after pins they watch changed */
+	for ( u8_l_subscriber = 0; u8_l_subscriber < 2; u8_l_subscriber++ )
+	{
+		TEST_check( PCN_subscribe( au32_gs_testMasks[u8_l_subscriber], apf_gs_testActions[u8_l_subscriber] ) == PCN_OK, "scripted", "subscriber refused" );
+	}
+
+	TEST_step( "no change", u32_l_pins, u32_l_pins, 2 );
+	TEST_step( "unwatched PB5 low", u32_l_pins, u32_l_pins & ~u32_l_pb5, 2 );			u32_l_pins &= ~u32_l_pb5;
+	TEST_step( "PB4 high", u32_l_pins, u32_l_pins | u32_l_pb4, 2 );						u32_l_pins |= u32_l_pb4;
+	TEST_check( au32_gs_testCalls[0] == 1 && au32_gs_testChanged[0] == u32_l_pb4 && au32_gs_testLevels[0] == u32_l_pb4,
+	            "PB4 high", "subscriber 0 did not get PB4 high" );
+	TEST_step( "PB4 again", u32_l_pins, u32_l_pins, 2 );
+
+	/* PA0 and PD7 change while nobody watches them, then 2 and 3 subscribe: not reported */
+	TEST_setPins( u32_l_pins & ~( u32_l_pa0 | u32_l_pd7 ) );									u32_l_pins &= ~( u32_l_pa0 | u32_l_pd7 );
+	PCN_task();
+	TEST_setPins( u32_l_pins | u32_l_pd7 );													u32_l_pins |= u32_l_pd7;
+	for ( u8_l_subscriber = 2; u8_l_subscriber < TEST_U8_SUBSCRIBERS_NUMBER; u8_l_subscriber++ )
+	{
+		TEST_check( PCN_subscribe( au32_gs_testMasks[u8_l_subscriber], apf_gs_testActions[u8_l_subscriber] ) == PCN_OK, "scripted", "subscriber refused" );
+	}
+	TEST_step( "after subscription", u32_l_pins, u32_l_pins, TEST_U8_SUBSCRIBERS_NUMBER );
+
+	/* PD7 is watched by 2 and 3, PC3 by 1 only */
+	TEST_step( "PD7 low and PC3 low", u32_l_pins, u32_l_pins & ~( u32_l_pd7 | u32_l_pc3 ), TEST_U8_SUBSCRIBERS_NUMBER );
+	u32_l_pins &= ~( u32_l_pd7 | u32_l_pc3 );
+	TEST_check( au32_gs_testCalls[2] == 1 && au32_gs_testCalls[3] == 1, "PD7 low", "PD7 not notified to both subscribers" );
+	TEST_check( au32_gs_testLevels[2] == 0 && au32_gs_testLevels[1] == ( PCN_U32_PORT_MASK( PORT_C ) & ~u32_l_pc3 ),
+	            "PD7 low", "wrong levels" );
+
+	/* PA0 high: subscriber 2 only, with PD7 still low in its levels */
+	TEST_step( "PA0 high", u32_l_pins, u32_l_pins | u32_l_pa0, TEST_U8_SUBSCRIBERS_NUMBER );	u32_l_pins |= u32_l_pa0;
+	TEST_check( au32_gs_testCalls[2] == 1 && au32_gs_testLevels[2] == u32_l_pa0 && au32_gs_testCalls[3] == 0,
+	            "PA0 high", "wrong subscriber 2 or 3 call" );
+
+	/* All the pins toggle at once */
+	TEST_step( "all pins toggle", u32_l_pins, ~u32_l_pins & 0xFFFFFFFFUL, TEST_U8_SUBSCRIBERS_NUMBER );
+}
+
+/* Check 3: Random steps, each one changes a random set of pins, unwatched pins more often than the others */
+static void TEST_randomSteps( u32 u32_a_steps )
+{
+	u32 u32_l_pins = TEST_random();
+	u32 u32_l_newPins;
+	u32 u32_l_step;
+	u8  u8_l_subscriber;
+
+	TEST_setPins( u32_l_pins );
+	PCN_init();
+	for ( u8_l_subscriber = 0; u8_l_subscriber < TEST_U8_SUBSCRIBERS_NUMBER; u8_l_subscriber++ )
+	{
+		TEST_check( PCN_subscribe( au32_gs_testMasks[u8_l_subscriber], apf_gs_testActions[u8_l_subscriber] ) == PCN_OK, "random", "subscriber refused" );
+	}
+
+	for ( u32_l_step = 0; u32_l_step < u32_a_steps; u32_l_step++ )
+	{
+		switch ( TEST_random() & 3 )
+		{
+			case 0 : u32_l_newPins = u32_l_pins; break;
+			case 1 : u32_l_newPins = u32_l_pins ^ ( TEST_random() & TEST_U32_UNWATCHED_PINS ); break;
+			case 2 : u32_l_newPins = u32_l_pins ^ ( ( u32 ) 1 << ( TEST_random() & 31 ) ); break;
+			default: u32_l_newPins = TEST_random(); break;
+		}
+
+		TEST_step( "random", u32_l_pins, u32_l_newPins, TEST_U8_SUBSCRIBERS_NUMBER );
+		u32_l_pins = u32_l_newPins;
+	}
+}
+
+/* ***********************************************************************************************/
+
+int main( int argc, char *argv[] )
+{
+	u32 u32_l_steps = 1000000;
+
+	if ( argc > 1 ) u32_l_steps = strtoul( argv[1], NULL, 0 );
+	if ( argc > 2 ) u32_gs_testRandom = strtoul( argv[2], NULL, 0 ) & 0xFFFFFFFFUL;
+	if ( u32_gs_testRandom == 0 ) u32_gs_testRandom = 1;
+
+	TEST_subscriptions();
+	TEST_scripted();
+	TEST_randomSteps( u32_l_steps );
+
+	printf( "pcn_test: %lu random steps, %lu failures: %s\n", ( unsigned long ) u32_l_steps, ( unsigned long ) u32_gs_testFailures,
+	        ( u32_gs_testFailures == 0 ) ? "PASS" : "FAIL" );
+
+	return ( u32_gs_testFailures == 0 ) ? 0 : 1;
+}
@@ -0,0 +1,400 @@
+/*
+ * sch_sim.c
+ *
+ *     Created on: Oct 18, 2026
+ *         Author: Hacker Kermit - https://github.com/AbdelrhmanWalaa/Moving-Car-Project.git
+ *    Description: Host simulation of the scheduler tickless idle ( SERVICE/sch ): the scheduler source runs unchanged
+ *                 over a simulated Timer1, sleep and global interrupt flag, for hours of simulated time.
+ *
+ * Timer1 is simulated count by count of its CTC mode ( 1 count per usec., the period is the compare value + 1 ),
+ * with its compare A flag, so SCH_tick, SCH_startTickless and SCH_stopTickless see what the MCU would show them.
+ * Each SLP_sleep sleeps until the next compare match, or until a random early wake-up standing for the other
+ * interrupts of the car ( encoder, buttons ). Code outside the tasks takes no time.
+ *
+ * Tasks: a 1 msec. task kept suspended ( the parked motors PWM task ), a 10 msec. task and a 50 msec. task with
+ * offset 3, each running for SIM_U16_TASK_COUNTS. Each run checks it was released on its own ticks.
+ *
+ * Two runs of the given hours are checked:
+ *  1. No early wake-up: one wake-up per tick releasing a task, exactly.
+ *  2. Random early wake-ups, every SIM_U16_EARLY_MEAN_COUNTS on average: each one costs at most one more wake-up,
+ *     the tick boundary it cuts the stretched period to.
+ * and for both: the scheduler ticks never drift from the simulated time ( ticks * 1000 + counter = usec. elapsed,
+ * at every sleep ), the compare value is never behind the counter, and every task ran exactly once per period.
+ *
+ * u32 is 8 bytes wide on a 64-bit host, so the 32-bit wrap of the usec. timestamps ( every 71 minutes on the MCU,
+ * only used for the sleep time accounting ) is not simulated.
+ *
+ * Build and run:
+ *  gcc -std=gnu11 -O2 -I"../../Moving Car" sch_sim.c -o sch_sim
+ *  ./sch_sim [ hours ( default 24 ) ] [ seed ( default 1 ) ]
+ * Exits with 0 if every check passed.
+ */
+
+/* LIB */
+#include "LIB/std.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <setjmp.h>
+
+/* ***********************************************************************************************/
+/* Simulated MCU */
+
+/* Global interrupt flag, and the simulated Timer1 compare A ISR, run when it is pending and interrupts are enabled */
+static u8 u8_gs_simGie = 0;
+static void SIM_serviceTick( void );
+
+/* GLI critical sections save and clear the simulated flag instead of SREG */
+#include "MCAL/gli/gli_interface.h"
+#undef  GLI_ENTER_CRITICAL
+#undef  GLI_EXIT_CRITICAL
+#define GLI_ENTER_CRITICAL( SREG_COPY, SITE_ID )	do { ( SREG_COPY ) = u8_gs_simGie; u8_gs_simGie = 0; } while ( 0 )
+#define GLI_EXIT_CRITICAL( SREG_COPY )				do { u8_gs_simGie = ( SREG_COPY ); SIM_serviceTick(); } while ( 0 )
+
+/* Scheduler under test, its static functions and state are reachable from here */
+#include "SERVICE/sch/sch_program.c"
+
+/* ***********************************************************************************************/
+/* Simulation Configurations */
+
+#define SIM_U16_TASK_COUNTS			150		/* Run time of every task, in Timer1 counts ( usec. ) */
+#define SIM_U16_EARLY_MEAN_COUNTS	20000	/* Mean time between two early wake-ups, in Timer1 counts */
+
+/* Tasks table: index, period, offset */
+#define SIM_U8_PARKED_TASK_ID		0
+#define SIM_U8_FAST_TASK_ID			1
+#define SIM_U16_FAST_TASK_PERIOD	10
+#define SIM_U16_FAST_TASK_OFFSET	0
+#define SIM_U8_SLOW_TASK_ID			2
+#define SIM_U16_SLOW_TASK_PERIOD	50
+#define SIM_U16_SLOW_TASK_OFFSET	3
+#define SIM_U8_TASKS_NUMBER			3
+
+/* ***********************************************************************************************/
+/* Declaration and Initialization */
+
+/* Simulated Timer1: counter, compare A value and flag, and its ISR callback */
+static u16 u16_gs_simCounter = 0;
+static u16 u16_gs_simCompare = 0;
+static u8  u8_gs_simPending = 0;
+static void ( *pf_gs_simTickIsr ) ( void ) = NULL;
+
+/* Simulated time in usec. ( Timer1 counts since it was started ), and end of the run */
+static u64 u64_gs_simNow = 0;
+static u64 u64_gs_simEnd = 0;
+static jmp_buf st_gs_simEndOfRun;
+
+/* Early wake-ups: enabled, random generator state, and their number */
+static u8  u8_gs_simEarlyWakeups = STD_NOK;
+static u32 u32_gs_simRandom = 1;
+static u64 u64_gs_simEarlyCount = 0;
+
+/* Checks: sleeps, worst clock error, compare values behind the counter, task runs off their ticks, and runs per task */
+static u64 u64_gs_simSleeps = 0;
+static u64 u64_gs_simMaxClockError = 0;
+static u64 u64_gs_simMissedCompares = 0;
+static u64 u64_gs_simLateRuns = 0;
+static u64 u64_gs_simRuns[SIM_U8_TASKS_NUMBER];
+
+static void SIM_parkedTask( void );
+static void SIM_fastTask  ( void );
+static void SIM_slowTask  ( void );
+
+static const ST_SCH_task_t st_gs_simTasks[SIM_U8_TASKS_NUMBER] =
+{
+	{ &SIM_parkedTask, 1,                        0                        },	/* SIM_U8_PARKED_TASK_ID */
+	{ &SIM_fastTask,   SIM_U16_FAST_TASK_PERIOD, SIM_U16_FAST_TASK_OFFSET },	/* SIM_U8_FAST_TASK_ID */
+	{ &SIM_slowTask,   SIM_U16_SLOW_TASK_PERIOD, SIM_U16_SLOW_TASK_OFFSET }	/* SIM_U8_SLOW_TASK_ID */
+};
+
+/* ***********************************************************************************************/
+/* Simulated MCU */
+
+/* Runs the pending compare A ISR if interrupts are enabled, with interrupts disabled like the MCU does */
+static void SIM_serviceTick( void )
+{
+	if ( ( u8_gs_simGie == 0 ) || ( u8_gs_simPending == 0 ) ) return;
+
+	u8_gs_simPending = 0;
+	u8_gs_simGie = 0;
+	if ( pf_gs_simTickIsr != NULL ) pf_gs_simTickIsr();
+	u8_gs_simGie = 1;
+}
+
+/* Lets Timer1 count, a match clears the counter on the next count, raises the flag, and runs the ISR if enabled */
+static void SIM_advance( u32 u32_a_counts )
+{
+	u32 u32_l_toMatch;
+
+	while ( u32_a_counts != 0 )
+	{
+		/* Check 1: Compare value behind the counter, the match is missed until the counter wraps */
+		if ( u16_gs_simCounter > u16_gs_simCompare )
+		{
+			u64_gs_simMissedCompares++;
+			u16_gs_simCompare = u16_gs_simCounter;
+		}
+
+		u32_l_toMatch = ( u32 ) ( u16_gs_simCompare - u16_gs_simCounter ) + 1;
+
+		if ( u32_a_counts < u32_l_toMatch )
+		{
+			u16_gs_simCounter += ( u16 ) u32_a_counts;
+			u64_gs_simNow += u32_a_counts;
+			return;
+		}
+
+		u16_gs_simCounter = 0;
+		u64_gs_simNow += u32_l_toMatch;
+		u32_a_counts -= u32_l_toMatch;
+		u8_gs_simPending = 1;
+		SIM_serviceTick();
+	}
+}
+
+/* xorshift32 */
+static u32 SIM_random( void )
+{
+	u32 u32_l_value = u32_gs_simRandom & 0xFFFFFFFF;
+
+	u32_l_value ^= ( u32_l_value << 13 ) & 0xFFFFFFFF;
+	u32_l_value ^= u32_l_value >> 17;
+	u32_l_value ^= ( u32_l_value << 5 ) & 0xFFFFFFFF;
+	u32_gs_simRandom = u32_l_value;
+
+	return u32_l_value;
+}
+
+/* Scheduler clock against the simulated time, outside the tick ISR */
+static void SIM_checkClock( void )
+{
+	u64 u64_l_clock;
+	u64 u64_l_error;
+
+	/* Check 1: Ended period not counted yet */
+	if ( u8_gs_simPending != 0 ) return;
+
+	u64_l_clock = ( ( u64 ) u32_gs_schTicks * SCH_U16_US_PER_TICK ) + u16_gs_simCounter;
+	u64_l_error = ( u64_l_clock > u64_gs_simNow ) ? ( u64_l_clock - u64_gs_simNow ) : ( u64_gs_simNow - u64_l_clock );
+
+	if ( u64_l_error > u64_gs_simMaxClockError ) u64_gs_simMaxClockError = u64_l_error;
+}
+
+/* ***********************************************************************************************/
+/* MCAL Stubs */
+
+vd GLI_enableGIE ( void ) { u8_gs_simGie = 1; SIM_serviceTick(); }
+vd GLI_disableGIE( void ) { u8_gs_simGie = 0; }
+
+EN_TIMER_ERROR_T TIMER_timer1CtcInit( u16 u16_a_compareValue )
+{
+	u16_gs_simCounter = 0;
+	u16_gs_simCompare = u16_a_compareValue;
+	u8_gs_simPending = 0;
+
+	return TIMER_OK;
+}
+
+EN_TIMER_ERROR_T TIMER_timer1Start( u16 u16_a_prescaler ) { return TIMER_OK; }
+
+EN_TIMER_ERROR_T TIMER_compASetCallback( void ( *void_a_pfCompAInterruptAction ) ( void ) )
+{
+	pf_gs_simTickIsr = void_a_pfCompAInterruptAction;
+
+	return TIMER_OK;
+}
+
+EN_TIMER_ERROR_T TIMER_timer1SetCompareValue( u16 u16_a_compareValue )
+{
+	u16_gs_simCompare = u16_a_compareValue;
+
+	return TIMER_OK;
+}
+
+u16 TIMER_timer1GetCounter( void )     { return u16_gs_simCounter; }
+u8  TIMER_timer1IsCompAPending( void ) { return u8_gs_simPending; }
+
+EN_SLP_ERROR_T SLP_getDeepestMode( u8 *u8_a_sleepMode )
+{
+	*u8_a_sleepMode = SLP_U8_IDLE;
+
+	return SLP_OK;
+}
+
+/* Sleeps until the compare match, or an early wake-up, then runs the ISR; the run ends here once its time is over */
+EN_SLP_ERROR_T SLP_sleep( u8 u8_a_sleepMode )
+{
+	u32 u32_l_toMatch;
+	u32 u32_l_early;
+
+	SIM_checkClock();
+	if ( u64_gs_simNow >= u64_gs_simEnd ) longjmp( st_gs_simEndOfRun, 1 );
+
+	u64_gs_simSleeps++;
+	u8_gs_simGie = 1;
+
+	/* Check 1: Interrupt already pending, it wakes the MCU up at once */
+	if ( u8_gs_simPending != 0 )
+	{
+		SIM_serviceTick();
+		return SLP_OK;
+	}
+
+	u32_l_toMatch = ( u32 ) ( u16_gs_simCompare - u16_gs_simCounter ) + 1;
+
+	/* Check 2: Another interrupt comes first */
+	if ( u8_gs_simEarlyWakeups == STD_OK )
+	{
+		u32_l_early = SIM_random() % ( 2 * SIM_U16_EARLY_MEAN_COUNTS );
+
+		if ( u32_l_early < u32_l_toMatch )
+		{
+			u64_gs_simEarlyCount++;
+			SIM_advance( u32_l_early );
+			return SLP_OK;
+		}
+	}
+
+	SIM_advance( u32_l_toMatch );
+
+	return SLP_OK;
+}
+
+/* ***********************************************************************************************/
+/* Tasks */
+
+/* Counts the run, and checks it runs on a release tick of the task */
+static void SIM_runTask( u8 u8_a_taskId )
+{
+	const ST_SCH_task_t *st_l_task = &st_gs_simTasks[u8_a_taskId];
+
+	u64_gs_simRuns[u8_a_taskId]++;
+
+	if ( ( ( u32_gs_schTicks - ( st_l_task->u16_offset + 1 ) ) % st_l_task->u16_period ) != 0 ) u64_gs_simLateRuns++;
+
+	SIM_advance( SIM_U16_TASK_COUNTS );
+}
+
+static void SIM_parkedTask( void ) { SIM_runTask( SIM_U8_PARKED_TASK_ID ); }
+static void SIM_fastTask  ( void ) { SIM_runTask( SIM_U8_FAST_TASK_ID ); }
+static void SIM_slowTask  ( void ) { SIM_runTask( SIM_U8_SLOW_TASK_ID ); }
+
+/* Releases of a task in ticks 1 to u32_a_ticks */
+static u64 SIM_releases( u8 u8_a_taskId, u32 u32_a_ticks )
+{
+	const ST_SCH_task_t *st_l_task = &st_gs_simTasks[u8_a_taskId];
+
+	if ( u32_a_ticks < ( u32 ) ( st_l_task->u16_offset + 1 ) ) return 0;
+
+	return ( ( u32_a_ticks - ( st_l_task->u16_offset + 1 ) ) / st_l_task->u16_period ) + 1;
+}
+
+/* ***********************************************************************************************/
+
+/**
+ * @brief Runs the scheduler for the given simulated time, then checks the wake-ups, clock and task runs.
+ * @param[in] u32_a_hours Simulated hours.
+ * @param[in] u8_a_earlyWakeups STD_OK to add random early wake-ups.
+ * @return STD_OK if every check passed, STD_NOK otherwise.
+ */
+static u8 SIM_run( u32 u32_a_hours, u8 u8_a_earlyWakeups )
+{
+	u32 u32_l_awakeMs;
+	u32 u32_l_sleepMs;
+	u32 u32_l_wakeups;
+	u32 u32_l_ticks;
+	u64 u64_l_releaseTicks;
+	u64 u64_l_expected;
+	u32 u32_l_tick;
+	u8  u8_l_taskId;
+	u8  u8_l_ok;
+
+	/* Step 1: Fresh MCU and scheduler, the parked task stays suspended */
+	u64_gs_simNow = 0;
+	u64_gs_simEnd = ( u64 ) u32_a_hours * 3600ULL * 1000000ULL;
+	u8_gs_simGie = 1;
+	u8_gs_simEarlyWakeups = u8_a_earlyWakeups;
+	u64_gs_simEarlyCount = 0;
+	u64_gs_simSleeps = 0;
+	u64_gs_simMaxClockError = 0;
+	u64_gs_simMissedCompares = 0;
+	u64_gs_simLateRuns = 0;
+	for ( u8_l_taskId = 0; u8_l_taskId < SIM_U8_TASKS_NUMBER; u8_l_taskId++ ) u64_gs_simRuns[u8_l_taskId] = 0;
+
+	SCH_init( st_gs_simTasks, SIM_U8_TASKS_NUMBER );
+	SCH_suspendTask( SIM_U8_PARKED_TASK_ID );
+
+	/* Step 2: Run, SLP_sleep comes back here once the time is over */
+	if ( setjmp( st_gs_simEndOfRun ) == 0 ) SCH_start();
+
+	/* Step 3: Expected runs and wake-ups: one wake-up per tick releasing a task */
+	u64_l_releaseTicks = 0;
+	u8_l_ok = STD_OK;
+	SCH_getTicks( &u32_l_ticks );
+	SCH_getIdleStats( &u32_l_awakeMs, &u32_l_sleepMs, &u32_l_wakeups );
+
+	for ( u32_l_tick = 1; u32_l_tick <= u32_l_ticks; u32_l_tick++ )
+	{
+		if ( ( SIM_releases( SIM_U8_FAST_TASK_ID, u32_l_tick ) != SIM_releases( SIM_U8_FAST_TASK_ID, u32_l_tick - 1 ) ) ||
+			 ( SIM_releases( SIM_U8_SLOW_TASK_ID, u32_l_tick ) != SIM_releases( SIM_U8_SLOW_TASK_ID, u32_l_tick - 1 ) ) ) u64_l_releaseTicks++;
+	}
+
+	printf( "%s early wake-ups, %lu h: %lu ticks, %lu early wake-ups\n",
+			( u8_a_earlyWakeups == STD_OK ) ? "With" : "Without", ( u32 ) u32_a_hours, u32_l_ticks, ( u32 ) u64_gs_simEarlyCount );
+	printf( "  wake-ups      : %lu ( %lu ticks releasing a task, %lu with a periodic tick )\n",
+			u32_l_wakeups, ( u32 ) u64_l_releaseTicks, u32_l_ticks );
+	printf( "  clock error   : %lu usec. at worst, %lu compare values behind the counter\n",
+			( u32 ) u64_gs_simMaxClockError, ( u32 ) u64_gs_simMissedCompares );
+	printf( "  sleep / awake : %lu / %lu msec.\n", u32_l_sleepMs, u32_l_awakeMs );
+
+	/* Check 1: Wake-ups counted by the scheduler are the simulated ones */
+	if ( u32_l_wakeups != u64_gs_simSleeps ) { printf( "  FAIL: %lu wake-ups counted, %lu slept\n", u32_l_wakeups, ( u32 ) u64_gs_simSleeps ); u8_l_ok = STD_NOK; }
+
+	/* Check 2: One wake-up per release tick, plus at most two per early wake-up ( itself, and the tick boundary it cut to ) */
+	if ( ( u32_l_wakeups < ( u64_l_releaseTicks + u64_gs_simEarlyCount ) ) ||
+		 ( u32_l_wakeups > ( u64_l_releaseTicks + ( 2 * u64_gs_simEarlyCount ) ) ) )
+	{
+		printf( "  FAIL: wake-ups out of [ %lu, %lu ]\n", ( u32 ) ( u64_l_releaseTicks + u64_gs_simEarlyCount ),
+				( u32 ) ( u64_l_releaseTicks + ( 2 * u64_gs_simEarlyCount ) ) );
+		u8_l_ok = STD_NOK;
+	}
+
+	/* Check 3: No drift, and no missed compare match */
+	if ( ( u64_gs_simMaxClockError != 0 ) || ( u64_gs_simMissedCompares != 0 ) ) { printf( "  FAIL: clock\n" ); u8_l_ok = STD_NOK; }
+
+	/* Check 4: Every task ran once per period, on its ticks, and the parked one never ran */
+	for ( u8_l_taskId = 0; u8_l_taskId < SIM_U8_TASKS_NUMBER; u8_l_taskId++ )
+	{
+		u64_l_expected = ( u8_l_taskId == SIM_U8_PARKED_TASK_ID ) ? 0 : SIM_releases( u8_l_taskId, u32_l_ticks );
+
+		if ( u64_gs_simRuns[u8_l_taskId] != u64_l_expected )
+		{
+			printf( "  FAIL: task %u ran %lu times, %lu expected\n", u8_l_taskId, ( u32 ) u64_gs_simRuns[u8_l_taskId], ( u32 ) u64_l_expected );
+			u8_l_ok = STD_NOK;
+		}
+	}
+
+	if ( u64_gs_simLateRuns != 0 ) { printf( "  FAIL: %lu runs off their release tick\n", ( u32 ) u64_gs_simLateRuns ); u8_l_ok = STD_NOK; }
+
+	/* Check 5: Without early wake-ups, exactly one wake-up per release tick */
+	if ( ( u8_a_earlyWakeups == STD_NOK ) && ( u32_l_wakeups != u64_l_releaseTicks ) ) { printf( "  FAIL: wake-ups\n" ); u8_l_ok = STD_NOK; }
+
+	printf( "  %s\n", ( u8_l_ok == STD_OK ) ? "PASS" : "FAIL" );
+
+	return u8_l_ok;
+}
+
+int main( int argc, char *argv[] )
+{
+	u32 u32_l_hours = 24;
+	u8  u8_l_ok = STD_OK;
+
+	if ( argc > 1 ) u32_l_hours = strtoul( argv[1], NULL, 0 );
+	if ( argc > 2 ) u32_gs_simRandom = strtoul( argv[2], NULL, 0 );
+	if ( u32_gs_simRandom == 0 ) u32_gs_simRandom = 1;
+
+	if ( SIM_run( u32_l_hours, STD_NOK ) != STD_OK ) u8_l_ok = STD_NOK;
+	if ( SIM_run( u32_l_hours, STD_OK ) != STD_OK )  u8_l_ok = STD_NOK;
+
+	return ( u8_l_ok == STD_OK ) ? 0 : 1;
+}